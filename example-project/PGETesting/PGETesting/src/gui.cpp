@@ -13,7 +13,17 @@ void GUI::create()
     frost_ui.add_console("window", "console", "Console", { 0, 76 }, { 290, 100 }, 20);
     // command handler is mandatory to have for console window, if you don't want to execute any actions simply do '*return_msg = command'
     // for it to print out any text your type into the input field of the console
-    frost_ui.find_element("console")->add_command_handler([](std::string& command, std::string* return_msg) { *return_msg = command; });
+    // the handler runs after every element had its input, so it's free to add or remove elements, 'remove quality' removes the quality dropdown
+    frost_ui.find_element("console")->add_command_handler([&](std::string& command, std::string* return_msg)
+        {
+            if (command.rfind("remove ", 0) == 0 && frost_ui.find_element(command.substr(7)))
+            {
+                frost_ui.remove_element(command.substr(7));
+                *return_msg = "removed " + command.substr(7);
+            }
+            else
+                *return_msg = command;
+        });
     
     frost_ui.add_groupbox("groupbox1", "", { 0, 0 }, { 200, 250 });
 
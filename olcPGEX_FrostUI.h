@@ -56,8 +56,46 @@
 
 #include "olcPixelGameEngine.h"
 #include <deque>
+#include <unordered_map>
 #include <iomanip>
 #include <ctime>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <array>
+#include <bitset>
+#include <string_view>
+#include <optional>
+#include <limits>
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#define FUI_COROUTINES
+#endif
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FUI_SIMD_SSE
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define FUI_SIMD_NEON
+#endif
 
 /*
 ####################################################
@@ -112,6 +150,69 @@ namespace olc
         // console colors
         olc::Pixel console_outline = olc::BLACK;
         olc::Pixel console_background = { 150, 150, 150 };
+        // scrollview colors
+        olc::Pixel scrollview_outline = olc::BLACK;
+        olc::Pixel scrollview_background = { 225, 225, 225 };
+        olc::Pixel scrollbar_track = { 200, 200, 200 };
+        olc::Pixel scrollbar_thumb = { 120, 120, 120 };
+        olc::Pixel scrollbar_thumb_hover = { 80, 80, 80 };
+        // table colors
+        olc::Pixel table_outline = olc::BLACK;
+        olc::Pixel table_background = { 225, 225, 225 };
+        olc::Pixel table_header = { 150, 150, 150 };
+        olc::Pixel table_row_alternate = { 210, 210, 210 };
+        olc::Pixel table_row_selected = { 120, 140, 200 };
+        olc::Pixel table_grid = { 170, 170, 170 };
+        // treeview colors
+        olc::Pixel treeview_outline = olc::BLACK;
+        olc::Pixel treeview_background = { 225, 225, 225 };
+        olc::Pixel treeview_hover = { 200, 200, 200 };
+        olc::Pixel treeview_selected = { 120, 140, 200 };
+        olc::Pixel treeview_placeholder = { 100, 100, 100 };
+        // plot colors
+        olc::Pixel plot_outline = olc::BLACK;
+        olc::Pixel plot_background = { 40, 40, 40 };
+        olc::Pixel plot_grid = { 70, 70, 70 };
+        olc::Pixel plot_text = { 200, 200, 200 };
+        // canvas colors
+        olc::Pixel canvas_outline = olc::BLACK;
+        olc::Pixel canvas_background = { 20, 20, 20 };
+        // fileview colors
+        olc::Pixel fileview_outline = olc::BLACK;
+        olc::Pixel fileview_background = { 30, 30, 30 };
+        olc::Pixel fileview_offset = { 120, 160, 200 };
+        olc::Pixel fileview_text = { 210, 210, 210 };
+        // logtail colors
+        olc::Pixel logtail_outline = olc::BLACK;
+        olc::Pixel logtail_background = { 30, 30, 30 };
+        olc::Pixel logtail_text = { 210, 210, 210 };
+        // timeline colors
+        olc::Pixel timeline_outline = olc::BLACK;
+        olc::Pixel timeline_background = { 35, 35, 35 };
+        olc::Pixel timeline_ruler = { 60, 60, 60 };
+        olc::Pixel timeline_ruler_text = { 200, 200, 200 };
+        olc::Pixel timeline_aggregate = { 120, 120, 120 };
+        olc::Pixel timeline_hover = olc::WHITE;
+        // nodegraph colors
+        olc::Pixel nodegraph_outline = olc::BLACK;
+        olc::Pixel nodegraph_background = { 45, 45, 45 };
+        olc::Pixel nodegraph_grid = { 55, 55, 55 };
+        olc::Pixel nodegraph_node = { 90, 90, 90 };
+        olc::Pixel nodegraph_node_title = { 60, 90, 130 };
+        olc::Pixel nodegraph_node_text = olc::WHITE;
+        olc::Pixel nodegraph_node_outline = { 20, 20, 20 };
+        olc::Pixel nodegraph_pin = { 200, 200, 120 };
+        olc::Pixel nodegraph_link = { 210, 210, 210 };
+        // progressbar colors
+        olc::Pixel progressbar_outline = olc::BLACK;
+        olc::Pixel progressbar_background = { 200, 200, 200 };
+        olc::Pixel progressbar_fill = { 80, 160, 90 };
+        olc::Pixel progressbar_text = olc::BLACK;
+        // spinner colors
+        olc::Pixel spinner_idle = { 200, 200, 200 };
+        olc::Pixel spinner_active = { 60, 90, 130 };
+        // busy colors
+        olc::Pixel busy_overlay = { 255, 255, 255, 120 };
     };
 
     enum class FUI_Type
@@ -124,7 +225,205 @@ namespace olc
         GROUPBOX,
         SLIDER,
         INPUTFIELD,
-        CONSOLE
+        CONSOLE,
+        SCROLLVIEW,
+        TABLE,
+        TREEVIEW,
+        PLOT,
+        CANVAS,
+        FILEVIEW,
+        LOGTAIL,
+        TIMELINE,
+        NODEGRAPH,
+        GRAPHNODE,
+        PROGRESSBAR,
+        SPINNER
+    };
+
+    // Formats a number into buffer without allocating (std::to_chars, snprintf where the standard library has no
+    // floating point to_chars) and returns the length. A negative precision gives the shortest form like "%g".
+    size_t fui_format_number(char* buffer, size_t capacity, double value, int precision);
+
+    size_t fui_format_number(char* buffer, size_t capacity, int64_t value);
+
+    // Text of a number that is only formatted again when the number changes, the string keeps its capacity
+    class FUI_NumberText
+    {
+    private:
+        std::string text;
+        std::string prefix;
+        std::string suffix;
+        double value = 0.0;
+        int precision = 0;
+        bool is_integer = false;
+        bool is_set = false;
+    public:
+        FUI_NumberText(const std::string& prefix = "", const std::string& suffix = "");
+
+        // both return true when the text changed
+        bool set(double v, int digits);
+
+        bool set(int64_t v);
+
+        const std::string& get() const { return text; }
+    };
+
+    // Timestamp formatter built from a template that is parsed once. localtime/strftime only run when the minute
+    // changes, seconds and milliseconds are written directly. Takes the strftime fields plus %f (milliseconds) and
+    // %q (monotonic seconds since the formatter was created, "12.345"). Locale dependent fields that include the
+    // seconds (%c, %X, %r, ...) are formatted on every call. format() may be called from any thread.
+    class FUI_Timestamp
+    {
+    private:
+        enum class Field
+        {
+            // strftime pattern that only changes once a minute
+            CACHED = 0,
+            // strftime pattern that carries seconds in a form that can't be split out (%c, %X, %s, ...)
+            UNCACHED,
+            SECOND,
+            MILLISECOND,
+            MONOTONIC
+        };
+
+        struct Piece
+        {
+            Field field = Field::CACHED;
+            std::string pattern;
+            std::string text;
+        };
+
+        mutable std::mutex cache_mutex;
+        mutable std::vector<Piece> pieces;
+        mutable int64_t cached_minute = std::numeric_limits<int64_t>::min();
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        void refresh(int64_t minute) const;
+    public:
+        FUI_Timestamp(const std::string& format = "%R");
+
+        void set_format(const std::string& format);
+
+        // appends the stamp for the given time to out
+        void format(std::string& out, std::chrono::system_clock::time_point time, std::chrono::steady_clock::time_point tick) const;
+
+        void format(std::string& out) const { format(out, std::chrono::system_clock::now(), std::chrono::steady_clock::now()); }
+    };
+
+    // Clock and input state of one frame. FrostUI::run captures it once before any element runs, every input() and
+    // draw() of that frame reads the same values instead of asking the engine again.
+    struct FUI_Frame
+    {
+        static constexpr int mouse_buttons = 5;
+        static constexpr int key_count = olc::Key::ENUM_END;
+
+        uint64_t index = 0;
+        // monotonic seconds
+        double time = 0.0;
+        float delta_time = 0.f;
+
+        olc::vi2d mouse_position = { 0, 0 };
+        olc::vi2d mouse_delta = { 0, 0 };
+        int32_t mouse_wheel = 0;
+        std::array<olc::HWButton, mouse_buttons> mouse{};
+
+        std::bitset<key_count> keys_pressed;
+        std::bitset<key_count> keys_held;
+        std::bitset<key_count> keys_released;
+
+        void capture(olc::PixelGameEngine* pge);
+
+        const olc::HWButton get_mouse(int button) const;
+
+        const olc::HWButton get_key(olc::Key key) const;
+
+        // mouse moved, scrolled, or any button or key is down or changed
+        const bool has_input() const;
+
+        // a button or key was pressed or released, or the wheel moved
+        const bool has_input_events() const;
+    };
+
+    // What run() reports so hosts can skip presenting or sleep while the UI is static
+    struct FUI_RunStatus
+    {
+        // something visible changed this frame
+        bool changed = true;
+        // frame clock time (FUI_Frame::time) of the next change that's already known, infinity if there is none.
+        // Input, posted ops and finished async work can still come earlier
+        double next_change = std::numeric_limits<double>::infinity();
+    };
+
+    // Running tweens of all elements, advanced once per frame by FrostUI::run. Values move linearly to their target
+    // at speed units per second and are dropped once they get there, so only animating values are stored or touched.
+    class FUI_Animator : public std::enable_shared_from_this<FUI_Animator>
+    {
+    private:
+        struct Tween
+        {
+            const void* owner = nullptr;
+            float* value = nullptr;
+            float target = 0.f;
+            float speed = 0.f;
+        };
+
+        std::vector<Tween> tweens;
+    public:
+        // starts the tween of value, or changes the target and speed of the running one
+        void animate(const void* owner, float* value, float target, float speed);
+
+        // value stays where it currently is
+        void stop(const float* value);
+
+        // stops everything owner started, elements call this when they are destroyed
+        void stop_all(const void* owner);
+
+        const bool is_running(const float* value);
+
+        const bool empty() { return tweens.empty(); }
+
+        void tick(float delta_time);
+    };
+
+    // Writes the FUI_Frame of every run() to a binary file: a header (magic, version, key and button counts) and per
+    // frame the clock, mouse, wheel, button masks and only the keys that are pressed, held or released. Host byte order.
+    class FUI_InputRecorder
+    {
+    private:
+        std::ofstream file;
+        std::vector<uint8_t> buffer;
+    public:
+        bool open(const std::string& path);
+
+        void close();
+
+        const bool is_open() { return file.is_open(); }
+
+        void write(const FUI_Frame& frame);
+    };
+
+    // Reads a recording made by FUI_InputRecorder. The whole file is loaded on open so a replay doesn't wait on the disk.
+    class FUI_InputReplay
+    {
+    private:
+        std::vector<uint8_t> data;
+        size_t offset = 0;
+        bool opened = false;
+
+        template<typename T>
+        bool read_value(T& value);
+    public:
+        bool open(const std::string& path);
+
+        void close();
+
+        const bool is_open() { return opened; }
+
+        const bool at_end() { return offset >= data.size(); }
+
+        // overwrites frame with the next recorded frame (index and mouse delta continue from frame), false when the
+        // recording ended or is broken
+        bool read(FUI_Frame& frame);
     };
 
     class FUI_Window
@@ -201,9 +500,118 @@ namespace olc
         void disable_dragging(bool state);
 
         void disable_close(bool state);
+
+        // the background hides whatever is behind the window
+        const bool is_opaque();
+    };
+
+    // Application owned value with a version counter, a binding only compares the version to notice a write
+    template<typename T>
+    class FUI_Value
+    {
+    private:
+        T value{};
+        uint64_t version = 0;
+    public:
+        FUI_Value() = default;
+        FUI_Value(const T& v) : value(v) {}
+
+        const T& get() const { return value; }
+
+        void set(const T& v) { value = v; version++; }
+
+        // in place edits, call touch() when done
+        T& edit() { return value; }
+
+        void touch() { version++; }
+
+        const uint64_t get_version() const { return version; }
+    };
+
+    class FUI_BindingBase
+    {
+    public:
+        virtual ~FUI_BindingBase() = default;
+
+        // called by FUI_Element::update every frame, returns true when the user's value was written to the
+        // application and on_change still has to run
+        virtual bool sync() = 0;
+
+        // runs on_change with the value sync wrote, delivered through the event bus
+        virtual void notify() = 0;
+    };
+
+    // when set_on_change callbacks run after the value changed
+    enum class FUI_ChangePolicy
+    {
+        // once per frame with a change
+        IMMEDIATE = 0,
+        // at most once per interval, the last change is still delivered
+        THROTTLE,
+        // once the value stayed unchanged for the interval
+        DEBOUNCE,
+        // once the user lets go (slider released, inputfield unfocused)
+        ON_RELEASE
+    };
+
+    class FUI_Element;
+
+    enum class FUI_EventType
+    {
+        // button clicked
+        CLICK = 0,
+        // enter pressed in an inputfield
+        ENTER,
+        // value changed, see set_on_change
+        CHANGE,
+        // a bound value was written back to the application, runs the on_change given to bind
+        BINDING,
+        // enter pressed in a console, runs the command handler
+        COMMAND
+    };
+
+    struct FUI_Event
+    {
+        FUI_EventType type;
+        // kept alive until the event is delivered, even if it got removed in the meantime
+        std::shared_ptr<FUI_Element> element;
+    };
+
+    // Events raised during FrostUI::run are queued and delivered once every element had its input, so callbacks
+    // can add or remove elements safely. Events raised by callbacks are delivered with the next frame.
+    class FUI_EventBus
+    {
+    private:
+        struct Subscription
+        {
+            uint64_t id;
+            FUI_EventType type;
+            // nullptr for every element
+            FUI_Element* element;
+            std::function<void(const FUI_Event&)> callback;
+        };
+
+        std::vector<FUI_Event> queue;
+        std::vector<FUI_Event> dispatching;
+        // deque so subscribing from a callback doesn't move the callback that is running
+        std::deque<Subscription> subscriptions;
+        uint64_t next_id = 1;
+        bool is_dispatching = false;
+        bool has_removed = false;
+    public:
+        uint64_t subscribe(FUI_EventType type, FUI_Element* element, std::function<void(const FUI_Event&)> callback);
+
+        void unsubscribe(uint64_t id);
+
+        void push(FUI_EventType type, std::shared_ptr<FUI_Element> element);
+
+        void dispatch();
+
+        // events raised by callbacks, waiting for the next frame
+        const bool has_pending();
     };
 
-    class FUI_Element
+    class FUI_Element : public std::enable_shared_from_this<FUI_Element>
     {
     public:
         enum class type
@@ -219,6 +627,8 @@ namespace olc
             ACTIVE
         };
         FUI_Window* parent = nullptr;
+        // set when the element lives inside a container element (scrollview, graph node), the container drives draw/input
+        FUI_Element* container = nullptr;
         olc::vf2d size;
         olc::vf2d position;
         olc::vf2d absolute_position;
@@ -274,12 +684,85 @@ namespace olc
         std::function<void(std::string& command, std::string* return_msg)> command_handler;
         bool should_clear_console = false;
         std::string command_entry;
+
+        // change events, input sets value_changed when the user edits the value
+        bool value_changed = false;
+        bool change_pending = false;
+        std::function<void()> change_callback;
+        FUI_ChangePolicy change_policy = FUI_ChangePolicy::IMMEDIATE;
+        double change_interval = 0.0;
+        double last_edit_time = 0.0;
+        double last_change_event = 0.0;
+
+        // > 0 while async work started by this element is running
+        int busy = 0;
+
+        // last drain of posted ops that had a set_text / set_value for this element, used to keep only the newest
+        uint64_t posted_text_drain = 0;
+        uint64_t posted_value_drain = 0;
+
+        // set by FrostUI::run, events raised outside of it run their callbacks right away
+        static FUI_EventBus* event_bus;
+
+        // input and clock of the current frame, FrostUI::run points it at the snapshot of its own instance
+        static FUI_Frame* frame;
+        static FUI_Frame idle_frame;
+
+        // redraw flag of the FrostUI the element was added to, elements it doesn't know about (like the console's
+        // inputfield) use the one of the FrostUI that is running
+        bool* redraw_flag = nullptr;
+        static bool* running_redraw;
+
+        // animator of the FrostUI whose run() is going on, tweens started outside of run() jump to their target
+        static FUI_Animator* animator;
+        // animator this element's tweens were started on, they're stopped there when the element goes away
+        std::weak_ptr<FUI_Animator> tween_animator;
+
+        void animate(float* value, float target, float speed);
+
+        void emit(FUI_EventType event);
+
+        // the element's own callback for the event
+        virtual void run_event(FUI_EventType event);
+
+        friend class FUI_EventBus;
+        friend class FrostUI;
+        friend class FUI_Window;
+
+        // application storage the widget value is bound to, see the bind functions of the handles
+        std::unique_ptr<FUI_BindingBase> binding;
+
+        // typed handles keep pointers to the values they read
+        friend class FUI_ButtonHandle;
+        friend class FUI_CheckboxHandle;
+        friend class FUI_DropdownHandle;
+        friend class FUI_CombolistHandle;
+        friend class FUI_InputfieldHandle;
+        template<typename T>
+        friend class FUI_SliderHandle;
+        template<typename E>
+        friend class FUI_Handle;
     public:
 
+        virtual ~FUI_Element();
+
         virtual void draw(olc::PixelGameEngine* pge) {}
 
         virtual void input(olc::PixelGameEngine* pge) {}
 
+        // Model updates that don't depend on being drawn (bindings, files, work finished on other threads), run by
+        // FrostUI::run every frame before input and draw, for hidden and rate limited frames too. Returns true when
+        // what the element shows changed
+        virtual bool update(olc::PixelGameEngine* pge);
+
+        // position that children of this element are placed relative to
+        virtual const olc::vf2d get_content_position();
+
+        // area draw() covers from absolute_position, used to find windows that are hidden
+        virtual const olc::vf2d get_draw_size() { return size; }
+
+        virtual void remove_child(FUI_Element*) {}
+
         const std::string get_identifier();
 
         const int get_elements_amount();
@@ -290,6 +773,13 @@ namespace olc
 
         FUI_Window* get_parent();
 
+        FUI_Element* get_container();
+
+        void set_container(FUI_Element* c);
+
+        // true if element is this one or sits somewhere inside it, nesting this into element would be a cycle
+        const bool encloses(FUI_Element* element);
+
         const FUI_Type get_ui_type();
 
         const olc::vf2d get_size();
@@ -361,6 +851,28 @@ namespace olc
         void set_checkbox_state(bool state);
 
         const bool get_checkbox_state();
+
+        // cb runs after the input pass when the user changed the value (slider, checkbox, dropdown, combolist,
+        // inputfield), interval is in seconds and used by THROTTLE and DEBOUNCE
+        void set_on_change(std::function<void()> cb, FUI_ChangePolicy policy = FUI_ChangePolicy::IMMEDIATE, float interval = 0.f);
+
+        // true while the user is still editing the value
+        virtual const bool is_interacting() { return false; }
+
+        // Frame clock time the element changes on its own next (animations, caret, background work), asked after
+        // the element was drawn. frame.time means it needs the next frame too, infinity that it's static
+        virtual const double get_next_change();
+
+        // marks the current frame as changed, for changes made outside of input (bindings, ops, the host)
+        void request_redraw() { if (redraw_flag) *redraw_flag = true; else if (running_redraw) *running_redraw = true; }
+
+        // busy buttons ignore clicks and are drawn faded, nests so overlapping work keeps it busy
+        void set_busy(bool state);
+
+        const bool is_busy();
+
+        // runs the change callback if its policy allows it, called by FrostUI once per frame
+        void dispatch_change(double now);
     };
 
     class FUI_Label : public FUI_Element
@@ -428,6 +940,9 @@ namespace olc
         DropdownState state = DropdownState::NONE;
         bool is_open = false;
         int item_start_index = 1;
+
+        // hands active_size to the animator when it isn't at the open / closed size
+        void update_open_animation();
     public:
         FUI_Dropdown(const std::string& id, FUI_Window* parent, const std::string& text, olc::vi2d position, olc::vi2d size);
         FUI_Dropdown(const std::string& id, FUI_Window* parent, const std::string& group, const std::string& text, olc::vi2d position, olc::vi2d size);
@@ -436,6 +951,9 @@ namespace olc
 
         void draw(olc::PixelGameEngine* pge) override;
 
+        // the open list hangs below the element
+        const olc::vf2d get_draw_size() override { return { size.x, size.y + active_size.y }; }
+
         void input(olc::PixelGameEngine* pge) override;
     };
 
@@ -446,6 +964,9 @@ namespace olc
         DropdownState state = DropdownState::NONE;
         bool is_open = false;
         int item_start_index = 1;
+
+        // hands active_size to the animator when it isn't at the open / closed size
+        void update_open_animation();
     public:
         FUI_Combolist(const std::string& id, FUI_Window* parent, const std::string& text, olc::vi2d position, olc::vi2d size);
         FUI_Combolist(const std::string& id, FUI_Window* parent, const std::string& group, const std::string& text, olc::vi2d position, olc::vi2d size);
@@ -454,6 +975,9 @@ namespace olc
 
         void draw(olc::PixelGameEngine* pge) override;
 
+        // the open list hangs below the element
+        const olc::vf2d get_draw_size() override { return { size.x, size.y + active_size.y }; }
+
         void input(olc::PixelGameEngine* pge) override;
     };
 
@@ -486,7 +1010,11 @@ namespace olc
 
         bool run_once = true;
 
-        std::string to_string_with_precision(const float a_value, const int n);
+        // "[value]" shown on the bar, formatted only when the value changes
+        FUI_NumberText value_text = FUI_NumberText("[", "]");
+        olc::vf2d value_text_size = { 0.f, 0.f };
+        // text_scale the size was measured at
+        olc::vf2d value_text_scale = { 0.f, 0.f };
 
     public:
         // float sliders
@@ -504,6 +1032,8 @@ namespace olc
         void draw(olc::PixelGameEngine* pge) override;
 
         void input(olc::PixelGameEngine* pge) override;
+
+        const bool is_interacting() override { return state == State::ACTIVE; }
     };
 
     // Credits to Megarev#2866 on discord for keyboard input related code
@@ -559,9 +1089,15 @@ namespace olc
         FUI_Inputfield(const std::string& id, const std::string& group, const std::string& text, olc::vi2d position, olc::vi2d size);
         FUI_Inputfield(const std::string& id, const std::string& text, olc::vi2d position, olc::vi2d size);
 
+        bool update(olc::PixelGameEngine* pge) override;
+
         void draw(olc::PixelGameEngine* pge) override;
 
+        const double get_next_change() override;
+
         void input(olc::PixelGameEngine* pge) override;
+
+        const bool is_interacting() override { return is_focused; }
     };
 
     class FUI_Console : public FUI_Element
@@ -583,1727 +1119,9022 @@ namespace olc
         int commands_shown = 1;
         float last_pos = 0.f;
 
-        std::string get_time()
-        {
-            std::time_t tt = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-            struct std::tm ptm;
-#ifdef _MSC_VER
-            localtime_s(&ptm, &tt);
-#else
-            localtime_r(&tt, &ptm);
-#endif
-            std::stringstream ss;
-            ss << std::put_time(&ptm, "%R");
-            return ss.str();
-        }
+        FUI_Timestamp timestamp;
+        // lines from log(), already stamped by the thread that logged them
+        std::mutex log_mutex;
+        std::vector<std::string> logged_lines;
+        std::vector<std::string> draining_lines;
+        // entered commands, the handler runs when the COMMAND event is delivered so it can change elements
+        std::vector<std::string> pending_commands;
+        // engine the commands were entered on, their output is measured with it when the event is delivered
+        olc::PixelGameEngine* command_pge = nullptr;
+
+        void push_line(olc::PixelGameEngine* pge, std::string display_text);
+
+        void run_event(FUI_EventType event) override;
     public:
         FUI_Console(const std::string& id, FUI_Window* parent, const std::string& title, olc::vi2d position, olc::vi2d size, int input_thickness);
         FUI_Console(const std::string& id, FUI_Window* parent, const std::string& group, const std::string& title, olc::vi2d position, olc::vi2d size, int input_thickness);
         FUI_Console(const std::string& id, const std::string& title, olc::vi2d position, olc::vi2d size, int input_thickness);
         FUI_Console(const std::string& id, const std::string& group, const std::string& title, olc::vi2d position, olc::vi2d size, int input_thickness);
 
+        bool update(olc::PixelGameEngine* pge) override;
+
         void draw(olc::PixelGameEngine* pge) override;
 
+        const double get_next_change() override;
+
         void input(olc::PixelGameEngine* pge) override;
+
+        // strftime style, see FUI_Timestamp. Default is "%R"
+        void set_timestamp_format(const std::string& format);
+
+        // adds a line to the console, safe to call from any thread. The line is stamped on the calling thread
+        void log(const std::string& line);
     };
 
-    class FrostUI : public olc::PGEX
+    class FUI_ScrollView : public FUI_Element
     {
     private:
-        std::deque<FUI_Window*> windows;
-        std::vector<std::pair<std::string, std::string>> groups;
-        std::string active_window_id;
-        std::pair<std::string, std::string> active_group;
-        std::deque<std::shared_ptr<FUI_Element>> elements;
-        std::deque<std::shared_ptr<FUI_Element>> groupboxes;
-        std::pair<bool, std::shared_ptr<FUI_Element>> trigger_pushback = std::make_pair(false, nullptr);
+        enum class State
+        {
+            NONE = 0,
+            HOVER,
+            ACTIVE
+        };
 
-        std::string current_focused_window;
-        std::string saved_focused_window;
+        State thumb_state = State::NONE;
 
-        bool prime_window_focusing = true;
+        // children are kept sorted by their y position so the visible range can be found with a binary search
+        std::vector<std::shared_ptr<FUI_Element>> children;
+        int first_visible = 0;
+        int last_visible = 0;
 
-        bool is_a_window_focused();
+        olc::vf2d scroll_offset = { 0.f, 0.f };
+        float content_height = 0.f;
+        bool content_dirty = true;
 
-        bool disable_window_input_if_open_dropdown(int window_index);
+        float scroll_step = 20.f;
+        float scrollbar_width = 6.f;
+        float thumb_difference = 0.f;
 
-        void cycle_inputfield();
+        void sort_children();
 
-        void push_focused_to_back();
+        void update_content_height(olc::PixelGameEngine* pge);
 
-        void push_focused_element_to_back();
+        void update_visible_range();
 
-        bool is_cursor_in_window();
+        bool is_child_visible(const std::shared_ptr<FUI_Element>& child);
+
+        const float get_max_scroll();
+
+        const float get_thumb_height();
 
+        const olc::vf2d get_thumb_position();
     public:
+        FUI_ScrollView(const std::string& id, FUI_Window* parent, olc::vi2d position, olc::vi2d size);
+        FUI_ScrollView(const std::string& id, FUI_Window* parent, const std::string& group, olc::vi2d position, olc::vi2d size);
+        FUI_ScrollView(const std::string& id, const std::string& group, olc::vi2d position, olc::vi2d size);
+        FUI_ScrollView(const std::string& id, olc::vi2d position, olc::vi2d size);
+        ~FUI_ScrollView();
 
-        void set_active_window(const std::string& window_id);
+        void add_child(std::shared_ptr<FUI_Element> child);
 
-        void set_active_group(const std::string& g);
+        void remove_child(FUI_Element* child) override;
 
-        FUI_Window* create_window(const std::string& identifier, const std::string& title, olc::vi2d position, olc::vi2d size);
+        // call after moving or resizing children so ordering and scroll extents are rebuilt
+        void refresh_layout();
 
-        void add_group(const std::string& window_id, const std::string& g);
+        void set_scroll_step(float step);
 
-        void clear_active_window();
+        void scroll_to(float y);
 
-        void clear_active_group();
+        const olc::vf2d get_scroll_offset();
 
-        const std::string& get_active_group();
+        const float get_content_height();
 
-        void add_button(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, std::function<void()> callback);
+        const olc::vf2d get_content_position() override;
 
-        void add_button(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, std::function<void()> callback);
+        void draw(olc::PixelGameEngine* pge) override;
 
-        void add_checkbox(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+        void input(olc::PixelGameEngine* pge) override;
+    };
 
-        void add_checkbox(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+    // Pull-style data source for FUI_Table, the table only asks for the cells it's about to draw.
+    // compare() and matches() are called from the table's worker thread while sorting/filtering,
+    // so they (and get_cell) must be safe to call while the UI thread is reading the source.
+    class FUI_TableSource
+    {
+    public:
+        virtual ~FUI_TableSource() = default;
 
-        void add_dropdown(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+        virtual int get_row_count() = 0;
 
-        void add_dropdown(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+        virtual int get_column_count() = 0;
 
-        void add_combolist(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+        virtual void get_column_name(int, std::string& out) { out.clear(); }
 
-        void add_combolist(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+        virtual void get_cell(int row, int column, std::string& out) = 0;
 
-        void add_groupbox(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+        // default compares the cell text, numerically when both cells are numbers
+        virtual bool compare(int row_a, int row_b, int column);
 
-        void add_groupbox(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+        // default checks if any cell of the row contains the filter text
+        virtual bool matches(int row, const std::string& filter);
+    };
 
-        void add_float_slider(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, olc::vf2d range);
+    class FUI_Table : public FUI_Element
+    {
+    private:
+        struct CellCache
+        {
+            int row = -2;
+            int column = -1;
+            float column_width = 0.f;
+            std::string text;
+        };
 
-        void add_float_slider(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, olc::vf2d range);
+        struct Job
+        {
+            FUI_TableSource* source = nullptr;
+            int column = -1;
+            bool ascending = true;
+            std::string filter;
+            uint32_t generation = 0;
+        };
 
-        void add_int_slider(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, olc::vi2d range);
+        struct JobCancelled {};
 
-        void add_int_slider(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, olc::vi2d range);
+        FUI_TableSource* source = nullptr;
 
-        void add_label(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position);
+        std::vector<float> column_widths;
+        float default_column_width = 80.f;
+        float row_height = 12.f;
+        float scrollbar_width = 6.f;
 
-        void add_label(const std::string& identifier, const std::string& text, olc::vi2d position);
+        int first_row = 0;
+        int first_column = 0;
+        int selected_row = -1;
 
-        void add_inputfield(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+        int sort_column = -1;
+        bool sort_ascending = true;
+        std::string filter;
 
-        void add_inputfield(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+        // display order of the source rows, empty means the source order is used as is
+        std::vector<int> row_order;
+        bool has_order = false;
 
-        void add_console(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, int inputfield_thickness);
+        // direct mapped cache of the truncated cell text, indexed by (row, column)
+        static constexpr int cache_size = 4096;
+        std::vector<CellCache> cell_cache = std::vector<CellCache>(cache_size);
+        std::string fetch_buffer;
 
-        void add_console(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, int inputfield_thickness);
+        int resizing_column = -1;
+        float resize_difference = 0.f;
+        bool dragging_thumb = false;
+        float thumb_difference = 0.f;
 
-        FUI_Window* find_window(const std::string& identifier);
+        // background sort / filter
+        std::thread worker;
+        std::mutex job_mutex;
+        std::condition_variable job_condition;
+        Job job_request;
+        bool job_pending = false;
+        bool stop_worker = false;
+        std::atomic<uint32_t> job_generation{ 0 };
+        std::vector<int> ready_order;
+        std::atomic<bool> order_ready{ false };
+        std::atomic<bool> job_running{ false };
 
-        std::shared_ptr<FUI_Element> find_element(const std::string& identifier);
+        void worker_loop();
 
-        std::shared_ptr<FUI_Element> find_groupbox(const std::string& identifier);
+        bool run_job(const Job& job, std::vector<int>& order);
 
-        void remove_element(const std::string& identifier);
+        void request_job();
 
-        void remove_window(const std::string& identifier);
+        // true when a finished sort / filter was applied
+        bool apply_ready_order();
 
-        int get_element_amount();
+        const int get_display_row_count();
 
-        void run();
-    };
-}
-/*
-####################################################
-#               IMPLEMENTATIONS                    #
-####################################################
-*/
-#ifdef OLC_PGEX_FUI
-#undef OLC_PGEX_FUI
-namespace olc
-{
-    FUI_Window::FUI_Window(olc::PixelGameEngine* p, const std::string& id, olc::vi2d pos, olc::vi2d s, const std::string& txt)
-    {
-        identifier = id;
-        pge = p;
-        position = pos;
-        size = s;
-        title = txt;
-    }
+        const int get_rows_in_view();
 
-    const olc::vf2d FUI_Window::get_position() { return position; }
+        const int get_source_row(int display_row);
 
-    const olc::vf2d FUI_Window::get_size() { return size; }
+        // row -1 fetches the column name
+        const std::string& get_cell_text(olc::PixelGameEngine* pge, int row, int column, float width);
 
-    const olc::vf2d FUI_Window::get_window_space() { return olc::vf2d{ size.x - border_thickness * 2, size.y - top_border_thickness }; }
+        void fit_text(olc::PixelGameEngine* pge, std::string& txt, float width);
 
-    const std::string FUI_Window::get_id() { return identifier; }
+        void scroll_rows(int amount);
+    public:
+        FUI_Table(const std::string& id, FUI_Window* parent, olc::vi2d position, olc::vi2d size);
+        FUI_Table(const std::string& id, FUI_Window* parent, const std::string& group, olc::vi2d position, olc::vi2d size);
+        FUI_Table(const std::string& id, const std::string& group, olc::vi2d position, olc::vi2d size);
+        FUI_Table(const std::string& id, olc::vi2d position, olc::vi2d size);
+        ~FUI_Table();
 
-    const float FUI_Window::get_top_border_thickness() { return top_border_thickness; }
+        // the source is owned by the caller and must outlive the table (and any sort still running on it)
+        void set_source(FUI_TableSource* src);
 
-    const float FUI_Window::get_border_thickness() { return border_thickness; }
+        // call when the source data changed, drops cached cells and re-runs the current sort / filter
+        void refresh();
 
-    void FUI_Window::set_top_border_thickness(float thickness) { top_border_thickness = thickness; }
+        void set_column_width(int column, float width);
 
-    void FUI_Window::set_border_thickness(float thickness) { border_thickness = thickness; }
+        const float get_column_width(int column);
 
-    void FUI_Window::close_window(bool close) { should_render = !close; }
+        void set_row_height(float height);
 
-    const bool FUI_Window::get_closed_state() { return !should_render; }
+        // column < 0 restores the source order
+        void sort_by(int column, bool ascending);
 
-    void FUI_Window::change_position(olc::vi2d pos) { position = pos; }
+        void set_filter(const std::string& f);
 
-    void FUI_Window::change_size(olc::vi2d s) { size = s; }
+        const bool is_sorting();
 
-    void FUI_Window::set_focused(bool state) { focused = state; }
+        // returns the selected row as an index into the source, -1 if nothing is selected
+        const int get_selected_row();
 
-    const bool FUI_Window::is_focused() { return focused; }
+        bool update(olc::PixelGameEngine* pge) override;
 
-    void FUI_Window::disable_dragging(bool state) { disable_drag = state; }
+        void draw(olc::PixelGameEngine* pge) override;
 
-    void FUI_Window::disable_close(bool state) { disable_exit = state; }
+        const double get_next_change() override { return job_running || order_ready ? frame->time : FUI_Element::get_next_change(); }
 
-    void FUI_Window::draw()
-    {
-        // Draw the main window area
-        pge->FillRectDecal(position, size, color_scheme.window_background_color);
-
-        // Draw the window border
-        pge->FillRectDecal(position, olc::vf2d{ border_thickness, size.y }, color_scheme.window_border_color); // Left side
-        pge->FillRectDecal(olc::vf2d{ position.x + size.x - border_thickness, position.y }, olc::vf2d{ border_thickness, size.y }, color_scheme.window_border_color); // Right side
-        pge->FillRectDecal(olc::vf2d{ position.x, position.y + size.y - border_thickness }, olc::vf2d{ size.x, border_thickness }, color_scheme.window_border_color); // Bottom side
-        pge->FillRectDecal(position, olc::vf2d{ size.x, top_border_thickness }, color_scheme.window_border_color); // Top bar
+        void input(olc::PixelGameEngine* pge) override;
+    };
 
-        // Draw the window title
-        olc::vf2d title_position = olc::vf2d{ position.x + (size.x / 2) - (pge->GetTextSizeProp(title).x / 2), position.y + (top_border_thickness / 2) - (pge->GetTextSizeProp(title).y / 2) };
-        pge->DrawStringPropDecal(title_position, title, color_scheme.window_title_color);
+    struct FUI_TreeItem
+    {
+        std::string text;
+        // handed back to the children provider, typically an index or pointer into the host's own hierarchy
+        uint64_t user_id = 0;
+        bool has_children = false;
+    };
 
-        // Draw the default window close button
-        if (!disable_exit)
+    class FUI_TreeView : public FUI_Element
+    {
+    private:
+        enum class LoadState
         {
-            olc::vf2d temp_pos = { position.x + size.x - (size.x / 10), position.y };
-            olc::vf2d temp_size = { size.x / 10, top_border_thickness };
-            switch (state)
-            {
-            case button_state::NORMAL:
-                pge->FillRectDecal(temp_pos, temp_size, color_scheme.exit_button_normal);
-                break;
-            case button_state::HOVER:
-                pge->FillRectDecal(temp_pos, temp_size, color_scheme.exit_button_hover);
-                break;
-            case button_state::CLICK:
-                pge->FillRectDecal(temp_pos, temp_size, color_scheme.exit_button_click);
-                break;
-            }
-            olc::vf2d close_position = olc::vf2d{ temp_pos.x + (temp_size.x / 2) - (pge->GetTextSizeProp("X").x / 2), temp_pos.y + (top_border_thickness / 2) - (pge->GetTextSizeProp("X").y / 2) };
-            pge->DrawStringPropDecal(close_position, "X", color_scheme.exit_button_text);
-        }
+            NOT_LOADED = 0,
+            LOADING,
+            LOADED
+        };
 
+        struct Node
+        {
+            FUI_TreeItem item;
+            int depth = 0;
+            bool expanded = false;
+            LoadState load_state = LoadState::NOT_LOADED;
+            // children are stored contiguously in nodes once loaded
+            int first_child = 0;
+            int child_count = 0;
+        };
 
-        // Override top border with a darker color when window is inactive 
-        if (!focused)
-            pge->FillRectDecal(position, olc::vf2d{ size.x, top_border_thickness }, { 100, 100, 100, 150 }); // Top bar
-    }
+        // a visible row is either a node or the "loading" placeholder of a node
+        struct Row
+        {
+            int node = 0;
+            bool placeholder = false;
+        };
 
-    void FUI_Window::input(std::deque<FUI_Window*> windows)
-    {
-        overlapping_window = nullptr;
-        for (auto& window : windows)
+        struct PendingLoad
         {
-            if (window->get_closed_state())
-                continue;
-            if (window->get_id() != identifier)
-            {
-                if (window->is_focused())
-                {
-                    if (position.x + size.x > window->get_position().x&& position.x < window->get_position().x + window->get_size().x &&
-                        position.y + size.y > window->get_position().y&& position.y < window->get_position().y + window->get_size().y)
-                    {
-                        overlapping_window = window;
-                        break;
-                    }
-                }
-            }
-        }
+            int node = 0;
+            std::future<std::vector<FUI_TreeItem>> children;
+        };
 
-        olc::vi2d new_window_position = position;
+        std::vector<Node> nodes;
+        std::vector<int> roots;
+        // only expanded nodes are flattened in here, expand / collapse splice ranges in and out
+        std::vector<Row> rows;
+        std::vector<PendingLoad> pending_loads;
 
-        // input on default close button
-        if (!disable_exit)
-        {
-            if ((pge->GetMousePos().x >= position.x + size.x - (size.x / 10) && pge->GetMousePos().x <= position.x + size.x &&
-                pge->GetMousePos().y >= position.y && pge->GetMousePos().y <= position.y + top_border_thickness))
-            {
-                if (pge->GetMouse(0).bHeld || pge->GetMouse(0).bPressed || pge->GetMouse(0).bReleased)
-                {
-                    if (pge->GetMouse(0).bReleased && focused)
-                        close_window(true);
-                    state = button_state::CLICK;
-                }
-                else
-                    state = button_state::HOVER;
-            }
-            else
-                state = button_state::NORMAL;
-        }
+        std::function<void(const FUI_TreeItem& parent, std::vector<FUI_TreeItem>& children)> children_provider;
+        bool async_provider = false;
 
-        // dragging related
-        if (!disable_drag)
-        {
-            if ((pge->GetMousePos().x >= position.x && pge->GetMousePos().x <= position.x + size.x - (size.x / 10) &&
-                pge->GetMousePos().y >= position.y && pge->GetMousePos().y <= position.y + top_border_thickness) || is_dragging)
-            {
-                if (pge->GetMouse(0).bPressed)
-                {
-                    is_dragging = true;
-                    mouse_difference = pge->GetMousePos() - position;
-                }
+        float row_height = 12.f;
+        float indent = 10.f;
+        int first_row = 0;
+        int hovered_row = -1;
+        int selected_node = -1;
 
-                if (pge->GetMouse(0).bHeld && is_dragging && focused)
-                    new_window_position = pge->GetMousePos() - mouse_difference;
+        std::string placeholder_text = "Loading...";
 
+        void load_children(int node, std::vector<FUI_TreeItem>& children);
 
-                position = new_window_position;
-            }
+        void collect_visible(int node, std::vector<Row>& out);
 
-            if (pge->GetMouse(0).bReleased)
-                is_dragging = false;
-        }
-        // focusing system related
-        if (overlapping_window)
-        {
-            if (!((pge->GetMousePos().x >= overlapping_window->get_position().x && pge->GetMousePos().x <= overlapping_window->get_position().x + overlapping_window->get_size().x &&
-                pge->GetMousePos().y >= overlapping_window->get_position().y && pge->GetMousePos().y <= overlapping_window->get_position().y + overlapping_window->get_size().y) &&
-                pge->GetMouse(0).bPressed))
-            {
-                if ((pge->GetMousePos().x >= position.x && pge->GetMousePos().x <= position.x + size.x &&
-                    pge->GetMousePos().y >= position.y && pge->GetMousePos().y <= position.y + size.y) && pge->GetMouse(0).bPressed)
-                {
-                    overlapping_window->set_focused(false);
-                    focused = true;
-                }
-                else if (pge->GetMouse(0).bPressed)
-                    focused = false;
-            }
-        }
-        else
-        {
-            if ((pge->GetMousePos().x >= position.x && pge->GetMousePos().x <= position.x + size.x &&
-                pge->GetMousePos().y >= position.y && pge->GetMousePos().y <= position.y + size.y) && pge->GetMouse(0).bPressed)
-            {
-                focused = true;
-            }
-            else if (pge->GetMouse(0).bPressed)
-                focused = false;
-        }
-    }
+        const int get_row_depth(const Row& row);
 
-    /*
-    ####################################################
-    #               FUI_ELEMENT START                  #
-    ####################################################
-    */
-    const std::string FUI_Element::get_identifier()
-    {
-        return identifier;
-    }
+        const int get_rows_in_view();
 
-    const int FUI_Element::get_elements_amount()
-    {
-        if (ui_type == FUI_Type::DROPDOWN || ui_type == FUI_Type::COMBOLIST)
-            return elements.size();
-        else
-            std::cout << "Trying to get element amount on incorrect UI_TYPE\n";
-        return -1;
-    }
+        // true when children finished loading
+        bool poll_pending_loads();
 
-    const bool FUI_Element::get_focused_status()
-    {
-        return is_focused;
-    }
+        void scroll_rows(int amount);
+    public:
+        FUI_TreeView(const std::string& id, FUI_Window* parent, olc::vi2d position, olc::vi2d size);
+        FUI_TreeView(const std::string& id, FUI_Window* parent, const std::string& group, olc::vi2d position, olc::vi2d size);
+        FUI_TreeView(const std::string& id, const std::string& group, olc::vi2d position, olc::vi2d size);
+        FUI_TreeView(const std::string& id, olc::vi2d position, olc::vi2d size);
 
-    void FUI_Element::set_focused_status(bool status)
-    {
-        is_focused = status;
-    }
+        // called the first time a node is expanded, async providers run on a worker thread and show a placeholder row meanwhile
+        void set_children_provider(std::function<void(const FUI_TreeItem& parent, std::vector<FUI_TreeItem>& children)> provider, bool async = false);
 
-    FUI_Window* FUI_Element::get_parent()
-    {
-        return parent;
-    }
+        void add_root(const FUI_TreeItem& item);
 
-    const FUI_Type FUI_Element::get_ui_type()
-    {
-        return ui_type;
-    }
+        void clear();
 
-    const olc::vf2d FUI_Element::get_size()
-    {
-        return size;
-    }
+        void expand_row(int row);
 
-    void FUI_Element::set_size(olc::vi2d s)
-    {
-        size = s;
-    }
+        void collapse_row(int row);
 
-    void FUI_Element::set_position(olc::vf2d p)
-    {
-        position = p;
-    }
+        void toggle_row(int row);
 
-    void FUI_Element::set_text(const std::string& txt)
-    {
-        text = txt;
-    }
+        const int get_visible_row_count();
 
-    void FUI_Element::set_text_color(olc::Pixel color)
-    {
-        text_color = color;
-    }
+        void set_row_height(float height);
 
-    const std::string FUI_Element::get_group()
-    {
-        return group;
-    }
+        void set_indent(float width);
 
-    void FUI_Element::scale_text(olc::vf2d scale)
-    {
-        text_scale = scale;
-    }
+        // returns nullptr if nothing is selected, the pointer is invalidated when more children get loaded
+        const FUI_TreeItem* get_selected_item();
 
-    void FUI_Element::inputfield_scale(olc::vf2d scale)
-    {
-        if (ui_type == FUI_Type::INPUTFIELD)
-            input_scale = scale;
-        else
-            std::cout << "Trying to use inputfield_scale on incorrect UI_TYPE\n";
-    }
+        bool update(olc::PixelGameEngine* pge) override;
 
-    const bool FUI_Element::get_button_state()
-    {
-        if (ui_type == FUI_Type::BUTTON && toggleable)
-        {
-            return button_state;
-        }
-        else
-            std::cout << "Trying to get_button_state on incorrect UI_TYPE or button is not toggleable\n";
+        void draw(olc::PixelGameEngine* pge) override;
 
-        return false;
-    }
+        const double get_next_change() override { return pending_loads.empty() ? FUI_Element::get_next_change() : frame->time; }
 
-    void FUI_Element::make_toggleable(bool default_state)
+        void input(olc::PixelGameEngine* pge) override;
+    };
+
+    // Fixed capacity ring buffer of samples for FUI_Plot. push() is lock free and may be called from
+    // one producer thread per series while the UI thread draws, use a series per producer thread.
+    // Samples are relaxed atomics, the plot checks write_index again after reading and drops what got lapped.
+    class FUI_PlotSeries
     {
-        if (ui_type == FUI_Type::BUTTON)
+        friend class FUI_Plot;
+    private:
+        static constexpr uint64_t block_size = 64;
+
+        std::unique_ptr<std::atomic<float>[]> samples;
+        uint64_t capacity = 0;
+        uint64_t mask = 0;
+        std::atomic<uint64_t> write_index{ 0 };
+
+        // min / max of every complete block of 64 samples as a binary tree over the ring's blocks (leaves from
+        // block_count on, node i covers its children 2i and 2i + 1), any run of blocks takes O(log blocks) nodes.
+        // Only touched by the UI thread
+        uint64_t block_count = 0;
+        std::vector<float> tree_min;
+        std::vector<float> tree_max;
+        uint64_t summarized = 0;
+        // write index the plot last drew
+        uint64_t drawn_index = 0;
+
+        std::string name;
+        olc::Pixel color;
+
+        void update_summaries(uint64_t end);
+
+        void set_block(uint64_t block, float min, float max);
+
+        // min / max of the blocks [from, to) of the ring, to <= block_count
+        void get_block_min_max(uint64_t from, uint64_t to, float& min, float& max);
+
+        void get_min_max(uint64_t begin, uint64_t end, uint64_t summarized_end, float& min, float& max);
+
+        // min / max of samples that don't straddle the ring boundary
+        void load_min_max(uint64_t start, uint64_t count, float& min, float& max);
+    public:
+        FUI_PlotSeries(const std::string& name, olc::Pixel color, size_t capacity);
+
+        void push(float value)
         {
-            toggleable = true;
-            button_state = default_state;
+            uint64_t index = write_index.load(std::memory_order_relaxed);
+            samples[index & mask].store(value, std::memory_order_relaxed);
+            write_index.store(index + 1, std::memory_order_release);
         }
-        else
-            std::cout << "Trying to make_toggleable on incorrect UI_TYPE\n";
-    }
 
-    void FUI_Element::add_item(const std::string& item, olc::vf2d scale = { 1.0f, 1.0f })
-    {
-        if (ui_type == FUI_Type::DROPDOWN || ui_type == FUI_Type::COMBOLIST)
-            elements.emplace_back(std::make_pair(elements.size(), std::make_pair(DropdownState::NONE, std::make_pair(scale, item))));
-        else
-            std::cout << "Trying to add_item to wrong UI_TYPE\n";
-    }
+        const size_t get_capacity();
 
-    void FUI_Element::set_animation_speed(float speed)
-    {
-        if (ui_type == FUI_Type::DROPDOWN || ui_type == FUI_Type::COMBOLIST)
-            animation_speed = speed;
-        else
-            std::cout << "Trying to set_animation_speed on wrong UI_TYPE\n";
-    }
+        const std::string& get_name();
+    };
 
-    const int FUI_Element::get_selected_item()
+    class FUI_Plot : public FUI_Element
     {
-        if (ui_type == FUI_Type::DROPDOWN)
-            return selected_element.first;
-        else std::cout << "Trying to get_selected_item on wrong UI_TYPE\n";
+    private:
+        std::vector<std::unique_ptr<FUI_PlotSeries>> series;
 
-        return -1;
-    }
+        // per pixel column min / max of every series, reused between frames
+        std::vector<float> column_min;
+        std::vector<float> column_max;
 
-    void FUI_Element::set_default_item(const int& item)
+        size_t visible_samples = 0;
+        bool auto_range = true;
+        olc::vf2d value_range = { 0.f, 1.f };
+
+        FUI_NumberText range_max_text;
+        FUI_NumberText range_min_text;
+    public:
+        FUI_Plot(const std::string& id, FUI_Window* parent, const std::string& text, olc::vi2d position, olc::vi2d size);
+        FUI_Plot(const std::string& id, FUI_Window* parent, const std::string& group, const std::string& text, olc::vi2d position, olc::vi2d size);
+        FUI_Plot(const std::string& id, const std::string& group, const std::string& text, olc::vi2d position, olc::vi2d size);
+        FUI_Plot(const std::string& id, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        // capacity is rounded up to a power of two, the returned series stays valid for the lifetime of the plot
+        FUI_PlotSeries* add_series(const std::string& name, olc::Pixel color, size_t capacity);
+
+        // amount of most recent samples spread over the plot width, 0 shows the whole buffer
+        void set_visible_samples(size_t amount);
+
+        void set_range(olc::vf2d range);
+
+        void set_auto_range(bool state);
+
+        void draw(olc::PixelGameEngine* pge) override;
+
+        const double get_next_change() override;
+    };
+
+    // Displays a 2D float grid through a colormap. The grid is split into tiles with their own decal so only
+    // tiles that changed are uploaded again, panning and zooming only changes the decal source rects.
+    class FUI_Canvas : public FUI_Element
     {
-        if (ui_type == FUI_Type::DROPDOWN)
+    private:
+        static constexpr int tile_size = 64;
+
+        struct Tile
         {
-            if (item > elements.size() - 1)
-                std::cout << "Trying to set a invalid default item (" << item << ")\n";
-            else
-            {
-                for (auto& element : elements)
-                {
-                    if (element.first == item)
+            std::unique_ptr<olc::Sprite> sprite;
+            std::unique_ptr<olc::Decal> decal;
+            bool dirty = true;
+        };
+
+        olc::vi2d grid_size = { 0, 0 };
+        olc::vi2d tile_count = { 0, 0 };
+        std::vector<float> values;
+        std::vector<Tile> tiles;
+        // values written since the last update, shown at the render rate instead of forcing a redraw
+        bool values_changed = false;
+
+        std::array<olc::Pixel, 256> colormap;
+        olc::vf2d value_range = { 0.f, 1.f };
+
+        // top left visible cell and screen pixels per cell
+        olc::vf2d view_offset = { 0.f, 0.f };
+        float zoom = 1.f;
+        bool panning = false;
+        olc::vf2d pan_start = { 0.f, 0.f };
+
+        void mark_dirty(olc::vi2d cell_position, olc::vi2d cell_size);
+
+        void update_tile(int tile_x, int tile_y);
+    public:
+        FUI_Canvas(const std::string& id, FUI_Window* parent, olc::vi2d position, olc::vi2d size);
+        FUI_Canvas(const std::string& id, FUI_Window* parent, const std::string& group, olc::vi2d position, olc::vi2d size);
+        FUI_Canvas(const std::string& id, const std::string& group, olc::vi2d position, olc::vi2d size);
+        FUI_Canvas(const std::string& id, olc::vi2d position, olc::vi2d size);
+
+        // reallocates the grid, clears it and fits it into the view
+        void set_grid_size(olc::vi2d grid_size);
+
+        const olc::vi2d get_grid_size();
+
+        // copies a full grid, only tiles whose values changed are uploaded again
+        void set_values(const float* values);
+
+        // copies a region of cells, stride is the amount of floats between rows of the source
+        void set_region(olc::vi2d cell_position, olc::vi2d cell_size, const float* values, int stride);
+
+        void set_value(olc::vi2d cell, float value);
+
+        const float get_value(olc::vi2d cell);
+
+        // colors are spread evenly over the value range and interpolated into a 256 entry table
+        void set_colormap(const std::vector<olc::Pixel>& stops);
+
+        void set_value_range(olc::vf2d range);
+
+        void set_view(olc::vf2d offset, float zoom);
+
+        void fit_view();
+
+        // cell under the mouse or { -1, -1 }
+        const olc::vi2d get_hovered_cell(olc::PixelGameEngine* pge);
+
+        bool update(olc::PixelGameEngine* pge) override;
+
+        void input(olc::PixelGameEngine* pge) override;
+
+        void draw(olc::PixelGameEngine* pge) override;
+    };
+
+    // Read only mapping of a whole file, pages are only loaded by the OS once they're looked at
+    class FUI_MappedFile
+    {
+    private:
+        const char* data = nullptr;
+        uint64_t length = 0;
+        bool opened = false;
+#if defined(_WIN32)
+        HANDLE file_handle = INVALID_HANDLE_VALUE;
+        HANDLE mapping_handle = nullptr;
+#endif
+    public:
+        FUI_MappedFile() = default;
+        FUI_MappedFile(const FUI_MappedFile&) = delete;
+        FUI_MappedFile& operator=(const FUI_MappedFile&) = delete;
+        ~FUI_MappedFile();
+
+        bool open(const std::string& path);
+
+        void close();
+
+        // hint that a range won't be needed soon, its pages are read back from the file if touched again
+        void release(uint64_t offset, uint64_t size);
+
+        const char* get_data() const { return data; }
+
+        const uint64_t get_size() const { return length; }
+
+        const bool is_open() const { return opened; }
+    };
+
+    // Viewer for files too large to load, rows are drawn straight from the mapping. In text mode a sparse
+    // line index (every 256th line) is built on a background thread, hex mode needs no index at all.
+    class FUI_FileView : public FUI_Element
+    {
+    public:
+        enum class Mode
+        {
+            TEXT = 0,
+            HEX
+        };
+    private:
+        static constexpr uint64_t checkpoint_interval = 256;
+        // longer lines are wrapped so finding a row never scans more than this
+        static constexpr uint64_t max_line_length = 4096;
+        static constexpr int bytes_per_row = 16;
+
+        FUI_MappedFile file;
+        Mode mode = Mode::TEXT;
+
+        std::vector<uint64_t> checkpoints;
+        std::mutex checkpoint_mutex;
+        std::atomic<uint64_t> indexed_lines{ 0 };
+        std::atomic<bool> indexing{ false };
+        std::atomic<bool> cancel_indexing{ false };
+        std::thread index_thread;
+
+        int64_t first_row = 0;
+        int first_column = 0;
+        float row_height = 10.f;
+
+        // every drawn row is built in here so drawing doesn't allocate
+        std::string scratch;
+
+        const uint64_t next_line(uint64_t offset);
+
+        void build_index();
+
+        void stop_indexing();
+
+        const uint64_t get_line_offset(uint64_t line);
+
+        void scroll_rows(int64_t amount);
+
+        void draw_text(olc::PixelGameEngine* pge, int rows_in_view);
+
+        void draw_hex(olc::PixelGameEngine* pge, int rows_in_view);
+    public:
+        FUI_FileView(const std::string& id, FUI_Window* parent, olc::vi2d position, olc::vi2d size);
+        FUI_FileView(const std::string& id, FUI_Window* parent, const std::string& group, olc::vi2d position, olc::vi2d size);
+        FUI_FileView(const std::string& id, const std::string& group, olc::vi2d position, olc::vi2d size);
+        FUI_FileView(const std::string& id, olc::vi2d position, olc::vi2d size);
+        ~FUI_FileView();
+
+        bool open(const std::string& path);
+
+        void close();
+
+        void set_mode(Mode mode);
+
+        const Mode get_mode();
+
+        // in text mode this grows while the index is still being built
+        const uint64_t get_row_count();
+
+        const bool is_indexing();
+
+        void scroll_to_row(int64_t row);
+
+        const int64_t get_first_row();
+
+        void set_row_height(float height);
+
+        void input(olc::PixelGameEngine* pge) override;
+
+        void draw(olc::PixelGameEngine* pge) override;
+
+        const double get_next_change() override { return indexing ? frame->time : FUI_Element::get_next_change(); }
+    };
+
+    // Follows a file as it grows like tail -f. On linux changes are picked up through inotify, elsewhere the
+    // file size is polled. Appended bytes are read in bounded chunks every frame and the oldest lines are
+    // evicted once the line or byte limit is reached.
+    class FUI_LogTail : public FUI_Element
+    {
+    private:
+        // longer lines are wrapped
+        static constexpr uint64_t max_line_length = 4096;
+
+        std::string path;
+        std::ifstream stream;
+        uint64_t read_offset = 0;
+        bool pending = false;
+        bool skip_partial = false;
+        bool reopen = false;
+
+        std::vector<char> read_buffer;
+        size_t read_chunk = 4 << 20;
+
+        std::chrono::steady_clock::time_point next_poll;
+        std::chrono::milliseconds poll_interval{ 250 };
+
+#if defined(__linux__)
+        int notify_descriptor = -1;
+        int watch_descriptor = -1;
+#endif
+
+        // retained text, buffer[0] is at stream offset buffer_start
+        std::string buffer;
+        uint64_t buffer_start = 0;
+        // stream offset of every retained line, the last one may still be incomplete
+        std::deque<uint64_t> line_starts;
+        uint64_t first_line_number = 0;
+
+        size_t max_lines = 100000;
+        size_t max_bytes = 16 << 20;
+
+        int64_t first_row = 0;
+        float row_height = 10.f;
+        bool auto_scroll = true;
+
+        std::string scratch;
+
+        bool open_stream(bool from_end);
+
+        void close_watch();
+
+        void clear_lines();
+
+        void append(const char* data, size_t length);
+
+        void evict();
+
+        // true when lines were read or dropped
+        bool update_tail();
+
+        void scroll_rows(int64_t amount);
+    public:
+        FUI_LogTail(const std::string& id, FUI_Window* parent, olc::vi2d position, olc::vi2d size);
+        FUI_LogTail(const std::string& id, FUI_Window* parent, const std::string& group, olc::vi2d position, olc::vi2d size);
+        FUI_LogTail(const std::string& id, const std::string& group, olc::vi2d position, olc::vi2d size);
+        FUI_LogTail(const std::string& id, olc::vi2d position, olc::vi2d size);
+        ~FUI_LogTail();
+
+        // from_end starts with the last few KB of the file instead of all of it
+        bool open(const std::string& path, bool from_end = true);
+
+        void close();
+
+        void set_limits(size_t max_lines, size_t max_bytes);
+
+        // upper bound of bytes read per frame
+        void set_read_chunk(size_t bytes);
+
+        // only used when inotify isn't available
+        void set_poll_interval(std::chrono::milliseconds interval);
+
+        void set_auto_scroll(bool state);
+
+        const bool get_auto_scroll();
+
+        const size_t get_line_count();
+
+        // lines seen since opening, including evicted ones
+        const uint64_t get_total_lines();
+
+        void set_row_height(float height);
+
+        bool update(olc::PixelGameEngine* pge) override;
+
+        void input(olc::PixelGameEngine* pge) override;
+
+        void draw(olc::PixelGameEngine* pge) override;
+
+        const double get_next_change() override;
+    };
+
+    struct FUI_TimelineSpan
+    {
+        double start = 0.0;
+        double end = 0.0;
+        std::string name;
+        olc::Pixel color = olc::GREY;
+        uint64_t user_id = 0;
+        // label width is measured once, the first time the span is wide enough to hold it
+        float label_width = -1.f;
+    };
+
+    // Flame graph / timeline of spans grouped by depth. Each depth keeps its spans sorted by start together with
+    // a running maximum of their ends, so the visible ones are found with a binary search. Spans narrower than a
+    // pixel are merged into aggregate blocks, which keeps the cost of a frame tied to the width of the widget.
+    class FUI_Timeline : public FUI_Element
+    {
+    private:
+        struct Lane
+        {
+            std::vector<FUI_TimelineSpan> spans;
+            std::vector<double> max_end;
+            bool sorted = true;
+        };
+
+        std::vector<Lane> lanes;
+
+        double view_start = 0.0;
+        double view_duration = 1.0;
+        float view_y = 0.f;
+        float row_height = 14.f;
+        float ruler_height = 12.f;
+
+        bool panning = false;
+        olc::vf2d pan_mouse = { 0.f, 0.f };
+        double pan_start = 0.0;
+        float pan_y = 0.f;
+
+        const FUI_TimelineSpan* hovered_span = nullptr;
+        // spans added since the last update, shown at the render rate instead of forcing a redraw
+        bool spans_added = false;
+
+        void prepare_lane(Lane& lane);
+
+        // index of the first span that could still overlap time
+        const size_t first_overlap(Lane& lane, double time);
+
+        const FUI_TimelineSpan* find_span(olc::vf2d mouse);
+
+        void draw_ruler(olc::PixelGameEngine* pge);
+    public:
+        FUI_Timeline(const std::string& id, FUI_Window* parent, olc::vi2d position, olc::vi2d size);
+        FUI_Timeline(const std::string& id, FUI_Window* parent, const std::string& group, olc::vi2d position, olc::vi2d size);
+        FUI_Timeline(const std::string& id, const std::string& group, olc::vi2d position, olc::vi2d size);
+        FUI_Timeline(const std::string& id, olc::vi2d position, olc::vi2d size);
+
+        void add_span(int depth, double start, double end, const std::string& name, olc::Pixel color, uint64_t user_id = 0);
+
+        void clear();
+
+        void set_view(double start, double duration);
+
+        // zooms out to show every span
+        void fit_view();
+
+        const double get_view_start();
+
+        const double get_view_duration();
+
+        void set_row_height(float height);
+
+        // span under the mouse, merged blocks can't be hovered
+        const FUI_TimelineSpan* get_hovered_span();
+
+        bool update(olc::PixelGameEngine* pge) override;
+
+        void input(olc::PixelGameEngine* pge) override;
+
+        void draw(olc::PixelGameEngine* pge) override;
+    };
+
+    // A node of FUI_NodeGraph. Elements added to it are placed relative to its body and are drawn and
+    // updated by the graph, the same way FUI_ScrollView hosts its children.
+    class FUI_GraphNode : public FUI_Element
+    {
+        friend class FUI_NodeGraph;
+    private:
+        std::vector<std::shared_ptr<FUI_Element>> children;
+        int input_count = 0;
+        int output_count = 0;
+
+        // bumped on every move, links compare it to know when to re-tessellate
+        uint64_t version = 0;
+        uint64_t z_order = 0;
+        uint64_t visit_stamp = 0;
+        olc::vi2d cell_min = { 0, 0 };
+        olc::vi2d cell_max = { -1, -1 };
+
+        float title_height = 12.f;
+        float pin_spacing = 14.f;
+    public:
+        FUI_GraphNode(const std::string& id, const std::string& title, olc::vf2d position, olc::vf2d size, int inputs, int outputs);
+        ~FUI_GraphNode();
+
+        void add_child(std::shared_ptr<FUI_Element> child);
+
+        void remove_child(FUI_Element* child) override;
+
+        const olc::vf2d get_content_position() override;
+
+        const int get_input_count();
+
+        const int get_output_count();
+
+        // pin positions relative to the origin of the graph
+        const olc::vf2d get_input_position(int slot);
+
+        const olc::vf2d get_output_position(int slot);
+    };
+
+    struct FUI_GraphLink
+    {
+        FUI_GraphNode* from = nullptr;
+        int from_slot = 0;
+        FUI_GraphNode* to = nullptr;
+        int to_slot = 0;
+    };
+
+    // Node editor. Nodes and links are kept in a uniform grid so drawing and hit testing only look at what's
+    // near the view or the mouse. Links are tessellated into a polyline in graph space, so panning never
+    // touches them and they're only rebuilt when one of their nodes moved.
+    class FUI_NodeGraph : public FUI_Element
+    {
+    private:
+        struct Link
+        {
+            FUI_GraphLink link;
+            uint64_t from_version = ~0ull;
+            uint64_t to_version = ~0ull;
+            std::vector<olc::vf2d> points;
+            olc::vf2d bounds_min = { 0.f, 0.f };
+            olc::vf2d bounds_max = { 0.f, 0.f };
+            olc::vi2d cell_min = { 0, 0 };
+            olc::vi2d cell_max = { -1, -1 };
+            bool large = false;
+            uint64_t visit_stamp = 0;
+        };
+
+        struct Cell
+        {
+            std::vector<FUI_GraphNode*> nodes;
+            std::vector<Link*> links;
+        };
+
+        static constexpr float cell_size = 256.f;
+        // links covering more cells than this are tested on their own instead of being put in the grid
+        static constexpr int max_link_cells = 64;
+
+        std::vector<std::unique_ptr<FUI_GraphNode>> nodes;
+        std::unordered_map<std::string, FUI_GraphNode*> node_lookup;
+        std::vector<std::unique_ptr<Link>> links;
+        std::unordered_map<FUI_GraphNode*, std::vector<Link*>> node_links;
+        std::vector<Link*> large_links;
+        std::vector<Link*> dirty_links;
+        std::unordered_map<uint64_t, Cell> grid;
+
+        uint64_t z_counter = 0;
+        uint64_t visit_counter = 0;
+        std::vector<FUI_GraphNode*> visible_nodes;
+        std::vector<Link*> visible_links;
+
+        olc::vf2d pan = { 0.f, 0.f };
+
+        enum class Drag
+        {
+            NONE = 0,
+            PAN,
+            NODE,
+            LINK
+        };
+        Drag drag = Drag::NONE;
+        olc::vf2d drag_mouse = { 0.f, 0.f };
+        olc::vf2d drag_origin = { 0.f, 0.f };
+        FUI_GraphNode* drag_node = nullptr;
+        int drag_slot = 0;
+
+        float pin_radius = 4.f;
+
+        static uint64_t cell_key(int x, int y);
+
+        const olc::vi2d to_cell(olc::vf2d point);
+
+        void grid_insert(FUI_GraphNode* node);
+
+        void grid_remove(FUI_GraphNode* node);
+
+        void grid_insert(Link* link);
+
+        void grid_remove(Link* link);
+
+        void tessellate(Link* link);
+
+        void remove_link(Link* link);
+
+        void update_visible();
+
+        FUI_GraphNode* node_at(olc::vf2d point);
+
+        // pin under point, slot is set to the pin index
+        FUI_GraphNode* pin_at(olc::vf2d point, bool outputs, int& slot);
+
+        void draw_node(olc::PixelGameEngine* pge, FUI_GraphNode* node, olc::vf2d view_min, olc::vf2d view_max);
+    public:
+        FUI_NodeGraph(const std::string& id, FUI_Window* parent, olc::vi2d position, olc::vi2d size);
+        FUI_NodeGraph(const std::string& id, FUI_Window* parent, const std::string& group, olc::vi2d position, olc::vi2d size);
+        FUI_NodeGraph(const std::string& id, const std::string& group, olc::vi2d position, olc::vi2d size);
+        FUI_NodeGraph(const std::string& id, olc::vi2d position, olc::vi2d size);
+
+        FUI_GraphNode* add_node(const std::string& id, const std::string& title, olc::vf2d position, olc::vf2d size, int inputs, int outputs);
+
+        void remove_node(const std::string& id);
+
+        FUI_GraphNode* get_node(const std::string& id);
+
+        void move_node(const std::string& id, olc::vf2d position);
+
+        // an input takes a single link, connecting it again replaces the old one
+        bool connect(const std::string& from_id, int from_slot, const std::string& to_id, int to_slot);
+
+        void disconnect(const std::string& to_id, int to_slot);
+
+        const std::vector<FUI_GraphLink> get_links();
+
+        void set_pan(olc::vf2d offset);
+
+        const olc::vf2d get_pan();
+
+        const olc::vf2d get_content_position() override;
+
+        void input(olc::PixelGameEngine* pge) override;
+
+        void draw(olc::PixelGameEngine* pge) override;
+    };
+
+    // Progress from 0 to 1 that any thread can update through an atomic. The bar samples it once per frame and only
+    // rebuilds its label when the filled width changes by a pixel.
+    class FUI_ProgressBar : public FUI_Element
+    {
+    private:
+        std::atomic<float> progress{ 0.f };
+        const std::atomic<float>* progress_source = &progress;
+        const std::atomic<uint64_t>* count_source = nullptr;
+        uint64_t count_total = 0;
+
+        int filled_width = -1;
+        bool show_label = true;
+        FUI_NumberText label = FUI_NumberText("", "%");
+        olc::vf2d label_size = { 0.f, 0.f };
+        olc::vf2d label_scale = { 0.f, 0.f };
+        // title size is measured again only when the text or text_scale changes
+        std::string measured_title;
+        olc::vf2d title_size = { 0.f, 0.f };
+        olc::vf2d title_scale = { 0.f, 0.f };
+    public:
+        FUI_ProgressBar(const std::string& id, FUI_Window* parent, const std::string& text, olc::vi2d position, olc::vi2d size);
+        FUI_ProgressBar(const std::string& id, FUI_Window* parent, const std::string& group, const std::string& text, olc::vi2d position, olc::vi2d size);
+        FUI_ProgressBar(const std::string& id, const std::string& group, const std::string& text, olc::vi2d position, olc::vi2d size);
+        FUI_ProgressBar(const std::string& id, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        // thread safe
+        void set_progress(float value);
+
+        const float get_progress();
+
+        // reads an atomic owned by the producer instead (0 to 1), it has to outlive the bar
+        void set_source(const std::atomic<float>* source);
+
+        // progress is done / total
+        void set_source(const std::atomic<uint64_t>* done, uint64_t total);
+
+        void show_percentage(bool state);
+
+        // the progress is read and quantized to pixels here, drawn or not
+        bool update(olc::PixelGameEngine* pge) override;
+
+        void draw(olc::PixelGameEngine* pge) override;
+    };
+
+    // Activity indicator, a ring of dots that spins while its atomic flag is set (from any thread)
+    class FUI_Spinner : public FUI_Element
+    {
+    private:
+        std::atomic<bool> active{ true };
+        const std::atomic<bool>* active_source = &active;
+        // the source as read by update, draw and get_next_change don't touch the atomic again
+        bool spinning = false;
+
+        std::array<olc::vf2d, 8> dot_offsets;
+        olc::vf2d dot_layout_size = { 0.f, 0.f };
+        float dot_size = 2.f;
+        // steps per second
+        float speed = 10.f;
+
+        void layout_dots();
+    public:
+        FUI_Spinner(const std::string& id, FUI_Window* parent, const std::string& text, olc::vi2d position, olc::vi2d size);
+        FUI_Spinner(const std::string& id, FUI_Window* parent, const std::string& group, const std::string& text, olc::vi2d position, olc::vi2d size);
+        FUI_Spinner(const std::string& id, const std::string& group, const std::string& text, olc::vi2d position, olc::vi2d size);
+        FUI_Spinner(const std::string& id, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        // thread safe
+        void set_active(bool state);
+
+        const bool is_active();
+
+        // reads an atomic owned by the producer instead, it has to outlive the spinner
+        void set_source(const std::atomic<bool>* source);
+
+        void set_speed(float steps_per_second);
+
+        bool update(olc::PixelGameEngine* pge) override;
+
+        void draw(olc::PixelGameEngine* pge) override;
+
+        const double get_next_change() override;
+    };
+
+    // Keeps a widget value and application storage in step. User changes win and are written to the storage
+    // (on_change runs with the other events after the input pass), otherwise a change of the storage is pushed
+    // into the widget. Plain pointers and getters are compared with the last synced value, FUI_Value only by its
+    // version. The storage has to outlive the binding (or be unbound first).
+    template<typename T>
+    class FUI_Binding : public FUI_BindingBase
+    {
+    public:
+        using Writer = void(*)(FUI_Element* element, const T& value);
+    private:
+        FUI_Element* element;
+        const T* widget_value;
+        Writer write_widget;
+
+        T* storage = nullptr;
+        FUI_Value<T>* versioned = nullptr;
+        std::function<T()> getter;
+        std::function<void(const T&)> setter;
+        std::function<void(const T&)> on_change;
+
+        T synced{};
+        uint64_t synced_version = 0;
+        // value written back to the application that on_change hasn't seen yet
+        T reported{};
+        bool reporting = false;
+        // some widgets apply a written value in their own update, don't mistake the old value for user input
+        bool pending = false;
+
+        void write(const T& value)
+        {
+            write_widget(element, value);
+            pending = true;
+            element->request_redraw();
+        }
+    public:
+        FUI_Binding(FUI_Element* e, const T* value, Writer writer, std::function<void(const T&)> cb)
+            : element(e), widget_value(value), write_widget(writer), on_change(std::move(cb)) {}
+
+        void set_source(T* s) { storage = s; synced = *s; write(synced); }
+
+        void set_source(FUI_Value<T>* v) { versioned = v; synced = v->get(); synced_version = v->get_version(); write(synced); }
+
+        void set_source(std::function<T()> get, std::function<void(const T&)> set) { getter = std::move(get); setter = std::move(set); synced = getter(); write(synced); }
+
+        bool sync() override
+        {
+            if (pending)
+                pending = false;
+            else if (*widget_value != synced)
+            {
+                synced = *widget_value;
+                if (storage)
+                    *storage = synced;
+                else if (versioned)
+                {
+                    versioned->set(synced);
+                    synced_version = versioned->get_version();
+                }
+                else if (setter)
+                    setter(synced);
+
+                // on_change may add or remove elements, it can't run while FrostUI walks them
+                if (!on_change)
+                    return false;
+                reported = synced;
+                reporting = true;
+                return true;
+            }
+
+            if (storage)
+            {
+                if (*storage != synced)
+                {
+                    synced = *storage;
+                    write(synced);
+                }
+            }
+            else if (versioned)
+            {
+                if (versioned->get_version() != synced_version)
+                {
+                    synced_version = versioned->get_version();
+                    if (versioned->get() != synced)
+                    {
+                        synced = versioned->get();
+                        write(synced);
+                    }
+                }
+            }
+            else if (getter)
+            {
+                T value = getter();
+                if (value != synced)
+                {
+                    synced = std::move(value);
+                    write(synced);
+                }
+            }
+            return false;
+        }
+
+        void notify() override
+        {
+            if (!reporting)
+                return;
+            reporting = false;
+            on_change(reported);
+        }
+    };
+
+    // Typed handles returned by the add_* functions. A handle shares ownership of its element and points straight
+    // at the value it exposes, so reading it every frame is a single load without a lookup or a type check. A
+    // failed add_* returns an empty handle, test it with operator bool before use.
+    template<typename E>
+    class FUI_Handle
+    {
+    protected:
+        std::shared_ptr<E> element;
+    public:
+        FUI_Handle() = default;
+        explicit FUI_Handle(std::shared_ptr<E> e) : element(std::move(e)) {}
+
+        E* get_element() const { return element.get(); }
+
+        E* operator->() const { return element.get(); }
+
+        explicit operator bool() const { return element != nullptr; }
+
+        // drops the binding, the widget keeps its current value
+        void unbind()
+        {
+            if (element)
+                element->binding.reset();
+        }
+    protected:
+        template<typename T, typename... Source>
+        void attach_binding(const T* widget_value, typename FUI_Binding<T>::Writer writer, std::function<void(const T&)> on_change, Source&&... source)
+        {
+            if (!element)
+            {
+                std::cout << "Tried to bind an empty handle (function affected: FUI_Handle::bind)\n";
+                return;
+            }
+            auto b = std::make_unique<FUI_Binding<T>>(element.get(), widget_value, writer, std::move(on_change));
+            b->set_source(std::forward<Source>(source)...);
+            element->binding = std::move(b);
+        }
+    };
+
+    using FUI_LabelHandle = FUI_Handle<FUI_Label>;
+    using FUI_GroupboxHandle = FUI_Handle<FUI_Groupbox>;
+    using FUI_ConsoleHandle = FUI_Handle<FUI_Console>;
+    using FUI_ScrollViewHandle = FUI_Handle<FUI_ScrollView>;
+    using FUI_TableHandle = FUI_Handle<FUI_Table>;
+    using FUI_TreeViewHandle = FUI_Handle<FUI_TreeView>;
+    using FUI_PlotHandle = FUI_Handle<FUI_Plot>;
+    using FUI_CanvasHandle = FUI_Handle<FUI_Canvas>;
+    using FUI_FileViewHandle = FUI_Handle<FUI_FileView>;
+    using FUI_LogTailHandle = FUI_Handle<FUI_LogTail>;
+    using FUI_TimelineHandle = FUI_Handle<FUI_Timeline>;
+    using FUI_NodeGraphHandle = FUI_Handle<FUI_NodeGraph>;
+    using FUI_ProgressBarHandle = FUI_Handle<FUI_ProgressBar>;
+    using FUI_SpinnerHandle = FUI_Handle<FUI_Spinner>;
+
+    class FUI_ButtonHandle : public FUI_Handle<FUI_Button>
+    {
+    private:
+        const bool* state = nullptr;
+    public:
+        FUI_ButtonHandle() = default;
+        explicit FUI_ButtonHandle(std::shared_ptr<FUI_Button> e) : FUI_Handle(std::move(e)), state(&element->button_state) {}
+
+        // toggle state, always false unless the button was made toggleable
+        bool get_state() const { return *state; }
+    };
+
+    class FUI_CheckboxHandle : public FUI_Handle<FUI_Checkbox>
+    {
+    private:
+        const bool* state = nullptr;
+    public:
+        FUI_CheckboxHandle() = default;
+        explicit FUI_CheckboxHandle(std::shared_ptr<FUI_Checkbox> e) : FUI_Handle(std::move(e)), state(&element->checkbox_state) {}
+
+        bool get_state() const { return *state; }
+
+        void set_state(bool s) { element->set_checkbox_state(s); }
+
+        // binds the state to application storage, user changes are written back and on_change is called
+        void bind(bool* storage, std::function<void(const bool&)> on_change = nullptr) { attach_binding(state, [](FUI_Element* e, const bool& v) { e->set_checkbox_state(v); }, std::move(on_change), storage); }
+
+        void bind(FUI_Value<bool>* source, std::function<void(const bool&)> on_change = nullptr) { attach_binding(state, [](FUI_Element* e, const bool& v) { e->set_checkbox_state(v); }, std::move(on_change), source); }
+
+        void bind(std::function<bool()> getter, std::function<void(const bool&)> setter, std::function<void(const bool&)> on_change = nullptr) { attach_binding(state, [](FUI_Element* e, const bool& v) { e->set_checkbox_state(v); }, std::move(on_change), std::move(getter), std::move(setter)); }
+    };
+
+    template<typename T>
+    class FUI_SliderHandle : public FUI_Handle<FUI_Slider>
+    {
+        static_assert(std::is_same<T, float>::value || std::is_same<T, int>::value, "FUI_SliderHandle is either float or int");
+    private:
+        const T* value = nullptr;
+    public:
+        FUI_SliderHandle() = default;
+        explicit FUI_SliderHandle(std::shared_ptr<FUI_Slider> e) : FUI_Handle(std::move(e))
+        {
+            if constexpr (std::is_same<T, float>::value)
+                value = &element->slider_value_float;
+            else
+                value = &element->slider_value_int;
+        }
+
+        T get_value() const { return *value; }
+
+        // clamped to the range of the slider
+        void set_value(T v) { element->set_slider_value(v); }
+
+        // binds the value, values outside the range are clamped and written back to application storage, user changes are written back and on_change is called
+        void bind(T* storage, std::function<void(const T&)> on_change = nullptr) { attach_binding(value, [](FUI_Element* e, const T& v) { e->set_slider_value(v); }, std::move(on_change), storage); }
+
+        void bind(FUI_Value<T>* source, std::function<void(const T&)> on_change = nullptr) { attach_binding(value, [](FUI_Element* e, const T& v) { e->set_slider_value(v); }, std::move(on_change), source); }
+
+        void bind(std::function<T()> getter, std::function<void(const T&)> setter, std::function<void(const T&)> on_change = nullptr) { attach_binding(value, [](FUI_Element* e, const T& v) { e->set_slider_value(v); }, std::move(on_change), std::move(getter), std::move(setter)); }
+    };
+
+    class FUI_DropdownHandle : public FUI_Handle<FUI_Dropdown>
+    {
+    private:
+        const int* selected = nullptr;
+    public:
+        FUI_DropdownHandle() = default;
+        explicit FUI_DropdownHandle(std::shared_ptr<FUI_Dropdown> e) : FUI_Handle(std::move(e)), selected(&element->selected_element.first) {}
+
+        int get_selected_item() const { return *selected; }
+
+        // binds the selected item to application storage, user changes are written back and on_change is called
+        void bind(int* storage, std::function<void(const int&)> on_change = nullptr) { attach_binding(selected, [](FUI_Element* e, const int& v) { e->set_default_item(v); }, std::move(on_change), storage); }
+
+        void bind(FUI_Value<int>* source, std::function<void(const int&)> on_change = nullptr) { attach_binding(selected, [](FUI_Element* e, const int& v) { e->set_default_item(v); }, std::move(on_change), source); }
+
+        void bind(std::function<int()> getter, std::function<void(const int&)> setter, std::function<void(const int&)> on_change = nullptr) { attach_binding(selected, [](FUI_Element* e, const int& v) { e->set_default_item(v); }, std::move(on_change), std::move(getter), std::move(setter)); }
+    };
+
+    class FUI_CombolistHandle : public FUI_Handle<FUI_Combolist>
+    {
+    private:
+        const std::vector<std::pair<int, std::pair<olc::vf2d, std::string>>>* selected = nullptr;
+    public:
+        FUI_CombolistHandle() = default;
+        explicit FUI_CombolistHandle(std::shared_ptr<FUI_Combolist> e) : FUI_Handle(std::move(e)), selected(&element->selected_elements) {}
+
+        // reads the selection in place, unlike get_selected_items this doesn't build a vector
+        size_t get_selected_count() const { return selected->size(); }
+
+        int get_selected_item(size_t index) const { return (*selected)[index].first; }
+    };
+
+    class FUI_InputfieldHandle : public FUI_Handle<FUI_Inputfield>
+    {
+    private:
+        const std::string* value = nullptr;
+    public:
+        FUI_InputfieldHandle() = default;
+        explicit FUI_InputfieldHandle(std::shared_ptr<FUI_Inputfield> e) : FUI_Handle(std::move(e)), value(&element->inputfield_text) {}
+
+        const std::string& get_value() const { return *value; }
+
+        void set_value(const std::string& v) { element->set_inputfield_value(v); }
+
+        // binds the text to application storage, user changes are written back and on_change is called
+        void bind(std::string* storage, std::function<void(const std::string&)> on_change = nullptr) { attach_binding(value, [](FUI_Element* e, const std::string& v) { if (v.empty()) e->clear_inputfield_value(); else e->set_inputfield_value(v); }, std::move(on_change), storage); }
+
+        void bind(FUI_Value<std::string>* source, std::function<void(const std::string&)> on_change = nullptr) { attach_binding(value, [](FUI_Element* e, const std::string& v) { if (v.empty()) e->clear_inputfield_value(); else e->set_inputfield_value(v); }, std::move(on_change), source); }
+
+        void bind(std::function<std::string()> getter, std::function<void(const std::string&)> setter, std::function<void(const std::string&)> on_change = nullptr) { attach_binding(value, [](FUI_Element* e, const std::string& v) { if (v.empty()) e->clear_inputfield_value(); else e->set_inputfield_value(v); }, std::move(on_change), std::move(getter), std::move(setter)); }
+    };
+
+    // Open addressing table (linear probing) from 64 bit ids to the state of immediate mode widgets. Slots only
+    // hold a pointer to the state, so growing never moves a widget and a steady set of widgets never allocates.
+    class FUI_ImmediateTable
+    {
+    public:
+        struct Widget
+        {
+            std::shared_ptr<FUI_Element> element;
+            FUI_Window* window = nullptr;
+            // width of the label drawn left of sliders and checkboxes
+            float label_width = 0.f;
+            // value last seen on both sides, tells apart user input from changes to the bound variable
+            double synced_value = 0.0;
+            bool clicked = false;
+        };
+    private:
+        // ids 0 and 1 mark empty and deleted slots
+        static constexpr uint64_t empty_id = 0;
+        static constexpr uint64_t deleted_id = 1;
+
+        struct Slot
+        {
+            uint64_t id = empty_id;
+            uint64_t last_frame = 0;
+            std::unique_ptr<Widget> widget;
+        };
+
+        std::vector<Slot> slots;
+        size_t used = 0;
+        size_t live = 0;
+        size_t seen = 0;
+
+        void rehash(size_t capacity);
+    public:
+        // FNV-1a, never returns one of the reserved ids
+        static uint64_t hash(const void* data, size_t length, uint64_t seed);
+
+        static constexpr uint64_t hash_seed = 14695981039346656037ull;
+
+        // returns the widget for id and marks it as seen, created is set when it didn't exist yet
+        Widget* acquire(uint64_t id, uint64_t frame, bool& created);
+
+        // removes every widget that wasn't acquired during frame
+        void collect(uint64_t frame);
+
+        const size_t get_size();
+    };
+
+    // An update for a widget that any thread can post, see FrostUI::post
+    struct FUI_Op
+    {
+        enum class Kind
+        {
+            SET_TEXT = 0,
+            // slider value or checkbox state (non zero is checked)
+            SET_VALUE,
+            // dropdown and combolist items
+            ADD_ITEM,
+            CALL
+        };
+
+        Kind kind = Kind::CALL;
+        std::string text;
+        double value = 0.0;
+        std::function<void(FUI_Element&)> call;
+
+        static FUI_Op set_text(std::string text) { FUI_Op op; op.kind = Kind::SET_TEXT; op.text = std::move(text); return op; }
+
+        static FUI_Op set_value(double value) { FUI_Op op; op.kind = Kind::SET_VALUE; op.value = value; return op; }
+
+        static FUI_Op add_item(std::string item) { FUI_Op op; op.kind = Kind::ADD_ITEM; op.text = std::move(item); return op; }
+
+        // anything else, runs on the ui thread
+        static FUI_Op invoke(std::function<void(FUI_Element&)> call) { FUI_Op op; op.call = std::move(call); return op; }
+    };
+
+    // Multiple producer, single consumer queue (intrusive, after Dmitry Vyukov). Pushing is one atomic exchange, so
+    // worker threads never block on the ui thread.
+    class FUI_OpQueue
+    {
+    public:
+        struct Node
+        {
+            std::atomic<Node*> next{ nullptr };
+            std::shared_ptr<FUI_Element> element;
+            FUI_Op op;
+            // set while draining when a newer op of the same kind replaces this one
+            bool superseded = false;
+        };
+    private:
+        std::atomic<Node*> head;
+        Node* tail;
+        Node stub;
+
+        void push_node(Node* node);
+    public:
+        FUI_OpQueue();
+        ~FUI_OpQueue();
+
+        // any thread
+        void push(std::shared_ptr<FUI_Element> element, FUI_Op op);
+
+        // ui thread only, nullptr when empty (or when a push is halfway done, it shows up next time)
+        Node* pop();
+    };
+
+    // Work handed to another thread. When its owner shuts down before it ran, cancel runs instead
+    struct FUI_Job
+    {
+        std::function<void()> run;
+        // optional, releases what run would have (busy elements, suspended coroutines)
+        std::function<void()> cancel;
+    };
+
+    // Fixed set of worker threads behind FrostUI::run_async, started on first use
+    class FUI_WorkerPool
+    {
+    private:
+        std::vector<std::thread> workers;
+        std::deque<FUI_Job> tasks;
+        std::mutex mutex;
+        std::condition_variable condition;
+        bool stopping = false;
+
+        void work();
+    public:
+        ~FUI_WorkerPool();
+
+        void submit(std::function<void()> task, std::function<void()> cancel = nullptr);
+
+        // lets running tasks finish and joins the workers, queued tasks are cancelled on the calling thread
+        void stop();
+    };
+
+#ifdef FUI_COROUTINES
+    // Fire and forget coroutine for ui callbacks, suspend with FrostUI::resume_background and resume_on_ui
+    struct FUI_Task
+    {
+        struct promise_type
+        {
+            FUI_Task get_return_object() { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() {}
+            void unhandled_exception() { std::terminate(); }
+        };
+    };
+#endif
+
+    class FrostUI : public olc::PGEX
+    {
+    private:
+        std::deque<FUI_Window*> windows;
+        std::vector<std::pair<std::string, std::string>> groups;
+        std::string active_window_id;
+        std::pair<std::string, std::string> active_group;
+        std::deque<std::shared_ptr<FUI_Element>> elements;
+        std::deque<std::shared_ptr<FUI_Element>> groupboxes;
+        std::pair<bool, std::shared_ptr<FUI_Element>> trigger_pushback = std::make_pair(false, nullptr);
+
+        std::string current_focused_window;
+        std::string saved_focused_window;
+
+        bool prime_window_focusing = true;
+
+        bool is_a_window_focused();
+
+        bool disable_window_input_if_open_dropdown(int window_index);
+
+        void cycle_inputfield();
+
+        void push_focused_to_back();
+
+        void push_focused_element_to_back();
+
+        bool is_cursor_in_window();
+
+        FUI_EventBus event_bus;
+
+        // input and clock snapshot of the current frame and whether something asked for a redraw, elements are
+        // pointed at them while run() goes on
+        FUI_Frame frame;
+        bool redraw_requested = false;
+
+        // ties a newly created element to this instance
+        void adopt(FUI_Element* element);
+
+        // open / close animations and other tweens of this instance's elements, shared so elements that outlive
+        // the FrostUI can tell it's gone
+        std::shared_ptr<FUI_Animator> animator = std::make_shared<FUI_Animator>();
+
+        // idle detection, see FUI_RunStatus
+        double next_change = std::numeric_limits<double>::infinity();
+        // bumped whenever windows or elements are added, removed or moved into a container, cached frames can
+        // point at decals of elements that are gone
+        uint64_t structure_version = 0;
+        uint64_t last_structure_version = 0;
+
+        // reduced render rate, the decals of the last drawn frame per engine layer are submitted again in between
+        float render_rate = 0.f;
+        double last_render_time = 0.0;
+        bool drawing = true;
+        bool render_cached = false;
+        bool render_stale = true;
+        std::vector<size_t> render_marks;
+        std::vector<std::vector<olc::DecalInstance>> render_cache;
+
+        // per window (same order as windows), true when it's covered by windows above it or off screen
+        std::vector<uint8_t> window_hidden;
+        std::vector<std::pair<olc::vf2d, olc::vf2d>> uncovered_rects;
+
+        void update_window_occlusion();
+
+        const bool is_rect_covered(olc::vf2d min, olc::vf2d max, size_t window_index);
+
+        FUI_InputRecorder input_recorder;
+        FUI_InputReplay input_replay;
+        // milliseconds each run() took while replaying
+        std::vector<float> replay_timings;
+
+        // ops posted from other threads, applied at the start of run()
+        FUI_OpQueue posted_ops;
+        std::vector<FUI_OpQueue::Node*> draining_ops;
+        uint64_t drain_count = 0;
+
+        void apply_posted_ops();
+
+        // continuations of async work, run on the ui thread at the start of run()
+        std::mutex completion_mutex;
+        std::vector<FUI_Job> completions;
+        std::vector<FUI_Job> running_completions;
+        // after the completions so it's joined before they go away
+        FUI_WorkerPool worker_pool;
+
+        void post_completion(std::function<void()> completion, std::function<void()> cancel = nullptr);
+
+        void run_completions();
+
+        template<typename Work, typename Done>
+        void submit_async(std::weak_ptr<FUI_Element> busy_element, Work work, Done done)
+        {
+            using R = std::invoke_result_t<Work&>;
+            // work that never ran or finished too late still gives the element back
+            auto release = [busy_element]()
+            {
+                if (auto element = busy_element.lock())
+                    element->set_busy(false);
+            };
+            worker_pool.submit([this, busy_element, work, done, release]() mutable
+            {
+                std::exception_ptr error;
+                if constexpr (std::is_void<R>::value)
+                {
+                    try { work(); }
+                    catch (...) { error = std::current_exception(); }
+
+                    post_completion([busy_element, done, error]() mutable
+                    {
+                        if (auto element = busy_element.lock())
+                            element->set_busy(false);
+                        if (error)
+                            std::rethrow_exception(error);
+                        done();
+                    }, release);
+                }
+                else
+                {
+                    // shared so the completion stays copyable for std::function
+                    auto result = std::make_shared<std::optional<R>>();
+                    try { result->emplace(work()); }
+                    catch (...) { error = std::current_exception(); }
+
+                    post_completion([busy_element, done, error, result]() mutable
+                    {
+                        if (auto element = busy_element.lock())
+                            element->set_busy(false);
+                        if (error)
+                            std::rethrow_exception(error);
+                        done(std::move(**result));
+                    }, release);
+                }
+            }, release);
+        }
+
+        // immediate mode state
+        FUI_ImmediateTable immediate_table;
+        std::vector<FUI_ImmediateTable::Widget*> immediate_order;
+        std::vector<std::pair<uint64_t, FUI_Window*>> immediate_windows;
+        std::array<uint64_t, 32> immediate_id_stack = { FUI_ImmediateTable::hash_seed };
+        int immediate_id_depth = 0;
+        uint64_t immediate_frame = 1;
+        FUI_Window* immediate_window = nullptr;
+        bool immediate_skip = false;
+        bool immediate_same_line = false;
+        olc::vf2d immediate_cursor = { 4.f, 4.f };
+        olc::vf2d immediate_line_start = { 4.f, 4.f };
+        olc::vf2d immediate_last_position = { 0.f, 0.f };
+        olc::vf2d immediate_last_size = { 0.f, 0.f };
+        float immediate_item_width = 150.f;
+        float immediate_item_height = 16.f;
+        float immediate_spacing = 4.f;
+
+        FUI_ImmediateTable::Widget* immediate_widget(std::string_view label, bool& created);
+
+        const olc::vf2d immediate_place(olc::vf2d item_size);
+
+        void run_immediate(FUI_Window* window, bool draw);
+
+        void collect_immediate();
+
+        // everything run() does once the frame's input is known
+        FUI_RunStatus run_frame(std::chrono::steady_clock::time_point run_start, bool replayed);
+
+    public:
+        ~FrostUI();
+
+        void set_active_window(const std::string& window_id);
+
+        void set_active_group(const std::string& g);
+
+        FUI_Window* create_window(const std::string& identifier, const std::string& title, olc::vi2d position, olc::vi2d size);
+
+        void add_group(const std::string& window_id, const std::string& g);
+
+        void clear_active_window();
+
+        void clear_active_group();
+
+        const std::string& get_active_group();
+
+        FUI_ButtonHandle add_button(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, std::function<void()> callback);
+
+        FUI_ButtonHandle add_button(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, std::function<void()> callback);
+
+        FUI_CheckboxHandle add_checkbox(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        FUI_CheckboxHandle add_checkbox(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        FUI_DropdownHandle add_dropdown(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        FUI_DropdownHandle add_dropdown(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        FUI_CombolistHandle add_combolist(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        FUI_CombolistHandle add_combolist(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        FUI_GroupboxHandle add_groupbox(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        FUI_GroupboxHandle add_groupbox(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        FUI_SliderHandle<float> add_float_slider(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, olc::vf2d range);
+
+        FUI_SliderHandle<float> add_float_slider(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, olc::vf2d range);
+
+        FUI_SliderHandle<int> add_int_slider(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, olc::vi2d range);
+
+        FUI_SliderHandle<int> add_int_slider(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, olc::vi2d range);
+
+        FUI_LabelHandle add_label(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position);
+
+        FUI_LabelHandle add_label(const std::string& identifier, const std::string& text, olc::vi2d position);
+
+        FUI_InputfieldHandle add_inputfield(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        FUI_InputfieldHandle add_inputfield(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        FUI_ConsoleHandle add_console(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, int inputfield_thickness);
+
+        FUI_ConsoleHandle add_console(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, int inputfield_thickness);
+
+        FUI_ScrollViewHandle add_scrollview(const std::string& parent_id, const std::string& identifier, olc::vi2d position, olc::vi2d size);
+
+        FUI_ScrollViewHandle add_scrollview(const std::string& identifier, olc::vi2d position, olc::vi2d size);
+
+        // moves an already added element into a scrollview, its position becomes relative to the scrollview content
+        void add_to_scrollview(const std::string& scrollview_id, const std::string& element_id);
+
+        FUI_TableHandle add_table(const std::string& parent_id, const std::string& identifier, olc::vi2d position, olc::vi2d size);
+
+        FUI_TableHandle add_table(const std::string& identifier, olc::vi2d position, olc::vi2d size);
+
+        FUI_TreeViewHandle add_treeview(const std::string& parent_id, const std::string& identifier, olc::vi2d position, olc::vi2d size);
+
+        FUI_TreeViewHandle add_treeview(const std::string& identifier, olc::vi2d position, olc::vi2d size);
+
+        FUI_PlotHandle add_plot(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        FUI_PlotHandle add_plot(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        FUI_CanvasHandle add_canvas(const std::string& parent_id, const std::string& identifier, olc::vi2d position, olc::vi2d size);
+
+        FUI_CanvasHandle add_canvas(const std::string& identifier, olc::vi2d position, olc::vi2d size);
+
+        FUI_FileViewHandle add_fileview(const std::string& parent_id, const std::string& identifier, olc::vi2d position, olc::vi2d size);
+
+        FUI_FileViewHandle add_fileview(const std::string& identifier, olc::vi2d position, olc::vi2d size);
+
+        FUI_LogTailHandle add_logtail(const std::string& parent_id, const std::string& identifier, olc::vi2d position, olc::vi2d size);
+
+        FUI_LogTailHandle add_logtail(const std::string& identifier, olc::vi2d position, olc::vi2d size);
+
+        FUI_TimelineHandle add_timeline(const std::string& parent_id, const std::string& identifier, olc::vi2d position, olc::vi2d size);
+
+        FUI_TimelineHandle add_timeline(const std::string& identifier, olc::vi2d position, olc::vi2d size);
+
+        FUI_NodeGraphHandle add_nodegraph(const std::string& parent_id, const std::string& identifier, olc::vi2d position, olc::vi2d size);
+
+        FUI_NodeGraphHandle add_nodegraph(const std::string& identifier, olc::vi2d position, olc::vi2d size);
+
+        void add_to_node(const std::string& nodegraph_id, const std::string& node_id, const std::string& element_id);
+
+        FUI_ProgressBarHandle add_progressbar(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        FUI_ProgressBarHandle add_progressbar(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        FUI_SpinnerHandle add_spinner(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        FUI_SpinnerHandle add_spinner(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size);
+
+        FUI_Window* find_window(const std::string& identifier);
+
+        std::shared_ptr<FUI_Element> find_element(const std::string& identifier);
+
+        std::shared_ptr<FUI_Element> find_groupbox(const std::string& identifier);
+
+        void remove_element(const std::string& identifier);
+
+        void remove_window(const std::string& identifier);
+
+        int get_element_amount();
+
+        // Thread safe, the op is applied on the ui thread at the start of the next run(). Of several set_text (or
+        // set_value) ops for one element posted before a run() only the newest is applied, everything else in order.
+        template<typename E>
+        void post(const FUI_Handle<E>& handle, FUI_Op op)
+        {
+            if (!handle)
+            {
+                std::cout << "Tried to post to an empty handle (function affected: post)\n";
+                return;
+            }
+            // not owned by a shared_ptr gives an empty lock instead of throwing bad_weak_ptr
+            std::shared_ptr<FUI_Element> element = handle.get_element()->weak_from_this().lock();
+            if (!element)
+            {
+                std::cout << "Tried to post to an element that isn't owned by the UI (function affected: post)\n";
+                return;
+            }
+            posted_ops.push(std::move(element), std::move(op));
+        }
+
+        void post(std::shared_ptr<FUI_Element> element, FUI_Op op);
+
+        // Runs work on a worker thread, done (taking the result of work, if any) runs on the ui thread at the start
+        // of the next run(). An exception thrown by work is rethrown from that run().
+        // When the FrostUI is destroyed, work that is running is waited for, but queued work never runs and no
+        // done is called anymore. Busy elements are released and suspended FUI_Task coroutines are destroyed.
+        template<typename Work, typename Done>
+        void run_async(Work work, Done done)
+        {
+            submit_async(std::weak_ptr<FUI_Element>(), std::move(work), std::move(done));
+        }
+
+        // same as above, element stays busy until done ran
+        template<typename Work, typename Done>
+        void run_async(FUI_Element* element, Work work, Done done)
+        {
+            element->set_busy(true);
+            submit_async(element->weak_from_this(), std::move(work), std::move(done));
+        }
+
+        // clicking the button runs work on the worker pool instead of a callback, the button is busy until done
+        template<typename Work, typename Done>
+        void set_async_callback(FUI_Element* button, Work work, Done done)
+        {
+            if (button->get_ui_type() != FUI_Type::BUTTON)
+            {
+                std::cout << "Trying to set_async_callback on wrong UI_TYPE\n";
+                return;
+            }
+            button->callback = [this, button, work, done]() { run_async(button, work, done); };
+        }
+
+#ifdef FUI_COROUTINES
+        struct BackgroundAwaiter
+        {
+            FrostUI* ui;
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) { ui->worker_pool.submit([handle]() { handle.resume(); }, [handle]() { handle.destroy(); }); }
+            void await_resume() const noexcept {}
+        };
+
+        struct UiAwaiter
+        {
+            FrostUI* ui;
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) { ui->post_completion([handle]() { handle.resume(); }, [handle]() { handle.destroy(); }); }
+            void await_resume() const noexcept {}
+        };
+
+        // co_await inside an FUI_Task to continue on a worker thread
+        BackgroundAwaiter resume_background() { return { this }; }
+
+        // co_await inside an FUI_Task to continue on the ui thread at the start of the next run()
+        UiAwaiter resume_on_ui() { return { this }; }
+#endif
+
+        // callback runs after the input pass of the frame the event happened in, element limits it to one element
+        uint64_t subscribe(FUI_EventType type, std::function<void(const FUI_Event&)> callback);
+
+        uint64_t subscribe(FUI_EventType type, FUI_Element* element, std::function<void(const FUI_Event&)> callback);
+
+        void unsubscribe(uint64_t id);
+
+        // Immediate mode front end, call these every frame before run(). Widgets are identified by a hash of
+        // their label and the id stack, text after "##" only goes into the id. A widget that isn't called
+        // during a frame is removed. Results (clicks, changed values) come from the previous run().
+        bool begin_window(std::string_view window_id);
+
+        void end_window();
+
+        void push_id(std::string_view id);
+
+        void push_id(const void* id);
+
+        void pop_id();
+
+        // places the next widget to the right of the last one
+        void same_line();
+
+        void set_cursor(olc::vf2d position);
+
+        void set_item_width(float width);
+
+        void label(std::string_view text);
+
+        bool button(std::string_view label);
+
+        // returns true when the user toggled it
+        bool checkbox(std::string_view label, bool* value);
+
+        // returns true when the user changed the value, the range is taken when the slider is created
+        bool slider(std::string_view label, float* value, float min, float max);
+
+        bool slider(std::string_view label, int* value, int min, int max);
+
+        // input and clock snapshot the last run() worked with
+        const FUI_Frame& get_frame() { return frame; }
+
+        // makes the next run() report a change, for hosts that changed elements through the API
+        void request_redraw() { redraw_requested = true; }
+
+        // Draws the UI at most rate times per second, 0 (the default) draws every frame. In between the decals of
+        // the last drawn frame are submitted again, input is still handled every frame. Presses, releases, the
+        // wheel, redraw requests (setters, posted ops, bindings, ...) and added or removed elements are drawn
+        // right away.
+        void set_render_rate(float rate);
+
+        // writes the input of every following run() to path until stop_recording
+        bool start_recording(const std::string& path);
+
+        void stop_recording();
+
+        // run() takes its input from the recording instead of the engine until the recording ends
+        bool start_replay(const std::string& path);
+
+        void stop_replay();
+
+        const bool is_replaying();
+
+        // milliseconds each run() of the current or last replay took
+        const std::vector<float>& get_replay_timings();
+
+        // Replays a whole recording outside of the engine's update loop and returns the time of every frame, for
+        // benchmarking. The engine still has to be constructed, the decals the replayed frames queue are dropped.
+        std::vector<float> run_replay(const std::string& path);
+
+        // Returns whether anything visible changed and when the next known change is due. Hosts with a static UI
+        // can skip presenting, or sleep until next_change or the next input.
+        FUI_RunStatus run();
+    };
+}
+/*
+####################################################
+#               IMPLEMENTATIONS                    #
+####################################################
+*/
+#ifdef OLC_PGEX_FUI
+#undef OLC_PGEX_FUI
+namespace olc
+{
+    /*
+    ####################################################
+    #               FUI_NUMBERTEXT START               #
+    ####################################################
+    */
+    size_t fui_format_number(char* buffer, size_t capacity, double value, int precision)
+    {
+#if defined(__cpp_lib_to_chars)
+        std::to_chars_result result;
+        if (precision < 0)
+            result = std::to_chars(buffer, buffer + capacity, value, std::chars_format::general, 6);
+        else
+        {
+            result = std::to_chars(buffer, buffer + capacity, value, std::chars_format::fixed, precision);
+            // too long in fixed notation
+            if (result.ec != std::errc())
+                result = std::to_chars(buffer, buffer + capacity, value, std::chars_format::general, precision);
+        }
+        return result.ec == std::errc() ? size_t(result.ptr - buffer) : 0;
+#else
+        int length = precision < 0 ? std::snprintf(buffer, capacity, "%g", value) : std::snprintf(buffer, capacity, "%.*f", precision, value);
+        if (precision >= 0 && (length < 0 || size_t(length) >= capacity))
+            length = std::snprintf(buffer, capacity, "%.*g", precision, value);
+        return length < 0 ? 0 : std::min(size_t(length), capacity - 1);
+#endif
+    }
+
+    size_t fui_format_number(char* buffer, size_t capacity, int64_t value)
+    {
+#if __has_include(<charconv>)
+        auto result = std::to_chars(buffer, buffer + capacity, value);
+        return result.ec == std::errc() ? size_t(result.ptr - buffer) : 0;
+#else
+        int length = std::snprintf(buffer, capacity, "%lld", static_cast<long long>(value));
+        return length < 0 ? 0 : std::min(size_t(length), capacity - 1);
+#endif
+    }
+
+    FUI_NumberText::FUI_NumberText(const std::string& p, const std::string& s) : prefix(p), suffix(s)
+    {
+        text = prefix + suffix;
+    }
+
+    bool FUI_NumberText::set(double v, int digits)
+    {
+        // NaN never compares equal, treat two of them as the same value
+        bool same_value = v == value || (std::isnan(v) && std::isnan(value));
+        if (is_set && !is_integer && digits == precision && same_value)
+            return false;
+
+        value = v;
+        precision = digits;
+        is_integer = false;
+        is_set = true;
+
+        char buffer[64];
+        size_t length = fui_format_number(buffer, sizeof(buffer), v, digits);
+        text.assign(prefix);
+        text.append(buffer, length);
+        text.append(suffix);
+        return true;
+    }
+
+    bool FUI_NumberText::set(int64_t v)
+    {
+        if (is_set && is_integer && double(v) == value)
+            return false;
+
+        value = double(v);
+        is_integer = true;
+        is_set = true;
+
+        char buffer[32];
+        size_t length = fui_format_number(buffer, sizeof(buffer), v);
+        text.assign(prefix);
+        text.append(buffer, length);
+        text.append(suffix);
+        return true;
+    }
+
+    /*
+    ####################################################
+    #               FUI_TIMESTAMP START                #
+    ####################################################
+    */
+    FUI_Timestamp::FUI_Timestamp(const std::string& format)
+    {
+        set_format(format);
+    }
+
+    void FUI_Timestamp::set_format(const std::string& format)
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+
+        pieces.clear();
+        cached_minute = std::numeric_limits<int64_t>::min();
+
+        auto add_piece = [&](Field field, const std::string& pattern)
+        {
+            // merge cached patterns so a minute change is one strftime per run of fields
+            if (field == Field::CACHED && !pieces.empty() && pieces.back().field == Field::CACHED)
+                pieces.back().pattern += pattern;
+            else
+                pieces.push_back(Piece{ field, pattern, "" });
+        };
+
+        for (size_t i = 0; i < format.size(); i++)
+        {
+            if (format[i] != '%' || i + 1 == format.size())
+            {
+                // a lone '%' would be an invalid strftime pattern
+                add_piece(Field::CACHED, format[i] == '%' ? "%%" : std::string(1, format[i]));
+                continue;
+            }
+
+            // the E and O modifiers pick the locale's alternative form of the conversion that follows
+            if ((format[i + 1] == 'E' || format[i + 1] == 'O') && i + 2 < format.size())
+            {
+                char conversion = format[i + 2];
+                bool has_seconds = conversion == 'S' || conversion == 'T' || conversion == 'X' || conversion == 'r' || conversion == 'c' || conversion == 's';
+                add_piece(has_seconds ? Field::UNCACHED : Field::CACHED, format.substr(i, 3));
+                i += 2;
+                continue;
+            }
+
+            switch (format[++i])
+            {
+            case 'S':
+                add_piece(Field::SECOND, "");
+                break;
+            case 'T':
+                add_piece(Field::CACHED, "%H:%M:");
+                add_piece(Field::SECOND, "");
+                break;
+            case 'X':
+            case 'r':
+            case 'c':
+            case 's':
+                // the seconds are somewhere in a locale dependent layout
+                add_piece(Field::UNCACHED, std::string{ '%', format[i] });
+                break;
+            case 'f':
+                add_piece(Field::MILLISECOND, "");
+                break;
+            case 'q':
+                add_piece(Field::MONOTONIC, "");
+                break;
+            default:
+                add_piece(Field::CACHED, std::string{ '%', format[i] });
+                break;
+            }
+        }
+    }
+
+    void FUI_Timestamp::refresh(int64_t minute) const
+    {
+        std::time_t tt = std::time_t(minute * 60);
+        struct std::tm ptm;
+#ifdef _MSC_VER
+        localtime_s(&ptm, &tt);
+#else
+        localtime_r(&tt, &ptm);
+#endif
+        char buffer[128];
+        for (auto& piece : pieces)
+        {
+            if (piece.field != Field::CACHED)
+                continue;
+            size_t length = std::strftime(buffer, sizeof(buffer), piece.pattern.c_str(), &ptm);
+            piece.text.assign(buffer, length);
+        }
+        cached_minute = minute;
+    }
+
+    void FUI_Timestamp::format(std::string& out, std::chrono::system_clock::time_point time, std::chrono::steady_clock::time_point tick) const
+    {
+        int64_t milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count();
+        // floor so times before the epoch still land in the right minute
+        int64_t minute = milliseconds >= 0 ? milliseconds / 60000 : -((-milliseconds + 59999) / 60000);
+        int64_t in_minute = milliseconds - minute * 60000;
+
+        std::lock_guard<std::mutex> lock(cache_mutex);
+
+        if (minute != cached_minute)
+            refresh(minute);
+
+        bool has_second_time = false;
+        struct std::tm second_time;
+        for (auto& piece : pieces)
+        {
+            switch (piece.field)
+            {
+            case Field::CACHED:
+                out += piece.text;
+                break;
+            case Field::UNCACHED:
+            {
+                if (!has_second_time)
+                {
+                    std::time_t tt = std::time_t(minute * 60 + in_minute / 1000);
+#ifdef _MSC_VER
+                    localtime_s(&second_time, &tt);
+#else
+                    localtime_r(&tt, &second_time);
+#endif
+                    has_second_time = true;
+                }
+                char buffer[128];
+                out.append(buffer, std::strftime(buffer, sizeof(buffer), piece.pattern.c_str(), &second_time));
+                break;
+            }
+            case Field::SECOND:
+                out.push_back(char('0' + in_minute / 10000));
+                out.push_back(char('0' + in_minute / 1000 % 10));
+                break;
+            case Field::MILLISECOND:
+                out.push_back(char('0' + in_minute / 100 % 10));
+                out.push_back(char('0' + in_minute / 10 % 10));
+                out.push_back(char('0' + in_minute % 10));
+                break;
+            case Field::MONOTONIC:
+            {
+                char buffer[32];
+                double elapsed = std::chrono::duration<double>(tick - start).count();
+                out.append(buffer, fui_format_number(buffer, sizeof(buffer), elapsed, 3));
+                break;
+            }
+            }
+        }
+    }
+
+    /*
+    ####################################################
+    #               FUI_FRAME START                    #
+    ####################################################
+    */
+    void FUI_Frame::capture(olc::PixelGameEngine* pge)
+    {
+        index++;
+        time = std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        delta_time = pge->GetElapsedTime();
+
+        olc::vi2d position = pge->GetMousePos();
+        mouse_delta = index > 1 ? position - mouse_position : olc::vi2d{ 0, 0 };
+        mouse_position = position;
+        mouse_wheel = pge->GetMouseWheel();
+        for (int i = 0; i < mouse_buttons; i++)
+            mouse[i] = pge->GetMouse(i);
+
+        for (int i = 0; i < key_count; i++)
+        {
+            auto key = pge->GetKey(olc::Key(i));
+            keys_pressed[i] = key.bPressed;
+            keys_held[i] = key.bHeld;
+            keys_released[i] = key.bReleased;
+        }
+    }
+
+    const olc::HWButton FUI_Frame::get_mouse(int button) const
+    {
+        if (button < 0 || button >= mouse_buttons)
+            return olc::HWButton{};
+        return mouse[button];
+    }
+
+    const olc::HWButton FUI_Frame::get_key(olc::Key key) const
+    {
+        olc::HWButton state;
+        if (int(key) < 0 || int(key) >= key_count)
+            return state;
+        state.bPressed = keys_pressed[key];
+        state.bHeld = keys_held[key];
+        state.bReleased = keys_released[key];
+        return state;
+    }
+
+    /*
+    ####################################################
+    #               FUI_INPUTRECORDER START            #
+    ####################################################
+    */
+    namespace fui_input_record
+    {
+        constexpr uint32_t magic = 0x52495546; // "FUIR"
+        constexpr uint32_t version = 1;
+
+        template<typename T>
+        void put(std::vector<uint8_t>& buffer, const T& value)
+        {
+            auto bytes = reinterpret_cast<const uint8_t*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+    }
+
+    bool FUI_InputRecorder::open(const std::string& path)
+    {
+        close();
+        file.open(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            std::cout << "Could not open the input recording (function affected: open, path affected: " << path << ")\n";
+            return false;
+        }
+
+        buffer.clear();
+        fui_input_record::put(buffer, fui_input_record::magic);
+        fui_input_record::put(buffer, fui_input_record::version);
+        fui_input_record::put(buffer, uint16_t(FUI_Frame::key_count));
+        fui_input_record::put(buffer, uint16_t(FUI_Frame::mouse_buttons));
+        file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+        return true;
+    }
+
+    void FUI_InputRecorder::close()
+    {
+        if (file.is_open())
+            file.close();
+    }
+
+    void FUI_InputRecorder::write(const FUI_Frame& frame)
+    {
+        if (!file.is_open())
+            return;
+
+        buffer.clear();
+        fui_input_record::put(buffer, frame.time);
+        fui_input_record::put(buffer, frame.delta_time);
+        fui_input_record::put(buffer, int32_t(frame.mouse_position.x));
+        fui_input_record::put(buffer, int32_t(frame.mouse_position.y));
+        fui_input_record::put(buffer, int32_t(frame.mouse_wheel));
+
+        uint8_t pressed = 0, held = 0, released = 0;
+        for (int i = 0; i < FUI_Frame::mouse_buttons; i++)
+        {
+            pressed |= uint8_t(frame.mouse[i].bPressed) << i;
+            held |= uint8_t(frame.mouse[i].bHeld) << i;
+            released |= uint8_t(frame.mouse[i].bReleased) << i;
+        }
+        fui_input_record::put(buffer, pressed);
+        fui_input_record::put(buffer, held);
+        fui_input_record::put(buffer, released);
+
+        // key index followed by pressed/held/released bits, only for keys that have any of them
+        auto keys = frame.keys_pressed | frame.keys_held | frame.keys_released;
+        fui_input_record::put(buffer, uint16_t(keys.count()));
+        for (int i = 0; i < FUI_Frame::key_count; i++)
+        {
+            if (!keys[i])
+                continue;
+            fui_input_record::put(buffer, uint16_t(i));
+            fui_input_record::put(buffer, uint8_t(frame.keys_pressed[i] | frame.keys_held[i] << 1 | frame.keys_released[i] << 2));
+        }
+
+        file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+    }
+
+    template<typename T>
+    bool FUI_InputReplay::read_value(T& value)
+    {
+        if (data.size() - offset < sizeof(T))
+            return false;
+        std::memcpy(&value, data.data() + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+
+    bool FUI_InputReplay::open(const std::string& path)
+    {
+        close();
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open())
+        {
+            std::cout << "Could not open the input recording (function affected: open, path affected: " << path << ")\n";
+            return false;
+        }
+        data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+        uint32_t magic = 0, version = 0;
+        uint16_t key_count = 0, mouse_buttons = 0;
+        if (!read_value(magic) || !read_value(version) || !read_value(key_count) || !read_value(mouse_buttons) ||
+            magic != fui_input_record::magic || version != fui_input_record::version ||
+            key_count != FUI_Frame::key_count || mouse_buttons != FUI_Frame::mouse_buttons)
+        {
+            std::cout << "Input recording doesn't match this build (function affected: open, path affected: " << path << ")\n";
+            close();
+            return false;
+        }
+        opened = true;
+        return true;
+    }
+
+    void FUI_InputReplay::close()
+    {
+        data.clear();
+        data.shrink_to_fit();
+        offset = 0;
+        opened = false;
+    }
+
+    bool FUI_InputReplay::read(FUI_Frame& frame)
+    {
+        if (!opened)
+            return false;
+
+        double time = 0.0;
+        float delta_time = 0.f;
+        int32_t x = 0, y = 0, wheel = 0;
+        uint8_t pressed = 0, held = 0, released = 0;
+        uint16_t key_amount = 0;
+        if (!read_value(time) || !read_value(delta_time) || !read_value(x) || !read_value(y) || !read_value(wheel) ||
+            !read_value(pressed) || !read_value(held) || !read_value(released) || !read_value(key_amount))
+            return false;
+
+        frame.keys_pressed.reset();
+        frame.keys_held.reset();
+        frame.keys_released.reset();
+        for (int i = 0; i < key_amount; i++)
+        {
+            uint16_t key = 0;
+            uint8_t bits = 0;
+            if (!read_value(key) || !read_value(bits) || key >= FUI_Frame::key_count)
+                return false;
+            frame.keys_pressed[key] = bits & 1;
+            frame.keys_held[key] = bits & 2;
+            frame.keys_released[key] = bits & 4;
+        }
+
+        frame.index++;
+        frame.time = time;
+        frame.delta_time = delta_time;
+        olc::vi2d position = { x, y };
+        frame.mouse_delta = frame.index > 1 ? position - frame.mouse_position : olc::vi2d{ 0, 0 };
+        frame.mouse_position = position;
+        frame.mouse_wheel = wheel;
+        for (int i = 0; i < FUI_Frame::mouse_buttons; i++)
+        {
+            frame.mouse[i].bPressed = pressed >> i & 1;
+            frame.mouse[i].bHeld = held >> i & 1;
+            frame.mouse[i].bReleased = released >> i & 1;
+        }
+        return true;
+    }
+
+    /*
+    ####################################################
+    #               FUI_ANIMATOR START                 #
+    ####################################################
+    */
+    void FUI_Animator::animate(const void* owner, float* value, float target, float speed)
+    {
+        for (auto& tween : tweens)
+        {
+            if (tween.value == value)
+            {
+                tween.target = target;
+                tween.speed = speed;
+                return;
+            }
+        }
+        tweens.push_back(Tween{ owner, value, target, speed });
+    }
+
+    void FUI_Animator::stop(const float* value)
+    {
+        for (size_t i = 0; i < tweens.size(); i++)
+        {
+            if (tweens[i].value == value)
+            {
+                tweens[i] = tweens.back();
+                tweens.pop_back();
+                return;
+            }
+        }
+    }
+
+    void FUI_Animator::stop_all(const void* owner)
+    {
+        tweens.erase(std::remove_if(tweens.begin(), tweens.end(), [owner](const Tween& tween) { return tween.owner == owner; }), tweens.end());
+    }
+
+    const bool FUI_Animator::is_running(const float* value)
+    {
+        for (auto& tween : tweens)
+            if (tween.value == value)
+                return true;
+        return false;
+    }
+
+    void FUI_Animator::tick(float delta_time)
+    {
+        for (size_t i = 0; i < tweens.size();)
+        {
+            auto& tween = tweens[i];
+            float step = tween.speed * delta_time;
+            float distance = tween.target - *tween.value;
+            // a speed of 0 or less jumps straight to the target
+            if (tween.speed <= 0.f || std::abs(distance) <= step)
+            {
+                *tween.value = tween.target;
+                tween = tweens.back();
+                tweens.pop_back();
+                continue;
+            }
+            *tween.value += distance > 0.f ? step : -step;
+            i++;
+        }
+    }
+
+    const bool FUI_Frame::has_input() const
+    {
+        if (mouse_delta.x != 0 || mouse_delta.y != 0 || mouse_wheel != 0)
+            return true;
+        for (auto& button : mouse)
+            if (button.bPressed || button.bHeld || button.bReleased)
+                return true;
+        return keys_pressed.any() || keys_held.any() || keys_released.any();
+    }
+
+    const bool FUI_Frame::has_input_events() const
+    {
+        if (mouse_wheel != 0)
+            return true;
+        for (auto& button : mouse)
+            if (button.bPressed || button.bReleased)
+                return true;
+        return keys_pressed.any() || keys_released.any();
+    }
+
+    FUI_EventBus* FUI_Element::event_bus = nullptr;
+
+    FUI_Frame FUI_Element::idle_frame;
+    FUI_Frame* FUI_Element::frame = &FUI_Element::idle_frame;
+
+    bool* FUI_Element::running_redraw = nullptr;
+
+    FUI_Animator* FUI_Element::animator = nullptr;
+
+    FUI_Element::~FUI_Element()
+    {
+        if (auto a = tween_animator.lock())
+            a->stop_all(this);
+    }
+
+    void FUI_Element::animate(float* value, float target, float speed)
+    {
+        if (!animator)
+        {
+            *value = target;
+            return;
+        }
+        tween_animator = animator->weak_from_this();
+        animator->animate(this, value, target, speed);
+    }
+
+    FUI_Window::FUI_Window(olc::PixelGameEngine* p, const std::string& id, olc::vi2d pos, olc::vi2d s, const std::string& txt)
+    {
+        identifier = id;
+        pge = p;
+        position = pos;
+        size = s;
+        title = txt;
+    }
+
+    const olc::vf2d FUI_Window::get_position() { return position; }
+
+    const olc::vf2d FUI_Window::get_size() { return size; }
+
+    const olc::vf2d FUI_Window::get_window_space() { return olc::vf2d{ size.x - border_thickness * 2, size.y - top_border_thickness }; }
+
+    const std::string FUI_Window::get_id() { return identifier; }
+
+    const float FUI_Window::get_top_border_thickness() { return top_border_thickness; }
+
+    const float FUI_Window::get_border_thickness() { return border_thickness; }
+
+    void FUI_Window::set_top_border_thickness(float thickness) { top_border_thickness = thickness; }
+
+    void FUI_Window::set_border_thickness(float thickness) { border_thickness = thickness; }
+
+    void FUI_Window::close_window(bool close) { should_render = !close; }
+
+    const bool FUI_Window::get_closed_state() { return !should_render; }
+
+    void FUI_Window::change_position(olc::vi2d pos) { position = pos; }
+
+    void FUI_Window::change_size(olc::vi2d s) { size = s; }
+
+    void FUI_Window::set_focused(bool state) { focused = state; }
+
+    const bool FUI_Window::is_focused() { return focused; }
+
+    void FUI_Window::disable_dragging(bool state) { disable_drag = state; }
+
+    void FUI_Window::disable_close(bool state) { disable_exit = state; }
+
+    const bool FUI_Window::is_opaque() { return color_scheme.window_background_color.a == 255; }
+
+    void FUI_Window::draw()
+    {
+        // Draw the main window area
+        pge->FillRectDecal(position, size, color_scheme.window_background_color);
+
+        // Draw the window border
+        pge->FillRectDecal(position, olc::vf2d{ border_thickness, size.y }, color_scheme.window_border_color); // Left side
+        pge->FillRectDecal(olc::vf2d{ position.x + size.x - border_thickness, position.y }, olc::vf2d{ border_thickness, size.y }, color_scheme.window_border_color); // Right side
+        pge->FillRectDecal(olc::vf2d{ position.x, position.y + size.y - border_thickness }, olc::vf2d{ size.x, border_thickness }, color_scheme.window_border_color); // Bottom side
+        pge->FillRectDecal(position, olc::vf2d{ size.x, top_border_thickness }, color_scheme.window_border_color); // Top bar
+
+        // Draw the window title
+        olc::vf2d title_position = olc::vf2d{ position.x + (size.x / 2) - (pge->GetTextSizeProp(title).x / 2), position.y + (top_border_thickness / 2) - (pge->GetTextSizeProp(title).y / 2) };
+        pge->DrawStringPropDecal(title_position, title, color_scheme.window_title_color);
+
+        // Draw the default window close button
+        if (!disable_exit)
+        {
+            olc::vf2d temp_pos = { position.x + size.x - (size.x / 10), position.y };
+            olc::vf2d temp_size = { size.x / 10, top_border_thickness };
+            switch (state)
+            {
+            case button_state::NORMAL:
+                pge->FillRectDecal(temp_pos, temp_size, color_scheme.exit_button_normal);
+                break;
+            case button_state::HOVER:
+                pge->FillRectDecal(temp_pos, temp_size, color_scheme.exit_button_hover);
+                break;
+            case button_state::CLICK:
+                pge->FillRectDecal(temp_pos, temp_size, color_scheme.exit_button_click);
+                break;
+            }
+            olc::vf2d close_position = olc::vf2d{ temp_pos.x + (temp_size.x / 2) - (pge->GetTextSizeProp("X").x / 2), temp_pos.y + (top_border_thickness / 2) - (pge->GetTextSizeProp("X").y / 2) };
+            pge->DrawStringPropDecal(close_position, "X", color_scheme.exit_button_text);
+        }
+
+
+        // Override top border with a darker color when window is inactive 
+        if (!focused)
+            pge->FillRectDecal(position, olc::vf2d{ size.x, top_border_thickness }, { 100, 100, 100, 150 }); // Top bar
+    }
+
+    void FUI_Window::input(std::deque<FUI_Window*> windows)
+    {
+        overlapping_window = nullptr;
+        for (auto& window : windows)
+        {
+            if (window->get_closed_state())
+                continue;
+            if (window->get_id() != identifier)
+            {
+                if (window->is_focused())
+                {
+                    if (position.x + size.x > window->get_position().x&& position.x < window->get_position().x + window->get_size().x &&
+                        position.y + size.y > window->get_position().y&& position.y < window->get_position().y + window->get_size().y)
+                    {
+                        overlapping_window = window;
+                        break;
+                    }
+                }
+            }
+        }
+
+        olc::vi2d new_window_position = position;
+
+        // input on default close button
+        if (!disable_exit)
+        {
+            if ((FUI_Element::frame->mouse_position.x >= position.x + size.x - (size.x / 10) && FUI_Element::frame->mouse_position.x <= position.x + size.x &&
+                FUI_Element::frame->mouse_position.y >= position.y && FUI_Element::frame->mouse_position.y <= position.y + top_border_thickness))
+            {
+                if (FUI_Element::frame->get_mouse(0).bHeld || FUI_Element::frame->get_mouse(0).bPressed || FUI_Element::frame->get_mouse(0).bReleased)
+                {
+                    if (FUI_Element::frame->get_mouse(0).bReleased && focused)
+                        close_window(true);
+                    state = button_state::CLICK;
+                }
+                else
+                    state = button_state::HOVER;
+            }
+            else
+                state = button_state::NORMAL;
+        }
+
+        // dragging related
+        if (!disable_drag)
+        {
+            if ((FUI_Element::frame->mouse_position.x >= position.x && FUI_Element::frame->mouse_position.x <= position.x + size.x - (size.x / 10) &&
+                FUI_Element::frame->mouse_position.y >= position.y && FUI_Element::frame->mouse_position.y <= position.y + top_border_thickness) || is_dragging)
+            {
+                if (FUI_Element::frame->get_mouse(0).bPressed)
+                {
+                    is_dragging = true;
+                    mouse_difference = FUI_Element::frame->mouse_position - position;
+                }
+
+                if (FUI_Element::frame->get_mouse(0).bHeld && is_dragging && focused)
+                    new_window_position = FUI_Element::frame->mouse_position - mouse_difference;
+
+
+                position = new_window_position;
+            }
+
+            if (FUI_Element::frame->get_mouse(0).bReleased)
+                is_dragging = false;
+        }
+        // focusing system related
+        if (overlapping_window)
+        {
+            if (!((FUI_Element::frame->mouse_position.x >= overlapping_window->get_position().x && FUI_Element::frame->mouse_position.x <= overlapping_window->get_position().x + overlapping_window->get_size().x &&
+                FUI_Element::frame->mouse_position.y >= overlapping_window->get_position().y && FUI_Element::frame->mouse_position.y <= overlapping_window->get_position().y + overlapping_window->get_size().y) &&
+                FUI_Element::frame->get_mouse(0).bPressed))
+            {
+                if ((FUI_Element::frame->mouse_position.x >= position.x && FUI_Element::frame->mouse_position.x <= position.x + size.x &&
+                    FUI_Element::frame->mouse_position.y >= position.y && FUI_Element::frame->mouse_position.y <= position.y + size.y) && FUI_Element::frame->get_mouse(0).bPressed)
+                {
+                    overlapping_window->set_focused(false);
+                    focused = true;
+                }
+                else if (FUI_Element::frame->get_mouse(0).bPressed)
+                    focused = false;
+            }
+        }
+        else
+        {
+            if ((FUI_Element::frame->mouse_position.x >= position.x && FUI_Element::frame->mouse_position.x <= position.x + size.x &&
+                FUI_Element::frame->mouse_position.y >= position.y && FUI_Element::frame->mouse_position.y <= position.y + size.y) && FUI_Element::frame->get_mouse(0).bPressed)
+            {
+                focused = true;
+            }
+            else if (FUI_Element::frame->get_mouse(0).bPressed)
+                focused = false;
+        }
+    }
+
+    /*
+    ####################################################
+    #               FUI_ELEMENT START                  #
+    ####################################################
+    */
+    const std::string FUI_Element::get_identifier()
+    {
+        return identifier;
+    }
+
+    const int FUI_Element::get_elements_amount()
+    {
+        if (ui_type == FUI_Type::DROPDOWN || ui_type == FUI_Type::COMBOLIST)
+            return elements.size();
+        else
+            std::cout << "Trying to get element amount on incorrect UI_TYPE\n";
+        return -1;
+    }
+
+    const bool FUI_Element::get_focused_status()
+    {
+        return is_focused;
+    }
+
+    void FUI_Element::set_focused_status(bool status)
+    {
+        is_focused = status;
+    }
+
+    FUI_Window* FUI_Element::get_parent()
+    {
+        return parent;
+    }
+
+    FUI_Element* FUI_Element::get_container()
+    {
+        return container;
+    }
+
+    const bool FUI_Element::encloses(FUI_Element* element)
+    {
+        for (; element; element = element->get_container())
+            if (element == this)
+                return true;
+        return false;
+    }
+
+    void FUI_Element::set_container(FUI_Element* c)
+    {
+        container = c;
+    }
+
+    const FUI_Type FUI_Element::get_ui_type()
+    {
+        return ui_type;
+    }
+
+    const olc::vf2d FUI_Element::get_size()
+    {
+        return size;
+    }
+
+    void FUI_Element::set_size(olc::vi2d s)
+    {
+        if (olc::vf2d(s) != size)
+            request_redraw();
+        size = s;
+    }
+
+    void FUI_Element::set_position(olc::vf2d p)
+    {
+        if (p != position)
+            request_redraw();
+        position = p;
+    }
+
+    void FUI_Element::set_text(const std::string& txt)
+    {
+        if (txt != text)
+            request_redraw();
+        text = txt;
+    }
+
+    void FUI_Element::set_text_color(olc::Pixel color)
+    {
+        if (color != text_color)
+            request_redraw();
+        text_color = color;
+    }
+
+    const std::string FUI_Element::get_group()
+    {
+        return group;
+    }
+
+    void FUI_Element::scale_text(olc::vf2d scale)
+    {
+        if (scale != text_scale)
+            request_redraw();
+        text_scale = scale;
+    }
+
+    void FUI_Element::inputfield_scale(olc::vf2d scale)
+    {
+        if (ui_type == FUI_Type::INPUTFIELD)
+        {
+            if (scale != input_scale)
+                request_redraw();
+            input_scale = scale;
+        }
+        else
+            std::cout << "Trying to use inputfield_scale on incorrect UI_TYPE\n";
+    }
+
+    const bool FUI_Element::get_button_state()
+    {
+        if (ui_type == FUI_Type::BUTTON && toggleable)
+        {
+            return button_state;
+        }
+        else
+            std::cout << "Trying to get_button_state on incorrect UI_TYPE or button is not toggleable\n";
+
+        return false;
+    }
+
+    void FUI_Element::make_toggleable(bool default_state)
+    {
+        if (ui_type == FUI_Type::BUTTON)
+        {
+            toggleable = true;
+            button_state = default_state;
+            request_redraw();
+        }
+        else
+            std::cout << "Trying to make_toggleable on incorrect UI_TYPE\n";
+    }
+
+    void FUI_Element::add_item(const std::string& item, olc::vf2d scale = { 1.0f, 1.0f })
+    {
+        if (ui_type == FUI_Type::DROPDOWN || ui_type == FUI_Type::COMBOLIST)
+        {
+            elements.emplace_back(std::make_pair(elements.size(), std::make_pair(DropdownState::NONE, std::make_pair(scale, item))));
+            request_redraw();
+        }
+        else
+            std::cout << "Trying to add_item to wrong UI_TYPE\n";
+    }
+
+    void FUI_Element::set_animation_speed(float speed)
+    {
+        if (ui_type == FUI_Type::DROPDOWN || ui_type == FUI_Type::COMBOLIST)
+            animation_speed = speed;
+        else
+            std::cout << "Trying to set_animation_speed on wrong UI_TYPE\n";
+    }
+
+    const int FUI_Element::get_selected_item()
+    {
+        if (ui_type == FUI_Type::DROPDOWN)
+            return selected_element.first;
+        else std::cout << "Trying to get_selected_item on wrong UI_TYPE\n";
+
+        return -1;
+    }
+
+    void FUI_Element::set_default_item(const int& item)
+    {
+        if (ui_type == FUI_Type::DROPDOWN)
+        {
+            if (item > elements.size() - 1)
+                std::cout << "Trying to set a invalid default item (" << item << ")\n";
+            else
+            {
+                for (auto& element : elements)
+                {
+                    if (element.first == item)
+                    {
+                        if (selected_element.first != element.first)
+                            request_redraw();
+                        selected_element.first = element.first;
+                        selected_element.second = element.second.second;
+                    }
+                }
+            }
+        }
+        else
+            std::cout << "Trying to set_default_item to wrong UI_TYPE\n";
+    }
+
+    void FUI_Element::set_default_items(const std::vector<int>& items)
+    {
+        if (ui_type == FUI_Type::COMBOLIST)
+        {
+            for (auto& element : elements)
+            {
+                for (auto& item : items)
+                {
+                    if (item > elements.size() - 1)
+                        std::cout << "Trying to set a invalid default item (" << item << ")\n";
+                    else
+                    {
+                        bool found = false;
+                        int selected_id = 0;
+                        for (auto& e : selected_elements)
+                        {
+                            if (selected_id == item)
+                                found = true;
+                        }
+                        if (element.first == item && !found)
+                        {
+                            request_redraw();
+                            element.second.first = DropdownState::ACTIVE;
+                            selected_elements.emplace_back(std::make_pair(element.first, element.second.second));
+                        }
+                    }
+                }
+            }
+        }
+        else
+            std::cout << "Trying to set_default_item to wrong UI_TYPE\n";
+    }
+
+    void FUI_Element::set_max_display_items(const int amount)
+    {
+        if (ui_type == FUI_Type::DROPDOWN || ui_type == FUI_Type::COMBOLIST)
+        {
+            if (amount <= int(elements.size()) && amount != max_display_items)
+            {
+                max_display_items = amount;
+                request_redraw();
+            }
+        }
+        else
+            std::cout << "Trying to set_max_display_items on wrong UI_TYPE\n";
+    }
+
+    const std::vector<int> FUI_Element::get_selected_items()
+    {
+        if (ui_type == FUI_Type::COMBOLIST)
+        {
+            return_selected_items.clear();
+            for (auto& item : selected_elements)
+                return_selected_items.emplace_back(item.first);
+
+            return return_selected_items;
+        }
+        else
+            std::cout << "Trying to retrieve selected items on wrong UI_TYPE\n";
+
+        return return_selected_items;
+    }
+
+    const olc::vf2d FUI_Element::get_position()
+    {
+        return position;
+    }
+
+    const olc::vf2d FUI_Element::get_absolute_position()
+    {
+        if (container)
+            absolute_position = container->get_content_position();
+        else if (parent)
+            absolute_position = (parent->get_position() + olc::vf2d{ parent->get_border_thickness(), parent->get_top_border_thickness() });
+        else
+            absolute_position = olc::vf2d{ 0, 0 };
+        return absolute_position + position;
+    }
+
+    const olc::vf2d FUI_Element::get_content_position()
+    {
+        return get_absolute_position();
+    }
+
+    template <typename T>
+    void FUI_Element::set_slider_value(T value)
+    {
+        if (ui_type == FUI_Type::SLIDER)
+        {
+            float old_float = slider_value_float;
+            int old_int = slider_value_int;
+            switch (slider_type)
+            {
+            case type::FLOAT:
+                if (value > range.y)
+                    slider_value_float = range.y;
+                else if (value < range.x)
+                    slider_value_float = range.x;
+                else
+                    slider_value_float = value;
+                break;
+            case type::INT:
+                if (value > range.y)
+                    slider_value_int = range.y;
+                else if (value < range.x)
+                    slider_value_int = range.x;
+                else
+                    slider_value_int = value;
+                break;
+            }
+            if (slider_value_float != old_float || slider_value_int != old_int)
+                request_redraw();
+        }
+        else
+            std::cout << "Trying to set_slider_value on wrong UI_TYPE\n";
+    }
+
+    template <typename T>
+    const T FUI_Element::get_slider_value()
+    {
+        if (ui_type == FUI_Type::SLIDER)
+        {
+            switch (slider_type)
+            {
+            case type::FLOAT:
+                return T(slider_value_float);
+            case type::INT:
+                return T(slider_value_int);
+            }
+        }
+        else
+            std::cout << "Trying to get_slider_value on wrong UI_TYPE\n";
+
+        return T(-1);
+    }
+
+    const std::string FUI_Element::get_inputfield_value()
+    {
+        if (ui_type == FUI_Type::INPUTFIELD)
+            return inputfield_text;
+        else
+            std::cout << "Trying to get_inputfield_value on wrong UI_TYPE\n";
+
+        return "";
+    }
+
+    void FUI_Element::clear_inputfield_value()
+    {
+        if (ui_type == FUI_Type::INPUTFIELD)
+        {
+            clear_inputfield = true;
+            request_redraw();
+        }
+        else
+            std::cout << "Trying to clear_inputfield_value on wrong UI_TYPE\n";
+    }
+
+    void FUI_Element::set_inputfield_value(std::string value)
+    {
+        if (ui_type == FUI_Type::INPUTFIELD)
+        {
+            set_input_text = value;
+            request_redraw();
+        }
+        else
+            std::cout << "Trying to set_inputfield_value on wrong UI_TYPE\n";
+    }
+
+    void FUI_Element::mask_inputfield_value(bool state)
+    {
+        if (state != mask_inputfield)
+            request_redraw();
+        mask_inputfield = state;
+    }
+
+    olc::vf2d FUI_Element::get_text_size(olc::PixelGameEngine* pge)
+    {
+        return static_cast<olc::vf2d>(pge->GetTextSizeProp(text)) * text_scale;
+    }
+
+    void FUI_Element::add_texture(olc::Decal* txtr, std::vector<olc::vi2d> texture_pos, olc::vi2d s)
+    {
+        texture = txtr;
+        texture_positions = texture_pos;
+        texture_size = s;
+        request_redraw();
+
+        texture_scale = { static_cast<float>(size.x) / static_cast<float>(s.x), static_cast<float>(size.y) / static_cast<float>(s.y) };
+        size = { std::round(s.x * texture_scale.x), std::round(s.y * texture_scale.y) };
+        has_textures = true;
+
+        // warning messages
+        switch (ui_type)
+        {
+        case FUI_Type::BUTTON:
+            if (toggleable)
+            {
+                if (texture_positions.size() < 4)
+                    std::cout << "There's not enough sprites to cover all toggle button states\n";
+            }
+            else
+                if (texture_positions.size() < 3)
+                    std::cout << "There's not enough sprites to cover all button states\n";
+            break;
+        case FUI_Type::CHECKBOX:
+            if (texture_positions.size() < 4)
+                std::cout << "There's not enough sprites to cover all checkbox state\n";
+            break;
+        default:
+            break;
+        }
+    }
+
+    void FUI_Element::set_on_change(std::function<void()> cb, FUI_ChangePolicy policy, float interval)
+    {
+        switch (ui_type)
+        {
+        case FUI_Type::SLIDER:
+        case FUI_Type::CHECKBOX:
+        case FUI_Type::DROPDOWN:
+        case FUI_Type::COMBOLIST:
+        case FUI_Type::INPUTFIELD:
+            change_callback = cb;
+            change_policy = policy;
+            change_interval = interval;
+            value_changed = false;
+            change_pending = false;
+            break;
+        default:
+            std::cout << "Trying to set_on_change on wrong UI_TYPE\n";
+        }
+    }
+
+    void FUI_Element::dispatch_change(double now)
+    {
+        if (!change_callback)
+        {
+            value_changed = false;
+            return;
+        }
+
+        // coalesce every edit since the last dispatch into one pending event
+        if (value_changed)
+        {
+            value_changed = false;
+            change_pending = true;
+            last_edit_time = now;
+        }
+        if (!change_pending)
+            return;
+
+        bool fire = false;
+        switch (change_policy)
+        {
+        case FUI_ChangePolicy::IMMEDIATE:
+            fire = true;
+            break;
+        case FUI_ChangePolicy::THROTTLE:
+            fire = now - last_change_event >= change_interval;
+            break;
+        case FUI_ChangePolicy::DEBOUNCE:
+            fire = now - last_edit_time >= change_interval;
+            break;
+        case FUI_ChangePolicy::ON_RELEASE:
+            fire = !is_interacting();
+            break;
+        }
+
+        if (fire)
+        {
+            change_pending = false;
+            last_change_event = now;
+            emit(FUI_EventType::CHANGE);
+        }
+    }
+
+    const double FUI_Element::get_next_change()
+    {
+        if (!change_callback || !change_pending)
+            return std::numeric_limits<double>::infinity();
+        // a held back change event goes out on its own once its policy lets it
+        switch (change_policy)
+        {
+        case FUI_ChangePolicy::THROTTLE:
+            return last_change_event + change_interval;
+        case FUI_ChangePolicy::DEBOUNCE:
+            return last_edit_time + change_interval;
+        default:
+            return frame->time;
+        }
+    }
+
+    void FUI_Element::set_busy(bool state)
+    {
+        busy = state ? busy + 1 : std::max(0, busy - 1);
+    }
+
+    const bool FUI_Element::is_busy()
+    {
+        return busy > 0;
+    }
+
+    bool FUI_Element::update(olc::PixelGameEngine*)
+    {
+        // writes to the widget request a redraw themselves
+        if (binding && binding->sync())
+            emit(FUI_EventType::BINDING);
+        return false;
+    }
+
+    void FUI_Element::emit(FUI_EventType event)
+    {
+        // elements that aren't owned by a shared_ptr (like the console's inputfield) can't be queued
+        auto self = weak_from_this().lock();
+        if (event_bus && self)
+            event_bus->push(event, std::move(self));
+        else
+            run_event(event);
+    }
+
+    void FUI_Element::run_event(FUI_EventType event)
+    {
+        switch (event)
+        {
+        case FUI_EventType::CLICK:
+            if (callback)
+                callback();
+            break;
+        case FUI_EventType::ENTER:
+            if (input_enter_callback)
+                input_enter_callback();
+            break;
+        case FUI_EventType::CHANGE:
+            if (change_callback)
+                change_callback();
+            break;
+        case FUI_EventType::BINDING:
+            // the binding may have been dropped since
+            if (binding)
+                binding->notify();
+            break;
+        default:
+            break;
+        }
+    }
+
+    void FUI_Element::set_on_enter_callback(std::function<void()> callback)
+    {
+        if (ui_type == FUI_Type::INPUTFIELD)
+        {
+            input_enter_callback = callback;
+        }
+        else
+            std::cout << "Trying to set_on_enter_action on wrong UI_TYPE\n";
+    }
+
+    void FUI_Element::run_callback()
+    {
+        if (ui_type == FUI_Type::BUTTON)
+        {
+            callback();
+        }
+        else
+            std::cout << "Trying to run_callback on wrong UI_TYPE\n";
+    }
+
+    void FUI_Element::add_command_handler(std::function<void(std::string&, std::string*)> handler)
+    {
+        if (ui_type == FUI_Type::CONSOLE)
+            command_handler = handler;
+        else
+            std::cout << "Trying to add_command_handler to wrong UI_TYPE\n";
+    }
+
+    void FUI_Element::add_command_entry(std::string& entry)
+    {
+        if (ui_type == FUI_Type::CONSOLE)
+        {
+            command_entry = entry;
+            request_redraw();
+        }
+        else
+            std::cout << "Trying to add_command_entry to wrong UI_TYPE\n";
+    }
+
+    void FUI_Element::clear_console()
+    {
+        if (ui_type == FUI_Type::CONSOLE)
+        {
+            should_clear_console = true;
+            request_redraw();
+        }
+        else
+            std::cout << "Trying to clear_console on wrong UI_TYPE\n";
+    }
+
+    void FUI_Element::set_checkbox_state(bool state)
+    {
+        if (ui_type == FUI_Type::CHECKBOX)
+        {
+            if (state != checkbox_state)
+                request_redraw();
+            checkbox_state = state;
+        }
+        else
+            std::cout << "Trying to set_checkbox_state on wrong UI_TYPE\n";
+    }
+
+    const bool FUI_Element::get_checkbox_state()
+    {
+        if (ui_type == FUI_Type::CHECKBOX)
+            return checkbox_state;
+        else
+            std::cout << "Trying to get_checkbox_state on wrong UI_TYPE\n";
+
+        return false;
+    }
+
+    /*
+    ####################################################
+    #               FUI_LABEL START                    #
+    ####################################################
+    */
+    FUI_Label::FUI_Label(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p)
+    {
+        identifier = id;
+        parent = pt;
+        text = t;
+        position = p;
+        ui_type = FUI_Type::LABEL;
+    }
+
+    FUI_Label::FUI_Label(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p)
+    {
+        identifier = id;
+        parent = pt;
+        text = t;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::LABEL;
+    }
+
+    FUI_Label::FUI_Label(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p)
+    {
+        identifier = id;
+        text = t;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::LABEL;
+    }
+
+    FUI_Label::FUI_Label(const std::string& id, const std::string& t, olc::vi2d p)
+    {
+        identifier = id;
+        text = t;
+        position = p;
+        ui_type = FUI_Type::LABEL;
+    }
+
+    void FUI_Label::draw(olc::PixelGameEngine* pge)
+    {
+        // Adapt positioning depending on if there's a parent to the element or not
+        absolute_position = get_absolute_position();
+
+        pge->DrawStringPropDecal(absolute_position, text, text_color, text_scale);
+    }
+
+    /*
+    ####################################################
+    #               FUI_BUTTON START                   #
+    ####################################################
+    */
+    FUI_Button::FUI_Button(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s, std::function<void()> cb)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        parent = pt;
+        position = p;
+        callback = cb;
+        ui_type = FUI_Type::BUTTON;
+    }
+
+    FUI_Button::FUI_Button(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s, std::function<void()> cb)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        position = p;
+        callback = cb;
+        ui_type = FUI_Type::BUTTON;
+    }
+
+    FUI_Button::FUI_Button(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s, std::function<void()> cb)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        parent = pt;
+        position = p;
+        callback = cb;
+        group = g;
+        ui_type = FUI_Type::BUTTON;
+    }
+
+    FUI_Button::FUI_Button(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s, std::function<void()> cb)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        position = p;
+        callback = cb;
+        group = g;
+        ui_type = FUI_Type::BUTTON;
+    }
+
+    void FUI_Button::draw(olc::PixelGameEngine* pge)
+    {
+        absolute_position = get_absolute_position();
+
+        if (has_textures)
+        {
+            // Draw the body of the button
+            switch (state)
+            {
+            case State::NONE:
+                pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::NONE)], texture_size, texture_scale);
+                break;
+            case State::HOVER:
+                if (texture_positions.size() > 1)
+                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::HOVER)], texture_size, texture_scale);
+                else
+                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::NONE)], texture_size, texture_scale);
+                break;
+            case State::CLICK:
+                if (texture_positions.size() > 2)
+                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::CLICK)], texture_size, texture_scale);
+                else
+                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::NONE)], texture_size, texture_scale);
+                break;
+            case State::ACTIVE:
+                if (texture_positions.size() > 3)
+                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::CLICK)], texture_size, texture_scale);
+                else
+                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::NONE)], texture_size, texture_scale);
+                break;
+            }
+        }
+        else
+        {
+            auto text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(text))* text_scale;
+
+            // Draw the body of the button
+            switch (state)
+            {
+            case State::NONE:
+                pge->FillRectDecal(absolute_position, size, color_scheme.button_normal);
+                break;
+            case State::HOVER:
+                pge->FillRectDecal(absolute_position, size, color_scheme.button_hover);
+                break;
+            case State::CLICK:
+                pge->FillRectDecal(absolute_position, size, color_scheme.button_click);
+                break;
+            case State::ACTIVE:
+                pge->FillRectDecal(absolute_position, size, color_scheme.button_active);
+                break;
+            }
+            // Draw the text
+            olc::vf2d text_position = olc::vf2d{ absolute_position.x + (size.x / 2) - (text_size.x / 2),
+                absolute_position.y + (size.y / 2) - (text_size.y / 2) };
+            pge->DrawStringPropDecal(text_position, text, text_color, text_scale);
+        }
+
+        if (busy > 0)
+            pge->FillRectDecal(absolute_position, size, color_scheme.busy_overlay);
+    }
+
+    void FUI_Button::input(olc::PixelGameEngine*)
+    {
+        if (busy > 0)
+        {
+            state = State::NONE;
+            return;
+        }
+
+        if (!toggleable)
+        {
+            if (frame->mouse_position.x >= absolute_position.x &&
+                frame->mouse_position.x <= absolute_position.x + size.x &&
+                frame->mouse_position.y >= absolute_position.y &&
+                frame->mouse_position.y <= absolute_position.y + size.y)
+            {
+                if (frame->get_mouse(0).bPressed)
+                    state = State::CLICK;
+                else if (frame->get_mouse(0).bReleased && state == State::CLICK)
+                {
+                    emit(FUI_EventType::CLICK);
+                    state = State::HOVER;
+                }
+
+                if (state != State::CLICK)
+                    state = State::HOVER;
+            }
+            else
+                state = State::NONE;
+        }
+        else
+        {
+            if (frame->mouse_position.x >= absolute_position.x &&
+                frame->mouse_position.x <= absolute_position.x + size.x &&
+                frame->mouse_position.y >= absolute_position.y &&
+                frame->mouse_position.y <= absolute_position.y + size.y)
+            {
+                if (frame->get_mouse(0).bPressed)
+                {
+                    if (state == State::ACTIVE)
+                        was_active = true;
+
+                    state = State::CLICK;
+                }
+                else if (frame->get_mouse(0).bReleased && state == State::CLICK)
+                {
+                    if (was_active)
+                    {
+                        state = State::HOVER;
+                        was_active = false;
+                    }
+                    else
+                        state = State::ACTIVE;
+                }
+
+                if (state != State::CLICK && state != State::ACTIVE)
+                    state = State::HOVER;
+            }
+            else if (state == State::CLICK && was_active)
+                state = State::ACTIVE;
+            else if (state != State::ACTIVE)
+                state = State::NONE;
+
+            if (state == State::ACTIVE)
+                button_state = true;
+            else
+                button_state = false;
+        }
+    }
+
+    /*
+    ####################################################
+    #               FUI_CHECKBOX START                 #
+    ####################################################
+    */
+    FUI_Checkbox::FUI_Checkbox(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        parent = pt;
+        position = p;
+        ui_type = FUI_Type::CHECKBOX;
+    }
+
+    FUI_Checkbox::FUI_Checkbox(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        position = p;
+        ui_type = FUI_Type::CHECKBOX;
+    }
+
+    FUI_Checkbox::FUI_Checkbox(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        parent = pt;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::CHECKBOX;
+    }
+
+    FUI_Checkbox::FUI_Checkbox(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::CHECKBOX;
+    }
+
+    void FUI_Checkbox::draw(olc::PixelGameEngine* pge)
+    {
+        absolute_position = get_absolute_position();
+
+        // Draw the text
+        auto text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(text))* text_scale;
+        auto text_position = olc::vf2d{ absolute_position.x - text_size.x, absolute_position.y + (size.y / 2) - (text_size.y / 2) };
+
+        if (!has_textures)
+        {
+            pge->FillRectDecal(absolute_position, size, color_scheme.checkbox_normal);
+            pge->DrawStringPropDecal(text_position, text, text_color, text_scale);
+        }
+        olc::vf2d checkbox_filling = olc::vf2d{ 1.0f, 1.0f };
+        // Draw the body of the checkbox
+        if (has_textures)
+        {
+            switch (state)
+            {
+            case State::NONE:
+                pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::NONE)], texture_size, texture_scale);
+                break;
+            case State::HOVER:
+                if (texture_positions.size() > 1)
+                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::HOVER)], texture_size, texture_scale);
+                else
+                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::NONE)], texture_size, texture_scale);
+                break;
+            case State::CLICK:
+                if (texture_positions.size() > 2)
+                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::CLICK)], texture_size, texture_scale);
+                else
+                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::NONE)], texture_size, texture_scale);
+                break;
+            case State::ACTIVE:
+                if (texture_positions.size() > 3)
+                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::CLICK)], texture_size, texture_scale);
+                else
+                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::NONE)], texture_size, texture_scale);
+                break;
+            }
+        }
+        else
+        {
+            switch (state)
+            {
+            case State::NONE:
+                break;
+            case State::HOVER:
+                pge->FillRectDecal(absolute_position + checkbox_filling,
+                    { static_cast<float>(size.x) - 2.0f, static_cast<float>(size.y) - 2.0f }, color_scheme.checkbox_hover);
+                break;
+            case State::CLICK:
+                pge->FillRectDecal(absolute_position + checkbox_filling,
+                    { static_cast<float>(size.x) - 2.0f, static_cast<float>(size.y) - 2.0f }, color_scheme.checkbox_click);
+                break;
+            case State::ACTIVE:
+                pge->FillRectDecal(absolute_position + checkbox_filling,
+                    { static_cast<float>(size.x) - 2.0f, static_cast<float>(size.y) - 2.0f }, color_scheme.checkbox_active);
+                break;
+            }
+        }
+    }
+
+    void FUI_Checkbox::input(olc::PixelGameEngine*)
+    {
+        // pick up changes made through set_checkbox_state
+        if (state != State::CLICK && checkbox_state != (state == State::ACTIVE))
+            state = checkbox_state ? State::ACTIVE : State::NONE;
+
+        if (frame->mouse_position.x >= absolute_position.x &&
+            frame->mouse_position.x <= absolute_position.x + size.x &&
+            frame->mouse_position.y >= absolute_position.y &&
+            frame->mouse_position.y <= absolute_position.y + size.y)
+        {
+            if (frame->get_mouse(0).bPressed)
+            {
+                if (state == State::ACTIVE)
+                    was_active = true;
+
+                state = State::CLICK;
+            }
+            else if (frame->get_mouse(0).bReleased && state == State::CLICK)
+            {
+                if (was_active)
+                {
+                    state = State::HOVER;
+                    was_active = false;
+                }
+                else
+                    state = State::ACTIVE;
+            }
+
+            if (state != State::CLICK && state != State::ACTIVE)
+                state = State::HOVER;
+        }
+        else if (state == State::CLICK && was_active)
+            state = State::ACTIVE;
+        else if (state != State::ACTIVE)
+            state = State::NONE;
+
+        if (checkbox_state != (state == State::ACTIVE))
+            value_changed = true;
+        checkbox_state = state == State::ACTIVE;
+    }
+
+    /*
+    ####################################################
+    #               FUI_DROPDOWN START                 #
+    ####################################################
+    */
+    FUI_Dropdown::FUI_Dropdown(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        parent = pt;
+        position = p;
+        ui_type = FUI_Type::DROPDOWN;
+    }
+
+    FUI_Dropdown::FUI_Dropdown(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        position = p;
+        ui_type = FUI_Type::DROPDOWN;
+    }
+
+    FUI_Dropdown::FUI_Dropdown(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        parent = pt;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::DROPDOWN;
+    }
+
+    FUI_Dropdown::FUI_Dropdown(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::DROPDOWN;
+    }
+
+    void FUI_Dropdown::update_open_animation()
+    {
+        float future_y = 0.f;
+        if (is_open)
+            future_y = size.y * (max_display_items > 0 ? max_display_items : elements.size());
+        if (active_size.y != future_y)
+            animate(&active_size.y, future_y, animation_speed);
+    }
+
+    void FUI_Dropdown::draw(olc::PixelGameEngine* pge)
+    {
+        absolute_position = get_absolute_position();
+
+        auto title_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(text))* text_scale;
+
+        update_open_animation();
+
+        // title position
+        olc::vf2d text_position = olc::vf2d{ absolute_position.x - title_text_size.x,
+            absolute_position.y + (size.y / 2) - (title_text_size.y / 2) };
+        pge->DrawStringPropDecal(text_position, text, text_color, text_scale);
+
+        switch (state)
+        {
+        case DropdownState::NONE:
+            pge->FillRectDecal(absolute_position, size, color_scheme.dropdown_normal);
+            break;
+        case DropdownState::HOVER:
+            pge->FillRectDecal(absolute_position, size, color_scheme.dropdown_hover);
+            break;
+        case DropdownState::ACTIVE:
+            pge->FillRectDecal(absolute_position, size, color_scheme.dropdown_active);
+            break;
+        }
+        if (active_size.y != size.y * elements.size())
+            pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y }, olc::vf2d{ size.x, active_size.y }, color_scheme.dropdown_normal);
+
+        if (!selected_element.second.second.empty())
+        {
+            auto element_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(selected_element.second.second))* selected_element.second.first;
+            text_position = olc::vf2d{ absolute_position.x + (size.x / 2) - (element_text_size.x / 2),
+                absolute_position.y + (size.y / 2) - (element_text_size.y / 2) };
+            pge->DrawStringPropDecal(text_position, selected_element.second.second, text_color, selected_element.second.first);
+        }
+
+        if (max_display_items > 0 && max_display_items < elements.size())
+        {
+            int i = 1;
+            for (int j = item_start_index - 1; j < item_start_index + max_display_items - 1; j++)
+            {
+                auto element_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(elements[j].second.second.second))* elements[j].second.second.first;
+                if (active_size.y >= size.y * i)
+                {
+                    switch (elements[j].second.first)
+                    {
+                    case DropdownState::NONE:
+                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.dropdown_normal);
+                        break;
+                    case DropdownState::HOVER:
+                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.dropdown_hover);
+                        break;
+                    case DropdownState::ACTIVE:
+                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.dropdown_active);
+                        break;
+                    }
+                }
+                text_position = olc::vf2d{ absolute_position.x + (size.x / 2) - (element_text_size.x / 2),
+                    absolute_position.y + size.y + (size.y * i) - (size.y / 2) - (element_text_size.y / 2) };
+                if (absolute_position.y + size.y + active_size.y > text_position.y + element_text_size.y)
+                    pge->DrawStringPropDecal(text_position, elements[j].second.second.second, text_color, elements[j].second.second.first);
+
+                i++;
+            }
+
+            if (is_open && (max_display_items < elements.size()))
+            {
+                float scroll_size = (size.y + active_size.y) / (elements.size() - max_display_items);
+                float scroll_y_pos = ((item_start_index - 1) * scroll_size);
+                scroll_y_pos = scroll_y_pos - (scroll_y_pos / (elements.size() - max_display_items));
+
+                pge->FillRectDecal({ absolute_position.x + size.x - 3, absolute_position.y + scroll_y_pos },
+                    { 3, scroll_size }, color_scheme.scroll_indicator);
+
+            }
+        }
+        else
+        {
+            int i = 1;
+            for (auto& element : elements)
+            {
+                auto element_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(element.second.second.second))* element.second.second.first;
+                if (active_size.y >= size.y * i)
+                {
+                    switch (element.second.first)
+                    {
+                    case DropdownState::NONE:
+                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.dropdown_normal);
+                        break;
+                    case DropdownState::HOVER:
+                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.dropdown_hover);
+                        break;
+                    case DropdownState::ACTIVE:
+                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.dropdown_active);
+                        break;
+                    }
+                }
+                text_position = olc::vf2d{ absolute_position.x + (size.x / 2) - (element_text_size.x / 2),
+                    absolute_position.y + size.y + (size.y * i) - (size.y / 2) - (element_text_size.y / 2) };
+                if (absolute_position.y + size.y + active_size.y > text_position.y + element_text_size.y)
+                    pge->DrawStringPropDecal(text_position, element.second.second.second, text_color, element.second.second.first);
+
+                i++;
+            }
+        }
+    }
+
+    void FUI_Dropdown::input(olc::PixelGameEngine*)
+    {
+        bool could_close = false;
+        if (frame->mouse_position.x >= absolute_position.x &&
+            frame->mouse_position.x <= absolute_position.x + size.x &&
+            frame->mouse_position.y >= absolute_position.y &&
+            frame->mouse_position.y <= absolute_position.y + size.y)
+        {
+            if (frame->get_mouse(1).bPressed)
+                selected_element.second.second.clear();
+
+            if (frame->get_mouse(0).bPressed)
+                state = DropdownState::ACTIVE;
+            else if (frame->get_mouse(0).bReleased && state == DropdownState::ACTIVE)
+            {
+                is_open = !is_open;
+                state = DropdownState::HOVER;
+            }
+
+            if (state != DropdownState::ACTIVE)
+                state = DropdownState::HOVER;
+        }
+        else
+        {
+            state = DropdownState::NONE;
+            int element_amount;
+            if (max_display_items > 0)
+                element_amount = max_display_items;
+            else
+                element_amount = elements.size();
+            if (!(frame->mouse_position.x >= absolute_position.x &&
+                frame->mouse_position.x <= absolute_position.x + size.x &&
+                frame->mouse_position.y >= absolute_position.y &&
+                frame->mouse_position.y <= absolute_position.y + size.y + (size.y * element_amount)))
+            {
+                if (frame->get_mouse(0).bPressed)
+                    could_close = true;
+            }
+        }
+
+
+        if (is_open)
+        {
+            if (max_display_items > 0 && max_display_items < elements.size()) // if we have a max display limit we want to run a slightly different method of checking input
+            {
+                int i = 1;
+                for (int j = item_start_index - 1; j < item_start_index + max_display_items - 1; j++)
+                {
+                    if (frame->mouse_position.x >= absolute_position.x &&
+                        frame->mouse_position.x <= absolute_position.x + size.x &&
+                        frame->mouse_position.y > absolute_position.y + (size.y * i) &&
+                        frame->mouse_position.y < absolute_position.y + (size.y * i) + size.y)
+                    {
+                        if (frame->get_mouse(0).bPressed)
+                            elements[j].second.first = DropdownState::ACTIVE;
+                        else if (frame->get_mouse(0).bReleased && elements[j].second.first == DropdownState::ACTIVE)
+                        {
+                            selected_element.first = elements[j].first;
+                            selected_element.second = elements[j].second.second;
+                            value_changed = true;
+                            elements[j].second.first = DropdownState::HOVER;
+                            is_open = false;
+                        }
+                        else if (elements[j].second.first != DropdownState::ACTIVE)
+                            elements[j].second.first = DropdownState::HOVER;
+                    }
+                    else
+                    {
+                        elements[j].second.first = DropdownState::NONE;
+                        if (could_close && frame->get_mouse(0).bPressed)
+                            is_open = false;
+                    }
+                    i++;
+                }
+                if (frame->mouse_position.x >= absolute_position.x &&
+                    frame->mouse_position.x <= absolute_position.x + size.x &&
+                    frame->mouse_position.y >= absolute_position.y &&
+                    frame->mouse_position.y <= absolute_position.y + size.y + active_size.y)
+                {
+                    if (elements.size() > max_display_items)
+                    {
+                        if (frame->mouse_wheel > 0)
+                        {
+                            if (item_start_index > 1)
+                                item_start_index--;
+                        }
+                        else if (frame->mouse_wheel < 0)
+                        {
+                            if (item_start_index < (elements.size() - max_display_items + 1))
+                                item_start_index++;
+                        }
+                    }
+                }
+            }
+            else // if we don't have any max display limit
+            {
+                int i = 1;
+                for (auto& element : elements)
+                {
+                    if (frame->mouse_position.x >= absolute_position.x &&
+                        frame->mouse_position.x <= absolute_position.x + size.x &&
+                        frame->mouse_position.y > absolute_position.y + (size.y * i) &&
+                        frame->mouse_position.y < absolute_position.y + (size.y * i) + size.y)
+                    {
+                        if (frame->get_mouse(0).bPressed)
+                            element.second.first = DropdownState::ACTIVE;
+                        else if (frame->get_mouse(0).bReleased && element.second.first == DropdownState::ACTIVE)
+                        {
+                            selected_element.first = element.first;
+                            selected_element.second = element.second.second;
+                            value_changed = true;
+                            element.second.first = DropdownState::HOVER;
+                            is_open = false;
+                        }
+                        else if (element.second.first != DropdownState::ACTIVE)
+                            element.second.first = DropdownState::HOVER;
+                    }
+                    else
+                    {
+                        element.second.first = DropdownState::NONE;
+                        if (could_close && frame->get_mouse(0).bPressed)
+                            is_open = false;
+                    }
+                    i++;
+                }
+            }
+        }
+
+        if (is_open)
+            is_focused = true;
+        else
+            is_focused = false;
+
+        update_open_animation();
+    }
+
+    /*
+    ####################################################
+    #               FUI_COMBOLIST START                #
+    ####################################################
+    */
+    FUI_Combolist::FUI_Combolist(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        parent = pt;
+        position = p;
+        ui_type = FUI_Type::COMBOLIST;
+    }
+
+    FUI_Combolist::FUI_Combolist(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        position = p;
+        ui_type = FUI_Type::COMBOLIST;
+    }
+
+    FUI_Combolist::FUI_Combolist(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        parent = pt;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::COMBOLIST;
+    }
+
+    FUI_Combolist::FUI_Combolist(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::COMBOLIST;
+    }
+
+    void FUI_Combolist::update_open_animation()
+    {
+        float future_y = 0.f;
+        if (is_open)
+            future_y = size.y * (max_display_items > 0 ? max_display_items : elements.size());
+        if (active_size.y != future_y)
+            animate(&active_size.y, future_y, animation_speed);
+    }
+
+    void FUI_Combolist::draw(olc::PixelGameEngine* pge)
+    {
+        absolute_position = get_absolute_position();
+        auto title_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(text))* text_scale;
+
+        update_open_animation();
+
+        // title position
+        olc::vf2d text_position = olc::vf2d{ absolute_position.x - title_text_size.x,
+            absolute_position.y + (size.y / 2) - (title_text_size.y / 2) };
+        pge->DrawStringPropDecal(text_position, text, text_color, text_scale);
+
+        switch (state)
+        {
+        case DropdownState::NONE:
+            pge->FillRectDecal(absolute_position, size, color_scheme.dropdown_normal);
+            break;
+        case DropdownState::HOVER:
+            pge->FillRectDecal(absolute_position, size, color_scheme.dropdown_hover);
+            break;
+        }
+        if (active_size.y != size.y * elements.size())
+            pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y }, olc::vf2d{ size.x, active_size.y }, color_scheme.dropdown_normal);
+
+        if (selected_elements.size() > 1)
+        {
+            std::string temp_text = selected_elements[0].second.second + ", ...";
+            auto element_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(temp_text))* selected_elements[0].second.first;
+
+            text_position = olc::vf2d{ absolute_position.x + (size.x / 2) - (element_text_size.x / 2),
+                absolute_position.y + (size.y / 2) - (element_text_size.y / 2) };
+            pge->DrawStringPropDecal(text_position, temp_text, text_color, selected_elements[0].second.first);
+        }
+        else if (selected_elements.size() > 0)
+        {
+            auto element_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(selected_elements[0].second.second))* selected_elements[0].second.first;
+
+            text_position = olc::vf2d{ absolute_position.x + (size.x / 2) - (element_text_size.x / 2),
+                absolute_position.y + (size.y / 2) - (element_text_size.y / 2) };
+            pge->DrawStringPropDecal(text_position, selected_elements[0].second.second, text_color, selected_elements[0].second.first);
+        }
+
+        if (max_display_items > 0 && max_display_items < elements.size())
+        {
+            int i = 1;
+            for (int j = item_start_index - 1; j < item_start_index + max_display_items - 1; j++)
+            {
+                auto element_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(elements[j].second.second.second))* elements[j].second.second.first;
+                if (active_size.y >= size.y * i)
+                {
+                    switch (elements[j].second.first)
+                    {
+                    case DropdownState::NONE:
+                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.combolist_normal);
+                        break;
+                    case DropdownState::HOVER:
+                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.combolist_hover);
+                        break;
+                    case DropdownState::ACTIVE:
+                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.combolist_active);
+                        break;
+                    }
+                }
+                text_position = olc::vf2d{ absolute_position.x + (size.x / 2) - (element_text_size.x / 2),
+                    absolute_position.y + size.y + (size.y * i) - (size.y / 2) - (element_text_size.y / 2) };
+                if (absolute_position.y + size.y + active_size.y > text_position.y + element_text_size.y)
+                    pge->DrawStringPropDecal(text_position, elements[j].second.second.second, text_color, elements[j].second.second.first);
+                i++;
+            }
+
+            if (is_open && (max_display_items < elements.size()))
+            {
+                float scroll_size = (size.y + active_size.y) / (elements.size() - max_display_items);
+                float scroll_y_pos = ((item_start_index - 1) * scroll_size);
+                scroll_y_pos = scroll_y_pos - (scroll_y_pos / (elements.size() - max_display_items));
+
+                pge->FillRectDecal({ absolute_position.x + size.x - 3, absolute_position.y + scroll_y_pos },
+                    { 3, scroll_size }, color_scheme.scroll_indicator);
+            }
+        }
+        else
+        {
+            int i = 1;
+            for (auto& element : elements)
+            {
+                auto element_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(element.second.second.second))* element.second.second.first;
+                if (active_size.y >= size.y * i)
+                {
+                    switch (element.second.first)
+                    {
+                    case DropdownState::NONE:
+                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.combolist_normal);
+                        break;
+                    case DropdownState::HOVER:
+                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.combolist_hover);
+                        break;
+                    case DropdownState::ACTIVE:
+                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.combolist_active);
+                        break;
+                    }
+                }
+                text_position = olc::vf2d{ absolute_position.x + (size.x / 2) - (element_text_size.x / 2),
+                    absolute_position.y + size.y + (size.y * i) - (size.y / 2) - (element_text_size.y / 2) };
+                if (absolute_position.y + size.y + active_size.y > text_position.y + element_text_size.y)
+                    pge->DrawStringPropDecal(text_position, element.second.second.second, text_color, element.second.second.first);
+                i++;
+            }
+        }
+    }
+
+    void FUI_Combolist::input(olc::PixelGameEngine*)
+    {
+        if (frame->mouse_position.x >= absolute_position.x &&
+            frame->mouse_position.x <= absolute_position.x + size.x &&
+            frame->mouse_position.y >= absolute_position.y &&
+            frame->mouse_position.y <= absolute_position.y + size.y)
+        {
+            if (frame->get_mouse(1).bPressed)
+            {
+                if (!selected_elements.empty())
+                    value_changed = true;
+                selected_elements.clear();
+                for (auto& element : elements)
+                    element.second.first = DropdownState::NONE;
+            }
+
+            if (frame->get_mouse(0).bPressed)
+            {
+                if (is_open)
+                    is_open = false;
+                else
+                    is_open = true;
+            }
+            else
+                state = DropdownState::HOVER;
+        }
+        else
+            state = DropdownState::NONE;
+
+
+        if (is_open)
+        {
+            if (max_display_items > 0 && max_display_items < elements.size()) // if we have a max display limit we want to run a slightly different method of checking input
+            {
+                int i = 1;
+                for (int j = item_start_index - 1; j < item_start_index + max_display_items - 1; j++)
+                {
+                    if (frame->mouse_position.x >= absolute_position.x &&
+                        frame->mouse_position.x <= absolute_position.x + size.x &&
+                        frame->mouse_position.y > absolute_position.y + (size.y * i) &&
+                        frame->mouse_position.y < absolute_position.y + (size.y * i) + size.y)
+                    {
+                        if (frame->get_mouse(0).bPressed)
+                        {
+                            bool did_find_element = false;
+                            for (auto& sel_element : selected_elements)
+                            {
+                                if (sel_element.first == elements[j].first)
+                                {
+                                    did_find_element = true;
+                                    int v = 0;
+                                    for (auto& el : selected_elements)
+                                    {
+                                        if (el.first == elements[j].first)
+                                        {
+                                            elements[j].second.first = DropdownState::NONE;
+                                            selected_elements.erase(selected_elements.begin() + v);
+                                            value_changed = true;
+                                            break;
+                                        }
+                                        v++;
+                                    }
+                                    break;
+                                }
+                            }
+                            if (!did_find_element)
+                            {
+                                elements[j].second.first = DropdownState::ACTIVE;
+                                selected_elements.emplace_back(std::make_pair(elements[j].first, elements[j].second.second));
+                                value_changed = true;
+                            }
+                        }
+                        else if (elements[j].second.first != DropdownState::ACTIVE)
+                            elements[j].second.first = DropdownState::HOVER;
+                    }
+                    else if (elements[j].second.first != DropdownState::ACTIVE)
+                        elements[j].second.first = DropdownState::NONE;
+                    i++;
+                }
+                if (frame->mouse_position.x >= absolute_position.x &&
+                    frame->mouse_position.x <= absolute_position.x + size.x &&
+                    frame->mouse_position.y >= absolute_position.y &&
+                    frame->mouse_position.y <= absolute_position.y + size.y + active_size.y)
+                {
+                    if (elements.size() > max_display_items)
+                    {
+                        if (frame->mouse_wheel > 0)
+                        {
+                            if (item_start_index > 1)
+                                item_start_index--;
+                        }
+                        else if (frame->mouse_wheel < 0)
+                        {
+                            if (item_start_index < (elements.size() - max_display_items + 1))
+                                item_start_index++;
+                        }
+                    }
+                }
+            }
+            else // if we don't have any max display limit
+            {
+                int i = 1;
+                for (auto& element : elements)
+                {
+                    if (frame->mouse_position.x >= absolute_position.x &&
+                        frame->mouse_position.x <= absolute_position.x + size.x &&
+                        frame->mouse_position.y > absolute_position.y + (size.y * i) &&
+                        frame->mouse_position.y < absolute_position.y + (size.y * i) + size.y)
+                    {
+                        if (frame->get_mouse(0).bPressed)
+                        {
+                            bool did_find_element = false;
+                            for (auto& sel_element : selected_elements)
+                            {
+                                if (sel_element.first == element.first)
+                                {
+                                    did_find_element = true;
+                                    int j = 0;
+                                    for (auto& el : selected_elements)
+                                    {
+                                        if (el.first == element.first)
+                                        {
+                                            element.second.first = DropdownState::NONE;
+                                            selected_elements.erase(selected_elements.begin() + j);
+                                            value_changed = true;
+                                            break;
+                                        }
+                                        j++;
+                                    }
+                                    break;
+                                }
+                            }
+                            if (!did_find_element)
+                            {
+                                element.second.first = DropdownState::ACTIVE;
+                                selected_elements.emplace_back(std::make_pair(element.first, element.second.second));
+                                value_changed = true;
+                            }
+                        }
+                        else if (element.second.first != DropdownState::ACTIVE)
+                            element.second.first = DropdownState::HOVER;
+                    }
+                    else if (element.second.first != DropdownState::ACTIVE)
+                        element.second.first = DropdownState::NONE;
+                    i++;
+                }
+            }
+        }
+
+        if (!(frame->mouse_position.x >= absolute_position.x &&
+            frame->mouse_position.x <= absolute_position.x + size.x &&
+            frame->mouse_position.y >= absolute_position.y &&
+            frame->mouse_position.y <= absolute_position.y + size.y + active_size.y) && frame->get_mouse(0).bPressed)
+            is_open = false;
+
+        if (is_open)
+            is_focused = true;
+        else
+            is_focused = false;
+
+        update_open_animation();
+    }
+
+    /*
+    ####################################################
+    #               FUI_GROUPBOX START                 #
+    ####################################################
+    */
+    FUI_Groupbox::FUI_Groupbox(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        parent = pt;
+        position = p;
+        ui_type = FUI_Type::GROUPBOX;
+    }
+
+    FUI_Groupbox::FUI_Groupbox(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        position = p;
+        ui_type = FUI_Type::GROUPBOX;
+    }
+
+    FUI_Groupbox::FUI_Groupbox(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        parent = pt;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::GROUPBOX;
+    }
+
+    FUI_Groupbox::FUI_Groupbox(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::GROUPBOX;
+    }
+
+    void FUI_Groupbox::draw(olc::PixelGameEngine* pge)
+    {
+        absolute_position = get_absolute_position();
+        auto text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(text))* text_scale;
+
+        pge->FillRectDecal(absolute_position, size, color_scheme.groupbox_background);
+
+        // top left outline
+        pge->FillRectDecal(absolute_position, olc::vf2d{ (size.x / 2) - (text_size.x / 2), 1.f }, color_scheme.groupbox_outline);
+        // top right outline
+        pge->FillRectDecal(olc::vf2d{ absolute_position.x + (size.x / 2) + (text_size.x / 2), absolute_position.y },
+            olc::vf2d{ size.x - (size.x / 2) - (text_size.x / 2), 1.f }, color_scheme.groupbox_outline);
+
+        // left outline
+        pge->FillRectDecal(absolute_position, olc::vf2d{ 1, size.y }, color_scheme.groupbox_outline);
+        // right outline
+        pge->FillRectDecal(olc::vf2d{ absolute_position.x + size.x - 1, absolute_position.y }, olc::vf2d{ 1.f, size.y }, color_scheme.groupbox_outline);
+        // bottom outline
+        pge->FillRectDecal(olc::vf2d{ absolute_position.x, absolute_position.y + size.y - 1 }, olc::vf2d{ size.x + 1.f, 1.f }, color_scheme.groupbox_outline);
+
+        pge->DrawStringPropDecal(olc::vf2d{ absolute_position.x + (size.x / 2) - (text_size.x / 2), absolute_position.y - (text_size.y / 2) }, text, text_color);
+
+    }
+
+    /*
+    ####################################################
+    #               FUI_SLIDER START                   #
+    ####################################################
+    */
+    FUI_Slider::FUI_Slider(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s, olc::vf2d r, FUI_Slider::type s_type)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        parent = pt;
+        position = p;
+        range = r;
+        slider_type = s_type;
+        ui_type = FUI_Type::SLIDER;
+    }
+
+    FUI_Slider::FUI_Slider(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s, olc::vf2d r, FUI_Slider::type s_type)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        position = p;
+        range = r;
+        slider_type = s_type;
+        ui_type = FUI_Type::SLIDER;
+    }
+
+    FUI_Slider::FUI_Slider(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s, olc::vf2d r, FUI_Slider::type s_type)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        parent = pt;
+        position = p;
+        group = g;
+        range = r;
+        slider_type = s_type;
+        ui_type = FUI_Type::SLIDER;
+    }
+
+    FUI_Slider::FUI_Slider(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s, olc::vf2d r, FUI_Slider::type s_type)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        position = p;
+        group = g;
+        range = r;
+        slider_type = s_type;
+        ui_type = FUI_Type::SLIDER;
+    }
+
+    //////
+
+    FUI_Slider::FUI_Slider(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s, olc::vi2d r, FUI_Slider::type s_type)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        parent = pt;
+        position = p;
+        range = r;
+        slider_type = s_type;
+        ui_type = FUI_Type::SLIDER;
+    }
+
+    FUI_Slider::FUI_Slider(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s, olc::vi2d r, FUI_Slider::type s_type)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        position = p;
+        range = r;
+        slider_type = s_type;
+        ui_type = FUI_Type::SLIDER;
+    }
+
+    FUI_Slider::FUI_Slider(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s, olc::vi2d r, FUI_Slider::type s_type)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        parent = pt;
+        position = p;
+        group = g;
+        range = r;
+        slider_type = s_type;
+        ui_type = FUI_Type::SLIDER;
+    }
+
+    FUI_Slider::FUI_Slider(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s, olc::vi2d r, FUI_Slider::type s_type)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        position = p;
+        group = g;
+        range = r;
+        slider_type = s_type;
+        ui_type = FUI_Type::SLIDER;
+    }
+
+    void FUI_Slider::draw(olc::PixelGameEngine* pge)
+    {
+        absolute_position = get_absolute_position();
+
+        // start with the value of the value_holder else set value to minimum in range, the ratio keeps
+        // following the value while it isn't dragged so set_slider_value shows up
+        if (run_once || state != State::ACTIVE)
+        {
+            // check if there's negative values in the range
+            if (range.x < 0)
+                has_negative = true;
+            switch (slider_type)
+            {
+            case type::FLOAT:
+                if (slider_value_float < range.x)
+                    slider_value_float = range.x;
+                else
+
+                if (has_negative)
+                {
+                    if (slider_value_float < 0.0f)
+                        slider_ratio = (1.0f - (slider_value_float / range.x)) * 0.5;
+                    else if (slider_value_float > 0.0f)
+                        slider_ratio = (1.0f + (slider_value_float / range.y)) * 0.5;
+                    else
+                        slider_ratio = 0.5f;
+                }
+                else
+                    slider_ratio = slider_value_float / range.y;
+                break;
+            case type::INT:
+                if (slider_value_int < range.x)
+                    slider_value_int = range.x;
+
+                if (has_negative)
+                {
+                    if (slider_value_int < 0)
+                        slider_ratio = (1.0f - (slider_value_int / range.x)) * 0.5;
+                    else if (slider_value_int > 0)
+                        slider_ratio = (1.0f + (slider_value_int / range.y)) * 0.5;
+                    else
+                        slider_ratio = 0.5f;
+                }
+                else
+                    slider_ratio = slider_value_int / range.y;
+                break;
+            }
+
+            run_once = false;
+        }
+
+        // draw title with slider value, the value text is only formatted and measured when the value changed
+        bool value_changed_text = slider_type == type::FLOAT ? value_text.set(slider_value_float, 2) : value_text.set(int64_t(slider_value_int));
+        if (value_changed_text || value_text_scale != text_scale)
+        {
+            value_text_scale = text_scale;
+            value_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(value_text.get())) * text_scale;
+        }
+
+        auto text_size_title = static_cast<olc::vf2d>(pge->GetTextSizeProp(text))* text_scale;
+        pge->DrawStringPropDecal(olc::vf2d{ absolute_position.x - text_size_title.x, absolute_position.y + (size.y / 2) - (text_size_title.y / 2) + 1 }, text, text_color);
+        // draw slider body
+        switch (state)
+        {
+        case State::NONE:
+            pge->FillRectDecal(absolute_position, olc::vf2d{ size.x * slider_ratio, size.y }, color_scheme.slider_normal);
+            break;
+        case State::HOVER:
+            pge->FillRectDecal(absolute_position, olc::vf2d{ size.x * slider_ratio, size.y }, color_scheme.slider_hover);
+            break;
+        case State::ACTIVE:
+            pge->FillRectDecal(absolute_position, olc::vf2d{ size.x * slider_ratio, size.y }, color_scheme.slider_hover);
+            break;
+        }
+
+        // Draw text ontop of the slider body
+        pge->DrawStringPropDecal(olc::vf2d{ absolute_position.x + size.x / 2 - value_text_size.x / 2, absolute_position.y + (size.y / 2) - (value_text_size.y / 2) + 1 }, value_text.get(), text_color);
+
+        // top left outline
+        pge->FillRectDecal(absolute_position, olc::vf2d{ size.x, 1.f }, color_scheme.slider_outline);
+        // left outline
+        pge->FillRectDecal(absolute_position, olc::vf2d{ 1.f, size.y }, color_scheme.slider_outline);
+        // right outline
+        pge->FillRectDecal(olc::vf2d{ absolute_position.x + size.x - 1, absolute_position.y }, olc::vf2d{ 1.f, size.y }, color_scheme.slider_outline);
+        // bottom outline
+        pge->FillRectDecal(olc::vf2d{ absolute_position.x, absolute_position.y + size.y }, olc::vf2d{ size.x, 1.f }, color_scheme.slider_outline);
+    }
+
+    void FUI_Slider::input(olc::PixelGameEngine*)
+    {
+        if (frame->mouse_position.x >= absolute_position.x &&
+            frame->mouse_position.x <= absolute_position.x + size.x &&
+            frame->mouse_position.y >= absolute_position.y &&
+            frame->mouse_position.y <= absolute_position.y + size.y)
+        {
+            state = State::HOVER;
+            if (frame->get_mouse(0).bHeld)
+            {
+                state = State::ACTIVE;
+                is_focused = true;
+            }
+        }
+        else if (state != State::ACTIVE)
+            state = State::NONE;
+
+        if (frame->get_mouse(0).bReleased)
+            state = State::NONE;
+
+        if (state == State::ACTIVE)
+        {
+            float old_value = slider_type == type::FLOAT ? slider_value_float : float(slider_value_int);
+
+            if (has_negative)
+                if (((frame->mouse_position.x - (absolute_position.x)) / size.x) <= 0.5)
+                {
+                    ratio = (-1.0f * (frame->mouse_position.x - (absolute_position.x)) / size.x) * 2.0f;
+                }
+                else
+                    ratio = -1.0f + ((frame->mouse_position.x - (absolute_position.x)) / size.x) * 2;
+
+            slider_ratio = (frame->mouse_position.x - (absolute_position.x)) / size.x;
+
+            if (slider_ratio <= 0.0f)
+                slider_ratio = 0.0f;
+            else if (slider_ratio >= 1.0f)
+                slider_ratio = 1.0f;
+
+            if (slider_ratio <= 0.0f)
+                ratio = 0.0f;
+            else if (slider_ratio >= 1.0f)
+                ratio = 1.0f;
+
+            switch (slider_type)
+            {
+            case type::FLOAT:
+                if (has_negative)
+                {
+                    if (ratio <= 0.0f)
+                        slider_value_float = range.x * (1.0f - (-1.0f * ratio));
+                    else
+                        slider_value_float = range.y * ratio;
+                }
+                else
+                    slider_value_float = range.y * slider_ratio;
+
+                if (slider_value_float < range.x)
+                    slider_value_float = range.x;
+                else if (slider_value_float > range.y)
+                    slider_value_float = range.y;
+                break;
+            case type::INT:
+                if (has_negative)
+                {
+                    if (ratio <= 0.0f)
+                        slider_value_int = range.x * (1.0f - (-1.0f * ratio));
+                    else
+                        slider_value_int = range.y * ratio;
+                }
+                else
+                    slider_value_int = range.y * slider_ratio;
+
+                if (slider_value_int < range.x)
+                    slider_value_int = range.x;
+                else if (slider_value_int > range.y)
+                    slider_value_int = range.y;
+                break;
+            }
+
+            if (old_value != (slider_type == type::FLOAT ? slider_value_float : float(slider_value_int)))
+                value_changed = true;
+        }
+
+        if (frame->get_mouse(0).bReleased)
+            is_focused = false;
+    }
+
+    /*
+    ####################################################
+    #               FUI_TEXTFIELD START                #
+    ####################################################
+    */
+    FUI_Inputfield::FUI_Inputfield(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        parent = pt;
+        position = p;
+        ui_type = FUI_Type::INPUTFIELD;
+    }
+
+    FUI_Inputfield::FUI_Inputfield(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        position = p;
+        ui_type = FUI_Type::INPUTFIELD;
+    }
+
+    FUI_Inputfield::FUI_Inputfield(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        parent = pt;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::INPUTFIELD;
+    }
+
+    FUI_Inputfield::FUI_Inputfield(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::INPUTFIELD;
+    }
+
+    bool FUI_Inputfield::is_textkey_pressed(olc::PixelGameEngine*, const TextKey& key)
+    {
+        int vTextKey = 0;
+        switch (key)
+        {
+        default:                        vTextKey = olc::NONE;        break;
+        case TextKey::A:                vTextKey = olc::A;           break;
+        case TextKey::B:                vTextKey = olc::B;           break;
+        case TextKey::C:                vTextKey = olc::C;           break;
+        case TextKey::D:                vTextKey = olc::D;           break;
+        case TextKey::E:                vTextKey = olc::E;           break;
+        case TextKey::F:                vTextKey = olc::F;           break;
+        case TextKey::G:                vTextKey = olc::G;           break;
+        case TextKey::H:                vTextKey = olc::H;           break;
+        case TextKey::I:                vTextKey = olc::I;           break;
+        case TextKey::J:                vTextKey = olc::J;           break;
+        case TextKey::K:                vTextKey = olc::K;           break;
+        case TextKey::L:                vTextKey = olc::L;           break;
+        case TextKey::M:                vTextKey = olc::M;           break;
+        case TextKey::N:                vTextKey = olc::N;           break;
+        case TextKey::O:                vTextKey = olc::O;           break;
+        case TextKey::P:                vTextKey = olc::P;           break;
+        case TextKey::Q:                vTextKey = olc::Q;           break;
+        case TextKey::R:                vTextKey = olc::R;           break;
+        case TextKey::S:                vTextKey = olc::S;           break;
+        case TextKey::T:                vTextKey = olc::T;           break;
+        case TextKey::U:                vTextKey = olc::U;           break;
+        case TextKey::V:                vTextKey = olc::V;           break;
+        case TextKey::W:                vTextKey = olc::W;           break;
+        case TextKey::X:                vTextKey = olc::X;           break;
+        case TextKey::Y:                vTextKey = olc::Y;           break;
+        case TextKey::Z:                vTextKey = olc::Z;           break;
+        case TextKey::Num0:             vTextKey = olc::K0;          break;
+        case TextKey::Num1:             vTextKey = olc::K1;          break;
+        case TextKey::Num2:             vTextKey = olc::K2;          break;
+        case TextKey::Num3:             vTextKey = olc::K3;          break;
+        case TextKey::Num4:             vTextKey = olc::K4;          break;
+        case TextKey::Num5:             vTextKey = olc::K5;          break;
+        case TextKey::Num6:             vTextKey = olc::K6;          break;
+        case TextKey::Num7:             vTextKey = olc::K7;          break;
+        case TextKey::Num8:             vTextKey = olc::K8;          break;
+        case TextKey::Num9:             vTextKey = olc::K9;          break;
+
+        case TextKey::LBracket:         vTextKey = olc::OEM_4;       break;
+        case TextKey::RBracket:         vTextKey = olc::OEM_6;       break;
+        case TextKey::Semicolon:        vTextKey = olc::OEM_1;       break;
+        case TextKey::Comma:            vTextKey = olc::COMMA;       break;
+        case TextKey::Period:           vTextKey = olc::PERIOD;      break;
+        case TextKey::Quote:            vTextKey = olc::OEM_7;       break;
+        case TextKey::ForwardSlash:     vTextKey = olc::OEM_2;       break;
+        case TextKey::BackwardSlash:    vTextKey = olc::OEM_5;       break;
+        case TextKey::Tilda:            vTextKey = olc::OEM_3;       break;
+        case TextKey::Equal:            vTextKey = olc::EQUALS;      break;
+        case TextKey::Hyphen:           vTextKey = olc::MINUS;       break;
+
+        case TextKey::Space:            vTextKey = olc::SPACE;       break;
+        }
+
+        return frame->get_key((olc::Key)vTextKey).bPressed;
+    }
+
+    int FUI_Inputfield::get_char_id(olc::PixelGameEngine* pge)
+    {
+        for (int i = 0; i < text_keys; i++) {
+            if (is_textkey_pressed(pge, (TextKey)i)) {
+                return i;
+            }
+        }
+        return static_cast<int>(TextKey::None);
+    }
+
+    std::string FUI_Inputfield::get_char_from_id(olc::PixelGameEngine* pge)
+    {
+        int index = get_char_id(pge);
+        if (index == static_cast<int>(TextKey::None)) return "";
+
+        if (frame->get_key(olc::SHIFT).bHeld) {
+            return std::string(1, text_shift[index]);
+        }
+
+        return std::string(1, text_noshift[index]);
+    }
+
+
+    std::string FUI_Inputfield::get_clipboard_data()
+    {
+#ifdef _MSC_VER
+        if (OpenClipboard(NULL))
+        {
+            auto data = GetClipboardData(CF_TEXT);
+            std::string text = "";
+            try
+            {
+                text = (char*)data;
+            }
+            catch (char* e)
+            {
+                return text;
+            }
+            CloseClipboard();
+
+            return text;
+        }
+        else
+            return "";
+#endif
+        return "";
+    }
+
+    void FUI_Inputfield::copy_to_clipboard(std::string data)
+    {
+#ifdef _MSC_VER
+        if (data.size() > 0 && OpenClipboard(NULL))
+        {
+            EmptyClipboard();
+
+            HGLOBAL hg = GlobalAlloc(GMEM_MOVEABLE, data.size() + 1);
+            if (!hg) {
+                CloseClipboard();
+                return;
+            }
+            memcpy(GlobalLock(hg), data.c_str(), data.size() + 1);
+            GlobalUnlock(hg);
+            SetClipboardData(CF_TEXT, hg);
+            CloseClipboard();
+            GlobalFree(hg);
+        }
+#endif
+    }
+
+    bool FUI_Inputfield::update(olc::PixelGameEngine* pge)
+    {
+        FUI_Element::update(pge);
+
+        // values set from code (or a binding) are applied here so a hidden inputfield doesn't keep the old text
+        bool changed = clear_inputfield || !set_input_text.empty();
+        if (clear_inputfield)
+        {
+            inputfield_text.clear();
+            displayed_text.clear();
+            text_out_of_view.clear();
+            old_inputfield_text.clear();
+
+            clear_inputfield = false;
+        }
+
+        if (!set_input_text.empty())
+        {
+            displayed_text = set_input_text;
+            inputfield_text = set_input_text;
+            set_input_text.clear();
+        }
+        return changed;
+    }
+
+    void FUI_Inputfield::draw(olc::PixelGameEngine* pge)
+    {
+        absolute_position = get_absolute_position();
+
+        auto title_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(text))* text_scale;
+        auto display_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(displayed_text))* input_scale + olc::vf2d{ 2.f, 0.f };
+        // title text
+        auto text_position = olc::vf2d{ absolute_position.x - title_text_size.x, absolute_position.y + (size.y / 2) - (title_text_size.y / 2) };
+        auto timer = uint64_t(frame->time * 1000.0);
+        auto cursor_size = pge->GetTextSizeProp("_") * input_scale;
+
+        pge->DrawStringPropDecal(text_position, text, text_color, text_scale);
+
+        // outline
+        pge->FillRectDecal(absolute_position, size, color_scheme.inputfield_outline);
+        // background
+        pge->FillRectDecal(absolute_position + olc::vf2d{ 1.0f, 1.0f }, size - olc::vf2d{ 2.0f, 2.0f }, color_scheme.inputfield_background);
+
+        // render the text ( + 3 in text_position is used as an offset to not render the first letter inside of the outline)
+        text_position = olc::vf2d{ absolute_position.x + 3, absolute_position.y + (size.y / 2) - (display_text_size.y / 2) };
+        auto cursor_position = olc::vf2d{ text_position.x + display_text_size.x, text_position.y + display_text_size.y };
+
+        if (display_text_size.x <= size.x && inputfield_text.size() > old_inputfield_text.size())
+        {
+            if (mask_inputfield)
+                displayed_text += "*";
+            else if (displayed_text != inputfield_text)
+            {
+                if (!did_paste)
+                    displayed_text += inputfield_text.back();
+                else
+                    did_paste = false;
+            }
+            old_inputfield_text = inputfield_text;
+        }
+        else if (display_text_size.x >= size.x - 1)
+        {
+            text_out_of_view.push_back(displayed_text.front());
+            displayed_text.erase(0, 1);
+        }
+
+        pge->DrawStringPropDecal(text_position, displayed_text, text_color, input_scale);
+        //std::cout << inputfield_text << "\n";
+
+        if (select_all && displayed_text.size() > 0)
+            pge->FillRectDecal(text_position, olc::vf2d(display_text_size.x, display_text_size.y), color_scheme.inputfield_select_all_background);
+        else
+            select_all = false;
+
+        if (selected_chars > 0 && !select_all)
+        {
+            auto position = text_position;
+            for (int i = 1; i <= selected_chars; i++)
+            {
+                auto char_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(displayed_text.substr(displayed_text.size() - i, 1)))* input_scale;
+                position.x -= char_size.x;
+                pge->FillRectDecal(olc::vf2d((position.x + display_text_size.x), position.y),
+                    olc::vf2d(char_size.x, display_text_size.y), color_scheme.inputfield_select_all_background);
+            }
+        }
+
+        if (cursor_position.x + cursor_size.x > absolute_position.x + size.x)
+            cursor_position.x -= (cursor_position.x + cursor_size.x) - (absolute_position.x + size.x);
+
+        if (state == State::ACTIVE)
+        {
+            if (timer - last_cursor_tick > 500)
+            {
+                if (timer - last_cursor_tick > 1500)
+                    last_cursor_tick = timer;
+                pge->FillRectDecal(cursor_position, { static_cast<float>(cursor_size.x), 1.f }, color_scheme.inputfield_cursor);
+            }
+        }
+    }
+
+    const double FUI_Inputfield::get_next_change()
+    {
+        if (state != State::ACTIVE)
+            return FUI_Element::get_next_change();
+        // the caret shows 500ms after last_cursor_tick and hides again at 1500ms
+        uint64_t timer = uint64_t(frame->time * 1000.0);
+        uint64_t next = last_cursor_tick + (timer - last_cursor_tick > 500 ? 1501 : 501);
+        return std::min(double(next) / 1000.0, FUI_Element::get_next_change());
+    }
+
+    void FUI_Inputfield::input(olc::PixelGameEngine* pge)
+    {
+        auto timer = uint64_t(frame->time * 1000.0);
+
+        if (frame->mouse_position.x >= absolute_position.x &&
+            frame->mouse_position.x <= absolute_position.x + size.x &&
+            frame->mouse_position.y >= absolute_position.y &&
+            frame->mouse_position.y <= absolute_position.y + size.y)
+        {
+            if (frame->get_mouse(0).bPressed)
+            {
+                is_focused = true;
+                last_cursor_tick = uint64_t(frame->time * 1000.0) - 500;
+            }
+        }
+        else if (frame->get_mouse(0).bPressed && is_focused)
+            is_focused = false;
+
+        if (is_focused)
+        {
+            if (frame->get_key(olc::CTRL).bHeld && frame->get_key(olc::A).bPressed && !displayed_text.empty())
+            {
+                selected_chars = inputfield_text.size();
+                select_all = true;
+            }
+
+            if (frame->get_key(olc::ESCAPE).bPressed)
+                is_focused = false;
+
+            if (frame->get_key(olc::ENTER).bPressed)
+            {
+                selected_chars = 0;
+                select_all = false;
+                emit(FUI_EventType::ENTER);
+            }
+
+            if (frame->get_key(olc::SHIFT).bHeld && frame->get_key(olc::LEFT).bPressed && !displayed_text.empty())
+            {
+                if (selected_chars <= displayed_text.size() - 1)
+                {
+                    if (select_all)
+                        select_all = false;
+                    selected_chars++;
+                }
+            }
+
+            if (frame->get_key(olc::SHIFT).bHeld && frame->get_key(olc::RIGHT).bPressed && selected_chars > 0)
+            {
+                if (select_all)
+                    select_all = false;
+                selected_chars--;
+            }
+
+            if (frame->get_key(olc::CTRL).bHeld && frame->get_key(olc::V).bPressed)
+            {
+                if (select_all)
+                {
+                    inputfield_text.clear();
+                    displayed_text.clear();
+                    text_out_of_view.clear();
+                    old_inputfield_text.clear();
+                    value_changed = true;
+                }
+                if (selected_chars > 0 && !select_all)
+                {
+                    inputfield_text.erase(inputfield_text.size() - selected_chars, inputfield_text.size());
+                    displayed_text.erase(displayed_text.size() - selected_chars, displayed_text.size());
+                    selected_chars = 0;
+                    value_changed = true;
+                }
+                auto data = get_clipboard_data();
+                if (data.size() > 0)
+                {
+                    inputfield_text.append(data);
+                    displayed_text.append(data);
+                    did_paste = true;
+                    value_changed = true;
+                }
+
+                if (select_all)
+                    select_all = false;
+            }
+
+            if (frame->get_key(olc::CTRL).bHeld && frame->get_key(olc::C).bPressed)
+            {
+                if (select_all)
+                    copy_to_clipboard(inputfield_text);
+                if (selected_chars > 0 && !select_all)
+                {
+                    //copy_to_clipboard(inputfield_text.substr(inputfield_text.size() - selected_chars, inputfield_text.size()));
+                    copy_to_clipboard(displayed_text.substr(displayed_text.size() - selected_chars, displayed_text.size()));
+                }
+            }
+
+            // related to holding backspace for deletion of characters
+            if (frame->get_key(olc::BACK).bPressed && initial_backspace)
+                hold_backspace_tick = timer;
+
+            // Remove last character if backspace is pressed / remove selected_char amount if text is selected
+            if (frame->get_key(olc::BACK).bHeld && !select_all && inputfield_text.size() > 0 &&
+                (initial_backspace || timer - hold_backspace_tick > 500) && timer - last_backspace_tick > 50)
+            {
+                initial_backspace = false;
+                value_changed = true;
+                if (selected_chars > 0)
+                {
+                    inputfield_text.erase(inputfield_text.size() - selected_chars, inputfield_text.size());
+                    displayed_text.erase(displayed_text.size() - selected_chars, displayed_text.size());
+                    old_inputfield_text.erase(old_inputfield_text.size() - selected_chars, old_inputfield_text.size());
+                    if (text_out_of_view.size() > 0)
+                    {
+                        displayed_text.insert(0, &text_out_of_view.back());
+                        text_out_of_view.pop_back();
+                    }
+                    selected_chars = 0;
+                }
+                else
+                {
+                    inputfield_text.pop_back();
+                    displayed_text.pop_back();
+                    old_inputfield_text.pop_back();
+                    if (text_out_of_view.size() > 0)
+                    {
+                        displayed_text.insert(0, &text_out_of_view.back());
+                        text_out_of_view.pop_back();
+                    }
+                }
+                last_backspace_tick = timer;
+            }
+
+            if (!frame->get_key(olc::BACK).bHeld)
+                initial_backspace = true;
+
+            // Clear text
+            if ((select_all && get_char_from_id(pge).size() > 0 && !frame->get_key(olc::CTRL).bHeld) ||
+                (select_all && frame->get_key(olc::BACK).bPressed))
+            {
+                inputfield_text.clear();
+                displayed_text.clear();
+                text_out_of_view.clear();
+                old_inputfield_text.clear();
+                select_all = false;
+                selected_chars = 0;
+                value_changed = true;
+            }
+
+            // Append character to string
+            if (!frame->get_key(olc::CTRL).bHeld)
+            {
+                auto typed = get_char_from_id(pge);
+                if (!typed.empty())
+                {
+                    inputfield_text.append(typed);
+                    value_changed = true;
+                }
+            }
+        }
+
+        if (is_focused)
+            state = State::ACTIVE;
+        else
+            state = State::NONE;
+    }
+
+    FUI_Console::FUI_Console(const std::string& id, FUI_Window* parent, const std::string& title, olc::vi2d position, olc::vi2d size, int input_thickness = 10)
+    {
+        identifier = id;
+        this->parent = parent;
+        text = title;
+        this->position = position;
+        this->size = size;
+        this->input_thickness = input_thickness;
+        inputfield.set_size({ size.x, input_thickness });
+        ui_type = FUI_Type::CONSOLE;
+    }
+
+    FUI_Console::FUI_Console(const std::string& id, FUI_Window* parent, const std::string& group, const std::string& title, olc::vi2d position, olc::vi2d size, int input_thickness = 10)
+    {
+        identifier = id;
+        this->parent = parent;
+        text = title;
+        this->position = position;
+        this->size = size;
+        this->group = group;
+        this->input_thickness = input_thickness;
+        inputfield.set_size({ size.x, input_thickness });
+        ui_type = FUI_Type::CONSOLE;
+    }
+
+    FUI_Console::FUI_Console(const std::string& id, const std::string& title, olc::vi2d position, olc::vi2d size, int input_thickness = 10)
+    {
+        identifier = id;
+        this->parent = parent;
+        text = title;
+        this->position = position;
+        this->size = size;
+        this->input_thickness = input_thickness;
+        inputfield.set_size({ size.x, input_thickness });
+        ui_type = FUI_Type::CONSOLE;
+    }
+
+    FUI_Console::FUI_Console(const std::string& id, const std::string& group, const std::string& title, olc::vi2d position, olc::vi2d size, int input_thickness = 10)
+    {
+        identifier = id;
+        this->parent = parent;
+        text = title;
+        this->position = position;
+        this->size = size;
+        this->group = group;
+        this->input_thickness = input_thickness;
+        inputfield.set_size({ size.x, input_thickness });
+        ui_type = FUI_Type::CONSOLE;
+    }
+
+    void FUI_Console::push_line(olc::PixelGameEngine* pge, std::string display_text)
+    {
+        auto text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(display_text)) * text_scale;
+        auto size_to_remove = 0.f;
+        std::string holder = display_text;
+        std::vector<std::string> text_parts;
+        while (text_size.x > size.x)
+        {
+            size_to_remove = text_size.x - size.x;
+            size_to_remove = size_to_remove / text_size.x;
+            int mod_size = std::ceil(size_to_remove * holder.size());
+
+            text_parts.push_back(std::string(holder.begin(), holder.end() - mod_size));
+            holder.erase(holder.begin(), holder.end() - mod_size);
+            text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(holder)) * text_scale;
+        }
+        if (text_parts.size() > 0)
+        {
+            if (holder != display_text)
+                text_parts.push_back(holder);
+            display_text.clear();
+            for (int i = 0; i < text_parts.size(); i++)
+            {
+                if (i == 0)
+                    display_text = text_parts[i] + "\n ";
+                else if (i == text_parts.size() - 1)
+                    display_text += text_parts[i];
+                else
+                    display_text += text_parts[i] + "\n ";
+            }
+        }
+        executed_commands.push_back(std::move(display_text));
+
+        if (scroll_threshold > 0 && last_pos + text_size.y >= scroll_threshold)
+            scroll_index++;
+
+        if (scroll_index > 0 && scroll_index < (executed_commands.size() - commands_shown) + 1 && last_pos + text_size.y >= scroll_threshold)
+            scroll_index = (executed_commands.size() - commands_shown) + 1;
+    }
+
+    void FUI_Console::set_timestamp_format(const std::string& format)
+    {
+        timestamp.set_format(format);
+    }
+
+    void FUI_Console::log(const std::string& line)
+    {
+        std::string display_text;
+        display_text.reserve(line.size() + 16);
+        timestamp.format(display_text);
+        display_text += " - ";
+        display_text += line;
+
+        std::lock_guard<std::mutex> lock(log_mutex);
+        logged_lines.push_back(std::move(display_text));
+    }
+
+    void FUI_Console::draw(olc::PixelGameEngine* pge)
+    {
+        absolute_position = get_absolute_position() + olc::vf2d{ 0, 1 };
+
+        inputfield.inputfield_scale(text_scale);
+        inputfield.set_position({ absolute_position.x, absolute_position.y + size.y - 1 - input_thickness });
+
+        // outline
+        pge->FillRectDecal(absolute_position, { size.x , size.y - input_thickness }, color_scheme.console_outline);
+        // body
+        pge->FillRectDecal({ absolute_position.x + 1, absolute_position.y + 1 }, { size.x - 2, size.y - input_thickness - 2 }, color_scheme.console_background);
+
+        // title text
+        auto title_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(text))* text_scale;
+        auto text_pos = olc::vf2d{ absolute_position.x + (size.x / 2) - (title_size.x / 2) , absolute_position.y + 1 };
+        pge->DrawStringPropDecal(text_pos, text, text_color, text_scale);
+        pge->FillRectDecal({ absolute_position.x, absolute_position.y + title_size.y }, { size.x, 1 }, color_scheme.console_outline);
+
+        if (run_once)
+        {
+            scroll_threshold = size.y - 1 - input_thickness - title_size.y;
+            run_once = false;
+        }
+
+        if (should_clear_console)
+        {
+            executed_commands.clear();
+            scroll_index = 0;
+            should_clear_console = false;
+        }
+
+        // console text
+        int j = 0;
+        commands_shown = 1;
+        last_pos = 0.f;
+        for (int i = scroll_index; i < executed_commands.size(); i++)
+        {
+            auto text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(executed_commands[i])) * text_scale;
+            float pos = 0.f;
+            if (j < 1)
+                pos = absolute_position.y + title_size.y + 2 + (text_size.y * j);
+            if (title_size.y + last_pos <= scroll_threshold)
+            {
+                if (j >= 1)
+                    pge->DrawStringPropDecal({ absolute_position.x, last_pos }, executed_commands[i], text_color, text_scale);
+                else
+                    pge->DrawStringPropDecal({ absolute_position.x, pos }, executed_commands[i], text_color, text_scale);
+                commands_shown++;
+            }
+            if (j < 1)
+                last_pos = pos + text_size.y;
+            else
+                last_pos += text_size.y;
+            j++;
+        }
+
+        inputfield.draw(pge);
+    }
+
+    bool FUI_Console::update(olc::PixelGameEngine* pge)
+    {
+        FUI_Element::update(pge);
+        inputfield.update(pge);
+
+        // lines logged from other threads since the last frame
+        {
+            std::lock_guard<std::mutex> lock(log_mutex);
+            draining_lines.swap(logged_lines);
+        }
+        bool changed = !draining_lines.empty();
+        for (auto& line : draining_lines)
+            push_line(pge, std::move(line));
+        draining_lines.clear();
+        return changed;
+    }
+
+    void FUI_Console::run_event(FUI_EventType event)
+    {
+        if (event != FUI_EventType::COMMAND)
+        {
+            FUI_Element::run_event(event);
+            return;
+        }
+
+        // one event per command, but a single delivery runs every command entered so far
+        std::vector<std::string> commands;
+        commands.swap(pending_commands);
+        for (auto& entered : commands)
+        {
+            if (command_handler)
+                command_handler(entered, &executed_command);
+            std::string display_text;
+            timestamp.format(display_text);
+            display_text += " - ";
+            display_text += executed_command;
+            push_line(command_pge, std::move(display_text));
+        }
+        request_redraw();
+    }
+
+    const double FUI_Console::get_next_change()
+    {
+        {
+            std::lock_guard<std::mutex> lock(log_mutex);
+            if (!logged_lines.empty())
+                return frame->time;
+        }
+        return inputfield.get_next_change();
+    }
+
+    void FUI_Console::input(olc::PixelGameEngine* pge)
+    {
+        if (inputfield.get_focused_status() || !command_entry.empty())
+        {
+            // instantly jump to the top or bottom
+            if (frame->get_key(olc::CTRL).bHeld && frame->get_key(olc::UP).bPressed)
+                scroll_index = 0;
+            else if (frame->get_key(olc::CTRL).bHeld && frame->get_key(olc::DOWN).bPressed)
+                scroll_index = (executed_commands.size() - commands_shown) + 1;
+
+            if (frame->get_key(olc::ENTER).bPressed || !command_entry.empty())
+            {
+                command = inputfield.get_inputfield_value();
+                if (!command_entry.empty())
+                    command = command_entry;
+                if (!command.empty())
+                {
+                    if (!command_entry.empty())
+                    {
+                        std::string display_text;
+                        timestamp.format(display_text);
+                        display_text += " - ";
+                        display_text += command;
+                        push_line(pge, std::move(display_text));
+                        command_entry.clear();
+                    }
+                    else
+                    {
+                        // the handler may add or remove elements, so it waits until every element had its input
+                        pending_commands.push_back(command);
+                        command_pge = pge;
+                        emit(FUI_EventType::COMMAND);
+                        inputfield.clear_inputfield_value();
+                        if (last_executed_commands.size() < 1)
+                            last_executed_commands.push_back(command);
+                        else if (command != last_executed_commands.back())
+                            last_executed_commands.push_back(command);
+                    }
+
+                    command_index = 0;
+                }
+            }
+
+            if (last_executed_commands.size() > 0 && frame->get_key(olc::UP).bPressed && !(frame->get_key(olc::CTRL).bHeld || frame->get_key(olc::SHIFT).bHeld)
+                && command_index <= last_executed_commands.size() - 1)
+            {
+                command_index++;
+                inputfield.set_inputfield_value(last_executed_commands[last_executed_commands.size() - command_index]);
+            }
+            if (last_executed_commands.size() > 0 && frame->get_key(olc::DOWN).bPressed && !(frame->get_key(olc::CTRL).bHeld || frame->get_key(olc::SHIFT).bHeld)
+                && command_index >= 1)
+            {
+                command_index--;
+                if (command_index == 0)
+                    inputfield.clear_inputfield_value();
+                else
+                    inputfield.set_inputfield_value(last_executed_commands[last_executed_commands.size() - command_index]);
+            }
+        }
+
+        if (frame->mouse_position.x >= absolute_position.x &&
+            frame->mouse_position.x <= absolute_position.x + size.x &&
+            frame->mouse_position.y >= absolute_position.y &&
+            frame->mouse_position.y <= absolute_position.y + size.y)
+        {
+            if (frame->mouse_wheel > 0)
+            {
+                if (scroll_index > 0)
+                    scroll_index--;
+            }
+            else if (frame->mouse_wheel < 0)
+            {
+                if (scroll_index < executed_commands.size() - 1)
+                    scroll_index++;
+            }
+        }
+
+        inputfield.input(pge);
+    }
+
+    /*
+    ####################################################
+    #               FUI_SCROLLVIEW START               #
+    ####################################################
+    */
+    FUI_ScrollView::FUI_ScrollView(const std::string& id, FUI_Window* pt, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        size = s;
+        parent = pt;
+        position = p;
+        ui_type = FUI_Type::SCROLLVIEW;
+    }
+
+    FUI_ScrollView::FUI_ScrollView(const std::string& id, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        size = s;
+        position = p;
+        ui_type = FUI_Type::SCROLLVIEW;
+    }
+
+    FUI_ScrollView::FUI_ScrollView(const std::string& id, FUI_Window* pt, const std::string& g, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        size = s;
+        parent = pt;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::SCROLLVIEW;
+    }
+
+    FUI_ScrollView::FUI_ScrollView(const std::string& id, const std::string& g, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        size = s;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::SCROLLVIEW;
+    }
+
+    FUI_ScrollView::~FUI_ScrollView()
+    {
+        for (auto& child : children)
+            child->set_container(nullptr);
+    }
+
+    void FUI_ScrollView::sort_children()
+    {
+        std::stable_sort(children.begin(), children.end(), [](const std::shared_ptr<FUI_Element>& a, const std::shared_ptr<FUI_Element>& b)
+            {
+                return a->get_position().y < b->get_position().y;
+            });
+    }
+
+    void FUI_ScrollView::update_content_height(olc::PixelGameEngine* pge)
+    {
+        if (!content_dirty)
+            return;
+
+        content_height = 0.f;
+        for (auto& child : children)
+        {
+            // labels have no size, fall back to the height of their text
+            float child_height = child->get_size().y > 0 ? child->get_size().y : child->get_text_size(pge).y;
+            content_height = std::max(content_height, child->get_position().y + child_height);
+        }
+        content_dirty = false;
+
+        scroll_to(scroll_offset.y);
+    }
+
+    void FUI_ScrollView::update_visible_range()
+    {
+        // children are sorted by y so only the range [first_visible, last_visible) can intersect the view
+        auto first = std::lower_bound(children.begin(), children.end(), scroll_offset.y, [](const std::shared_ptr<FUI_Element>& child, float y)
+            {
+                return child->get_position().y < y;
+            });
+        auto last = std::upper_bound(first, children.end(), scroll_offset.y + size.y, [](float y, const std::shared_ptr<FUI_Element>& child)
+            {
+                return y < child->get_position().y;
+            });
+        first_visible = first - children.begin();
+        last_visible = last - children.begin();
+    }
+
+    bool FUI_ScrollView::is_child_visible(const std::shared_ptr<FUI_Element>& child)
+    {
+        // decals can't be scissored, so a child is only shown when it fits the view entirely (same as console lines)
+        return child->get_position().y + child->get_size().y <= scroll_offset.y + size.y;
+    }
+
+    const float FUI_ScrollView::get_max_scroll()
+    {
+        return std::max(0.f, content_height - size.y);
+    }
+
+    const float FUI_ScrollView::get_thumb_height()
+    {
+        if (content_height <= 0.f)
+            return size.y;
+        return std::max(8.f, size.y * (size.y / content_height));
+    }
+
+    const olc::vf2d FUI_ScrollView::get_thumb_position()
+    {
+        float ratio = get_max_scroll() > 0.f ? scroll_offset.y / get_max_scroll() : 0.f;
+        return olc::vf2d{ absolute_position.x + size.x - scrollbar_width, absolute_position.y + (size.y - get_thumb_height()) * ratio };
+    }
+
+    void FUI_ScrollView::add_child(std::shared_ptr<FUI_Element> child)
+    {
+        child->set_container(this);
+        children.emplace_back(child);
+        sort_children();
+        content_dirty = true;
+    }
+
+    void FUI_ScrollView::remove_child(FUI_Element* child)
+    {
+        for (size_t i = 0; i < children.size(); i++)
+        {
+            if (children[i].get() == child)
+            {
+                child->set_container(nullptr);
+                children.erase(children.begin() + i);
+                content_dirty = true;
+                break;
+            }
+        }
+    }
+
+    void FUI_ScrollView::refresh_layout()
+    {
+        sort_children();
+        content_dirty = true;
+    }
+
+    void FUI_ScrollView::set_scroll_step(float step)
+    {
+        scroll_step = step;
+    }
+
+    void FUI_ScrollView::scroll_to(float y)
+    {
+        float offset = std::min(std::max(y, 0.f), get_max_scroll());
+        if (offset != scroll_offset.y)
+            request_redraw();
+        scroll_offset.y = offset;
+    }
+
+    const olc::vf2d FUI_ScrollView::get_scroll_offset()
+    {
+        return scroll_offset;
+    }
+
+    const float FUI_ScrollView::get_content_height()
+    {
+        return content_height;
+    }
+
+    const olc::vf2d FUI_ScrollView::get_content_position()
+    {
+        return get_absolute_position() - scroll_offset;
+    }
+
+    void FUI_ScrollView::draw(olc::PixelGameEngine* pge)
+    {
+        absolute_position = get_absolute_position();
+        update_content_height(pge);
+        update_visible_range();
+
+        // outline
+        pge->FillRectDecal(absolute_position - olc::vf2d{ 1.f, 1.f }, size + olc::vf2d{ 2.f, 2.f }, color_scheme.scrollview_outline);
+        // body
+        pge->FillRectDecal(absolute_position, size, color_scheme.scrollview_background);
+
+        for (int i = first_visible; i < last_visible; i++)
+        {
+            if (is_child_visible(children[i]))
+                children[i]->draw(pge);
+        }
+
+        // scrollbar is only shown when there's something to scroll
+        if (get_max_scroll() > 0.f)
+        {
+            pge->FillRectDecal(olc::vf2d{ absolute_position.x + size.x - scrollbar_width, absolute_position.y }, olc::vf2d{ scrollbar_width, size.y }, color_scheme.scrollbar_track);
+            switch (thumb_state)
+            {
+            case State::NONE:
+                pge->FillRectDecal(get_thumb_position(), olc::vf2d{ scrollbar_width, get_thumb_height() }, color_scheme.scrollbar_thumb);
+                break;
+            case State::HOVER:
+            case State::ACTIVE:
+                pge->FillRectDecal(get_thumb_position(), olc::vf2d{ scrollbar_width, get_thumb_height() }, color_scheme.scrollbar_thumb_hover);
+                break;
+            }
+        }
+    }
+
+    void FUI_ScrollView::input(olc::PixelGameEngine* pge)
+    {
+        update_visible_range();
+
+        bool child_focused = false;
+        for (int i = first_visible; i < last_visible; i++)
+        {
+            if (!is_child_visible(children[i]))
+                continue;
+            children[i]->input(pge);
+            if (children[i]->get_focused_status())
+                child_focused = true;
+        }
+
+        bool is_hovered = frame->mouse_position.x >= absolute_position.x &&
+            frame->mouse_position.x <= absolute_position.x + size.x &&
+            frame->mouse_position.y >= absolute_position.y &&
+            frame->mouse_position.y <= absolute_position.y + size.y;
+
+        // an open dropdown inside the view gets to use the wheel first
+        if (is_hovered && !child_focused && get_max_scroll() > 0.f)
+        {
+            if (frame->mouse_wheel > 0)
+                scroll_to(scroll_offset.y - scroll_step);
+            else if (frame->mouse_wheel < 0)
+                scroll_to(scroll_offset.y + scroll_step);
+        }
+
+        // scrollbar thumb dragging
+        if (get_max_scroll() > 0.f)
+        {
+            auto thumb_position = get_thumb_position();
+            bool thumb_hovered = frame->mouse_position.x >= thumb_position.x &&
+                frame->mouse_position.x <= thumb_position.x + scrollbar_width &&
+                frame->mouse_position.y >= thumb_position.y &&
+                frame->mouse_position.y <= thumb_position.y + get_thumb_height();
+            bool track_hovered = frame->mouse_position.x >= thumb_position.x &&
+                frame->mouse_position.x <= thumb_position.x + scrollbar_width &&
+                is_hovered;
+
+            if (frame->get_mouse(0).bPressed && thumb_hovered)
+            {
+                thumb_state = State::ACTIVE;
+                thumb_difference = frame->mouse_position.y - thumb_position.y;
+            }
+            else if (frame->get_mouse(0).bPressed && track_hovered)
+            {
+                // clicking the track jumps a page
+                if (frame->mouse_position.y < thumb_position.y)
+                    scroll_to(scroll_offset.y - size.y);
+                else
+                    scroll_to(scroll_offset.y + size.y);
+            }
+
+            if (thumb_state == State::ACTIVE)
+            {
+                float track = size.y - get_thumb_height();
+                if (track > 0.f)
+                    scroll_to(((frame->mouse_position.y - thumb_difference - absolute_position.y) / track) * get_max_scroll());
+                if (frame->get_mouse(0).bReleased)
+                    thumb_state = State::NONE;
+            }
+            else if (thumb_hovered)
+                thumb_state = State::HOVER;
+            else
+                thumb_state = State::NONE;
+        }
+
+        is_focused = thumb_state == State::ACTIVE;
+    }
+
+    /*
+    ####################################################
+    #               FUI_TABLE START                    #
+    ####################################################
+    */
+    bool FUI_TableSource::compare(int row_a, int row_b, int column)
+    {
+        // reused per thread so sorting large tables doesn't allocate for every comparison
+        thread_local std::string cell_a;
+        thread_local std::string cell_b;
+        get_cell(row_a, column, cell_a);
+        get_cell(row_b, column, cell_b);
+
+        char* end_a = nullptr;
+        char* end_b = nullptr;
+        double number_a = std::strtod(cell_a.c_str(), &end_a);
+        double number_b = std::strtod(cell_b.c_str(), &end_b);
+        if (!cell_a.empty() && !cell_b.empty() && *end_a == '\0' && *end_b == '\0')
+            return number_a < number_b;
+
+        return cell_a < cell_b;
+    }
+
+    bool FUI_TableSource::matches(int row, const std::string& filter)
+    {
+        thread_local std::string cell;
+        for (int column = 0; column < get_column_count(); column++)
+        {
+            get_cell(row, column, cell);
+            if (cell.find(filter) != std::string::npos)
+                return true;
+        }
+        return false;
+    }
+
+    FUI_Table::FUI_Table(const std::string& id, FUI_Window* pt, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        size = s;
+        parent = pt;
+        position = p;
+        ui_type = FUI_Type::TABLE;
+    }
+
+    FUI_Table::FUI_Table(const std::string& id, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        size = s;
+        position = p;
+        ui_type = FUI_Type::TABLE;
+    }
+
+    FUI_Table::FUI_Table(const std::string& id, FUI_Window* pt, const std::string& g, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        size = s;
+        parent = pt;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::TABLE;
+    }
+
+    FUI_Table::FUI_Table(const std::string& id, const std::string& g, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        size = s;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::TABLE;
+    }
+
+    FUI_Table::~FUI_Table()
+    {
+        {
+            std::lock_guard<std::mutex> lock(job_mutex);
+            stop_worker = true;
+        }
+        // bumping the generation makes a running job bail out at its next check
+        job_generation++;
+        job_condition.notify_one();
+        if (worker.joinable())
+            worker.join();
+    }
+
+    void FUI_Table::worker_loop()
+    {
+        std::unique_lock<std::mutex> lock(job_mutex);
+        while (true)
+        {
+            job_condition.wait(lock, [&] { return stop_worker || job_pending; });
+            if (stop_worker)
+                return;
+
+            Job job = job_request;
+            job_pending = false;
+            job_running = true;
+            lock.unlock();
+
+            std::vector<int> order;
+            bool completed = run_job(job, order);
+
+            lock.lock();
+            job_running = false;
+            if (completed && job.generation == job_generation.load())
+            {
+                ready_order.swap(order);
+                order_ready = true;
+            }
+        }
+    }
+
+    bool FUI_Table::run_job(const Job& job, std::vector<int>& order)
+    {
+        int rows = job.source->get_row_count();
+        order.reserve(rows);
+        for (int row = 0; row < rows; row++)
+        {
+            // a newer request supersedes this one
+            if ((row & 1023) == 0 && job.generation != job_generation.load())
+                return false;
+            if (job.filter.empty() || job.source->matches(row, job.filter))
+                order.push_back(row);
+        }
+
+        if (job.column >= 0)
+        {
+            uint32_t checks = 0;
+            try
+            {
+                std::stable_sort(order.begin(), order.end(), [&](int a, int b)
+                    {
+                        if ((++checks & 1023) == 0 && job.generation != job_generation.load())
+                            throw JobCancelled{};
+                        return job.ascending ? job.source->compare(a, b, job.column) : job.source->compare(b, a, job.column);
+                    });
+            }
+            catch (const JobCancelled&)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void FUI_Table::request_job()
+    {
+        uint32_t generation = ++job_generation;
+
+        // nothing to compute, fall back to the source order right away
+        if (!source || (sort_column < 0 && filter.empty()))
+        {
+            std::lock_guard<std::mutex> lock(job_mutex);
+            job_pending = false;
+            order_ready = false;
+            ready_order.clear();
+            row_order.clear();
+            has_order = false;
+            return;
+        }
+
+        if (!worker.joinable())
+            worker = std::thread(&FUI_Table::worker_loop, this);
+
+        {
+            std::lock_guard<std::mutex> lock(job_mutex);
+            job_request.source = source;
+            job_request.column = sort_column;
+            job_request.ascending = sort_ascending;
+            job_request.filter = filter;
+            job_request.generation = generation;
+            job_pending = true;
+            // an order that finished for the old data isn't applied anymore
+            order_ready = false;
+        }
+        job_condition.notify_one();
+    }
+
+    bool FUI_Table::apply_ready_order()
+    {
+        if (!order_ready.load())
+            return false;
+
+        std::lock_guard<std::mutex> lock(job_mutex);
+        if (!order_ready)
+            return false;
+        row_order.swap(ready_order);
+        has_order = true;
+        order_ready = false;
+        scroll_rows(0);
+        return true;
+    }
+
+    bool FUI_Table::update(olc::PixelGameEngine* pge)
+    {
+        FUI_Element::update(pge);
+        return apply_ready_order();
+    }
+
+    const int FUI_Table::get_display_row_count()
+    {
+        if (!source)
+            return 0;
+        return has_order ? int(row_order.size()) : source->get_row_count();
+    }
+
+    const int FUI_Table::get_rows_in_view()
+    {
+        return std::max(0, int((size.y - row_height) / row_height));
+    }
+
+    const int FUI_Table::get_source_row(int display_row)
+    {
+        return has_order ? row_order[display_row] : display_row;
+    }
+
+    void FUI_Table::fit_text(olc::PixelGameEngine* pge, std::string& txt, float width)
+    {
+        if (pge->GetTextSizeProp(txt).x * text_scale.x <= width)
+            return;
+
+        // binary search the longest prefix that still fits with the ".." suffix
+        int low = 0;
+        int high = txt.size();
+        while (low < high)
+        {
+            int mid = (low + high + 1) / 2;
+            if (pge->GetTextSizeProp(txt.substr(0, mid) + "..").x * text_scale.x <= width)
+                low = mid;
+            else
+                high = mid - 1;
+        }
+        txt.resize(low);
+        txt += "..";
+    }
+
+    const std::string& FUI_Table::get_cell_text(olc::PixelGameEngine* pge, int row, int column, float width)
+    {
+        uint32_t index = (uint32_t(row + 1) * 2654435761u ^ uint32_t(column) * 40503u) & (cache_size - 1);
+        auto& cell = cell_cache[index];
+        if (cell.row == row && cell.column == column && cell.column_width == width)
+            return cell.text;
+
+        if (row < 0)
+            source->get_column_name(column, cell.text);
+        else
+            source->get_cell(row, column, cell.text);
+        fit_text(pge, cell.text, width - 4.f);
+        cell.row = row;
+        cell.column = column;
+        cell.column_width = width;
+        return cell.text;
+    }
+
+    void FUI_Table::scroll_rows(int amount)
+    {
+        int max_first_row = std::max(0, get_display_row_count() - get_rows_in_view());
+        first_row = std::min(std::max(first_row + amount, 0), max_first_row);
+    }
+
+    void FUI_Table::set_source(FUI_TableSource* src)
+    {
+        request_redraw();
+        source = src;
+        column_widths.clear();
+        first_row = 0;
+        first_column = 0;
+        selected_row = -1;
+        refresh();
+    }
+
+    void FUI_Table::refresh()
+    {
+        request_redraw();
+        for (auto& cell : cell_cache)
+            cell.row = -2;
+
+        // the old order is shown until the new one is ready, without the rows the source doesn't have anymore
+        int row_count = source ? source->get_row_count() : 0;
+        if (has_order)
+            row_order.erase(std::remove_if(row_order.begin(), row_order.end(), [row_count](int row) { return row >= row_count; }), row_order.end());
+        if (selected_row >= row_count)
+            selected_row = -1;
+        request_job();
+        scroll_rows(0);
+    }
+
+    void FUI_Table::set_column_width(int column, float width)
+    {
+        request_redraw();
+        if (column >= int(column_widths.size()))
+            column_widths.resize(column + 1, default_column_width);
+        column_widths[column] = std::max(10.f, width);
+    }
+
+    const float FUI_Table::get_column_width(int column)
+    {
+        if (column >= 0 && column < int(column_widths.size()))
+            return column_widths[column];
+        return default_column_width;
+    }
+
+    void FUI_Table::set_row_height(float height)
+    {
+        request_redraw();
+        row_height = std::max(1.f, height);
+        scroll_rows(0);
+    }
+
+    void FUI_Table::sort_by(int column, bool ascending)
+    {
+        sort_column = column;
+        sort_ascending = ascending;
+        request_job();
+    }
+
+    void FUI_Table::set_filter(const std::string& f)
+    {
+        if (f == filter)
+            return;
+        request_redraw();
+        filter = f;
+        first_row = 0;
+        request_job();
+    }
+
+    const bool FUI_Table::is_sorting()
+    {
+        std::lock_guard<std::mutex> lock(job_mutex);
+        return job_pending || job_running;
+    }
+
+    const int FUI_Table::get_selected_row()
+    {
+        return selected_row;
+    }
+
+    void FUI_Table::draw(olc::PixelGameEngine* pge)
+    {
+        absolute_position = get_absolute_position();
+
+        // outline
+        pge->FillRectDecal(absolute_position - olc::vf2d{ 1.f, 1.f }, size + olc::vf2d{ 2.f, 2.f }, color_scheme.table_outline);
+        // body
+        pge->FillRectDecal(absolute_position, size, color_scheme.table_background);
+
+        if (!source)
+            return;
+
+        int columns = source->get_column_count();
+        if (int(column_widths.size()) < columns)
+            column_widths.resize(columns, default_column_width);
+
+        float view_right = absolute_position.x + size.x - scrollbar_width;
+        float text_offset = (row_height - 8.f * text_scale.y) / 2;
+
+        // header
+        pge->FillRectDecal(absolute_position, olc::vf2d{ size.x, row_height }, color_scheme.table_header);
+        float x = absolute_position.x;
+        for (int column = first_column; column < columns && x < view_right; column++)
+        {
+            float width = std::min(column_widths[column], view_right - x);
+            pge->DrawStringPropDecal(olc::vf2d{ x + 2.f, absolute_position.y + text_offset }, get_cell_text(pge, -1, column, width), text_color, text_scale);
+            if (column == sort_column)
+                pge->DrawStringPropDecal(olc::vf2d{ x + width - 8.f, absolute_position.y + text_offset }, sort_ascending ? "^" : "v", text_color, text_scale);
+            pge->FillRectDecal(olc::vf2d{ x + width - 1.f, absolute_position.y }, olc::vf2d{ 1.f, size.y }, color_scheme.table_grid);
+            x += column_widths[column];
+        }
+
+        // only the rows in view are fetched and drawn, the cost doesn't depend on the row count
+        int display_rows = get_display_row_count();
+        int rows_in_view = get_rows_in_view();
+        for (int i = 0; i < rows_in_view && first_row + i < display_rows; i++)
+        {
+            int row = get_source_row(first_row + i);
+            float y = absolute_position.y + row_height * (i + 1);
+            if (row == selected_row)
+                pge->FillRectDecal(olc::vf2d{ absolute_position.x, y }, olc::vf2d{ size.x - scrollbar_width, row_height }, color_scheme.table_row_selected);
+            else if ((first_row + i) % 2)
+                pge->FillRectDecal(olc::vf2d{ absolute_position.x, y }, olc::vf2d{ size.x - scrollbar_width, row_height }, color_scheme.table_row_alternate);
+
+            x = absolute_position.x;
+            for (int column = first_column; column < columns && x < view_right; column++)
+            {
+                float width = std::min(column_widths[column], view_right - x);
+                pge->DrawStringPropDecal(olc::vf2d{ x + 2.f, y + text_offset }, get_cell_text(pge, row, column, width), text_color, text_scale);
+                x += column_widths[column];
+            }
+        }
+
+        // scrollbar
+        if (display_rows > rows_in_view && rows_in_view > 0)
+        {
+            float track = size.y - row_height;
+            float thumb_height = std::max(8.f, track * (float(rows_in_view) / display_rows));
+            float thumb_y = (track - thumb_height) * (float(first_row) / (display_rows - rows_in_view));
+            pge->FillRectDecal(olc::vf2d{ view_right, absolute_position.y + row_height }, olc::vf2d{ scrollbar_width, track }, color_scheme.scrollbar_track);
+            pge->FillRectDecal(olc::vf2d{ view_right, absolute_position.y + row_height + thumb_y }, olc::vf2d{ scrollbar_width, thumb_height },
+                dragging_thumb ? color_scheme.scrollbar_thumb_hover : color_scheme.scrollbar_thumb);
+        }
+    }
+
+    void FUI_Table::input(olc::PixelGameEngine*)
+    {
+        if (!source)
+            return;
+
+        auto mouse = frame->mouse_position;
+        bool is_hovered = mouse.x >= absolute_position.x && mouse.x <= absolute_position.x + size.x &&
+            mouse.y >= absolute_position.y && mouse.y <= absolute_position.y + size.y;
+        float view_right = absolute_position.x + size.x - scrollbar_width;
+        int display_rows = get_display_row_count();
+        int rows_in_view = get_rows_in_view();
+        int columns = source->get_column_count();
+
+        if (is_hovered)
+        {
+            if (frame->get_key(olc::SHIFT).bHeld)
+            {
+                if (frame->mouse_wheel > 0 && first_column > 0)
+                    first_column--;
+                else if (frame->mouse_wheel < 0 && first_column < columns - 1)
+                    first_column++;
+            }
+            else
+            {
+                if (frame->mouse_wheel > 0)
+                    scroll_rows(-3);
+                else if (frame->mouse_wheel < 0)
+                    scroll_rows(3);
+            }
+        }
+
+        // column resizing
+        if (resizing_column >= 0)
+        {
+            set_column_width(resizing_column, mouse.x - resize_difference);
+            if (frame->get_mouse(0).bReleased)
+                resizing_column = -1;
+        }
+        // scrollbar thumb dragging
+        else if (dragging_thumb)
+        {
+            float track = size.y - row_height;
+            float thumb_height = std::max(8.f, track * (float(rows_in_view) / std::max(1, display_rows)));
+            if (track - thumb_height > 0.f)
+            {
+                float ratio = (mouse.y - thumb_difference - absolute_position.y - row_height) / (track - thumb_height);
+                first_row = 0;
+                scroll_rows(int(ratio * (display_rows - rows_in_view)));
+            }
+            if (frame->get_mouse(0).bReleased)
+                dragging_thumb = false;
+        }
+        else if (is_hovered && frame->get_mouse(0).bPressed)
+        {
+            if (mouse.x >= view_right && display_rows > rows_in_view)
+            {
+                float track = size.y - row_height;
+                float thumb_height = std::max(8.f, track * (float(rows_in_view) / display_rows));
+                float thumb_y = absolute_position.y + row_height + (track - thumb_height) * (float(first_row) / (display_rows - rows_in_view));
+                if (mouse.y >= thumb_y && mouse.y <= thumb_y + thumb_height)
+                {
+                    dragging_thumb = true;
+                    thumb_difference = mouse.y - thumb_y;
+                }
+                else
+                    scroll_rows(mouse.y < thumb_y ? -rows_in_view : rows_in_view);
+            }
+            else if (mouse.y < absolute_position.y + row_height)
+            {
+                // header, either grab a column edge or cycle the sort on the column (ascending -> descending -> none)
+                float x = absolute_position.x;
+                for (int column = first_column; column < columns && x < view_right; column++)
+                {
+                    float edge = x + get_column_width(column);
+                    if (std::abs(mouse.x - edge) <= 2.f)
                     {
-                        selected_element.first = element.first;
-                        selected_element.second = element.second.second;
+                        resizing_column = column;
+                        resize_difference = x;
+                        break;
+                    }
+                    if (mouse.x >= x && mouse.x < edge)
+                    {
+                        if (sort_column != column)
+                            sort_by(column, true);
+                        else if (sort_ascending)
+                            sort_by(column, false);
+                        else
+                            sort_by(-1, true);
+                        break;
                     }
+                    x = edge;
+                }
+            }
+            else
+            {
+                int display_row = first_row + int((mouse.y - absolute_position.y - row_height) / row_height);
+                if (display_row < display_rows)
+                    selected_row = get_source_row(display_row);
+            }
+        }
+
+        is_focused = resizing_column >= 0 || dragging_thumb;
+    }
+
+    /*
+    ####################################################
+    #               FUI_TREEVIEW START                 #
+    ####################################################
+    */
+    FUI_TreeView::FUI_TreeView(const std::string& id, FUI_Window* pt, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        size = s;
+        parent = pt;
+        position = p;
+        ui_type = FUI_Type::TREEVIEW;
+    }
+
+    FUI_TreeView::FUI_TreeView(const std::string& id, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        size = s;
+        position = p;
+        ui_type = FUI_Type::TREEVIEW;
+    }
+
+    FUI_TreeView::FUI_TreeView(const std::string& id, FUI_Window* pt, const std::string& g, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        size = s;
+        parent = pt;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::TREEVIEW;
+    }
+
+    FUI_TreeView::FUI_TreeView(const std::string& id, const std::string& g, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        size = s;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::TREEVIEW;
+    }
+
+    void FUI_TreeView::load_children(int node, std::vector<FUI_TreeItem>& children)
+    {
+        nodes[node].first_child = nodes.size();
+        nodes[node].child_count = children.size();
+        nodes[node].load_state = LoadState::LOADED;
+        int depth = nodes[node].depth + 1;
+        for (auto& child : children)
+        {
+            Node n;
+            n.item = std::move(child);
+            n.depth = depth;
+            nodes.emplace_back(std::move(n));
+        }
+    }
+
+    void FUI_TreeView::collect_visible(int node, std::vector<Row>& out)
+    {
+        if (nodes[node].load_state == LoadState::LOADING)
+        {
+            out.push_back({ node, true });
+            return;
+        }
+        for (int i = 0; i < nodes[node].child_count; i++)
+        {
+            int child = nodes[node].first_child + i;
+            out.push_back({ child, false });
+            if (nodes[child].expanded)
+                collect_visible(child, out);
+        }
+    }
+
+    const int FUI_TreeView::get_row_depth(const Row& row)
+    {
+        return nodes[row.node].depth + (row.placeholder ? 1 : 0);
+    }
+
+    const int FUI_TreeView::get_rows_in_view()
+    {
+        return std::max(0, int(size.y / row_height));
+    }
+
+    void FUI_TreeView::scroll_rows(int amount)
+    {
+        int max_first_row = std::max(0, int(rows.size()) - get_rows_in_view());
+        first_row = std::min(std::max(first_row + amount, 0), max_first_row);
+    }
+
+    bool FUI_TreeView::poll_pending_loads()
+    {
+        bool loaded = false;
+        for (int i = 0; i < int(pending_loads.size()); i++)
+        {
+            auto& load = pending_loads[i];
+            if (load.children.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                continue;
+
+            int node = load.node;
+            auto children = load.children.get();
+            pending_loads.erase(pending_loads.begin() + i);
+            i--;
+            loaded = true;
+
+            load_children(node, children);
+
+            // swap the placeholder row for the loaded children if the node is still open
+            for (size_t row = 0; row < rows.size(); row++)
+            {
+                if (rows[row].placeholder && rows[row].node == node)
+                {
+                    std::vector<Row> inserted;
+                    collect_visible(node, inserted);
+                    rows.erase(rows.begin() + row);
+                    rows.insert(rows.begin() + row, inserted.begin(), inserted.end());
+                    break;
+                }
+            }
+        }
+        return loaded;
+    }
+
+    bool FUI_TreeView::update(olc::PixelGameEngine* pge)
+    {
+        FUI_Element::update(pge);
+        return poll_pending_loads();
+    }
+
+    void FUI_TreeView::set_children_provider(std::function<void(const FUI_TreeItem& parent, std::vector<FUI_TreeItem>& children)> provider, bool async)
+    {
+        children_provider = provider;
+        async_provider = async;
+    }
+
+    void FUI_TreeView::add_root(const FUI_TreeItem& item)
+    {
+        request_redraw();
+        Node n;
+        n.item = item;
+        nodes.emplace_back(std::move(n));
+        roots.push_back(nodes.size() - 1);
+
+        // roots that were added after expanding other roots go after their visible subtrees
+        rows.push_back({ int(nodes.size()) - 1, false });
+    }
+
+    void FUI_TreeView::clear()
+    {
+        request_redraw();
+        // loads still in flight are waited on and their results dropped
+        for (auto& load : pending_loads)
+            load.children.wait();
+        pending_loads.clear();
+        nodes.clear();
+        roots.clear();
+        rows.clear();
+        first_row = 0;
+        selected_node = -1;
+        hovered_row = -1;
+    }
+
+    void FUI_TreeView::expand_row(int row)
+    {
+        request_redraw();
+        if (row < 0 || row >= int(rows.size()) || rows[row].placeholder)
+            return;
+
+        int node = rows[row].node;
+        if (nodes[node].expanded || !nodes[node].item.has_children)
+            return;
+        nodes[node].expanded = true;
+
+        if (nodes[node].load_state == LoadState::NOT_LOADED && children_provider)
+        {
+            if (async_provider)
+            {
+                nodes[node].load_state = LoadState::LOADING;
+                auto provider = children_provider;
+                auto item = nodes[node].item;
+                pending_loads.push_back({ node, std::async(std::launch::async, [provider, item]()
+                    {
+                        std::vector<FUI_TreeItem> children;
+                        provider(item, children);
+                        return children;
+                    }) });
+            }
+            else
+            {
+                std::vector<FUI_TreeItem> children;
+                children_provider(nodes[node].item, children);
+                load_children(node, children);
+            }
+        }
+
+        // only the newly visible rows are spliced in, the rest of the flattened list is untouched
+        std::vector<Row> inserted;
+        collect_visible(node, inserted);
+        rows.insert(rows.begin() + row + 1, inserted.begin(), inserted.end());
+    }
+
+    void FUI_TreeView::collapse_row(int row)
+    {
+        request_redraw();
+        if (row < 0 || row >= int(rows.size()) || rows[row].placeholder)
+            return;
+
+        int node = rows[row].node;
+        if (!nodes[node].expanded)
+            return;
+        nodes[node].expanded = false;
+
+        // the visible subtree is the run of following rows that are deeper than the node
+        int depth = nodes[node].depth;
+        int end = row + 1;
+        while (end < int(rows.size()) && get_row_depth(rows[end]) > depth)
+            end++;
+        rows.erase(rows.begin() + row + 1, rows.begin() + end);
+        scroll_rows(0);
+    }
+
+    void FUI_TreeView::toggle_row(int row)
+    {
+        if (row < 0 || row >= int(rows.size()) || rows[row].placeholder)
+            return;
+        if (nodes[rows[row].node].expanded)
+            collapse_row(row);
+        else
+            expand_row(row);
+    }
+
+    const int FUI_TreeView::get_visible_row_count()
+    {
+        return rows.size();
+    }
+
+    void FUI_TreeView::set_row_height(float height)
+    {
+        request_redraw();
+        row_height = std::max(1.f, height);
+        scroll_rows(0);
+    }
+
+    void FUI_TreeView::set_indent(float width)
+    {
+        request_redraw();
+        indent = width;
+    }
+
+    const FUI_TreeItem* FUI_TreeView::get_selected_item()
+    {
+        if (selected_node < 0)
+            return nullptr;
+        return &nodes[selected_node].item;
+    }
+
+    void FUI_TreeView::draw(olc::PixelGameEngine* pge)
+    {
+        absolute_position = get_absolute_position();
+
+        // outline
+        pge->FillRectDecal(absolute_position - olc::vf2d{ 1.f, 1.f }, size + olc::vf2d{ 2.f, 2.f }, color_scheme.treeview_outline);
+        // body
+        pge->FillRectDecal(absolute_position, size, color_scheme.treeview_background);
+
+        float text_offset = (row_height - 8.f * text_scale.y) / 2;
+        int rows_in_view = get_rows_in_view();
+        for (int i = 0; i < rows_in_view && first_row + i < int(rows.size()); i++)
+        {
+            auto& row = rows[first_row + i];
+            olc::vf2d row_position = { absolute_position.x, absolute_position.y + row_height * i };
+
+            if (!row.placeholder && row.node == selected_node)
+                pge->FillRectDecal(row_position, olc::vf2d{ size.x, row_height }, color_scheme.treeview_selected);
+            else if (first_row + i == hovered_row)
+                pge->FillRectDecal(row_position, olc::vf2d{ size.x, row_height }, color_scheme.treeview_hover);
+
+            float x = row_position.x + 2.f + indent * get_row_depth(row);
+            if (row.placeholder)
+            {
+                pge->DrawStringPropDecal(olc::vf2d{ x + indent, row_position.y + text_offset }, placeholder_text, color_scheme.treeview_placeholder, text_scale);
+                continue;
+            }
+
+            auto& node = nodes[row.node];
+            if (node.item.has_children)
+                pge->DrawStringPropDecal(olc::vf2d{ x, row_position.y + text_offset }, node.expanded ? "-" : "+", text_color, text_scale);
+            pge->DrawStringPropDecal(olc::vf2d{ x + indent, row_position.y + text_offset }, node.item.text, text_color, text_scale);
+        }
+
+        if (int(rows.size()) > rows_in_view && rows_in_view > 0)
+        {
+            float scroll_size = std::max(8.f, size.y * (float(rows_in_view) / rows.size()));
+            float scroll_y_pos = (size.y - scroll_size) * (float(first_row) / (rows.size() - rows_in_view));
+            pge->FillRectDecal({ absolute_position.x + size.x - 3, absolute_position.y + scroll_y_pos }, { 3, scroll_size }, color_scheme.scroll_indicator);
+        }
+    }
+
+    void FUI_TreeView::input(olc::PixelGameEngine*)
+    {
+        auto mouse = frame->mouse_position;
+        hovered_row = -1;
+        if (!(mouse.x >= absolute_position.x && mouse.x <= absolute_position.x + size.x &&
+            mouse.y >= absolute_position.y && mouse.y < absolute_position.y + size.y))
+            return;
+
+        if (frame->mouse_wheel > 0)
+            scroll_rows(-3);
+        else if (frame->mouse_wheel < 0)
+            scroll_rows(3);
+
+        int row = first_row + int((mouse.y - absolute_position.y) / row_height);
+        if (row < 0 || row >= int(rows.size()) || rows[row].placeholder)
+            return;
+        hovered_row = row;
+
+        if (frame->get_mouse(0).bPressed)
+        {
+            float expander_x = absolute_position.x + 2.f + indent * get_row_depth(rows[row]);
+            // clicking the expander toggles, clicking the text selects (and toggles on a second click)
+            if (mouse.x < expander_x + indent || rows[row].node == selected_node)
+                toggle_row(row);
+            else
+                selected_node = rows[row].node;
+        }
+    }
+
+    /*
+    ####################################################
+    #               FUI_PLOT START                     #
+    ####################################################
+    */
+    // min / max over a contiguous run of floats, this is the hot loop of the plot decimation
+    inline void fui_min_max(const float* data, size_t count, float& min, float& max)
+    {
+        size_t i = 0;
+#if defined(FUI_SIMD_SSE)
+        if (count >= 4)
+        {
+            __m128 vmin = _mm_loadu_ps(data);
+            __m128 vmax = vmin;
+            for (i = 4; i + 4 <= count; i += 4)
+            {
+                __m128 v = _mm_loadu_ps(data + i);
+                vmin = _mm_min_ps(vmin, v);
+                vmax = _mm_max_ps(vmax, v);
+            }
+            alignas(16) float lanes_min[4];
+            alignas(16) float lanes_max[4];
+            _mm_store_ps(lanes_min, vmin);
+            _mm_store_ps(lanes_max, vmax);
+            for (int lane = 0; lane < 4; lane++)
+            {
+                min = std::min(min, lanes_min[lane]);
+                max = std::max(max, lanes_max[lane]);
+            }
+        }
+#elif defined(FUI_SIMD_NEON)
+        if (count >= 4)
+        {
+            float32x4_t vmin = vld1q_f32(data);
+            float32x4_t vmax = vmin;
+            for (i = 4; i + 4 <= count; i += 4)
+            {
+                float32x4_t v = vld1q_f32(data + i);
+                vmin = vminq_f32(vmin, v);
+                vmax = vmaxq_f32(vmax, v);
+            }
+            float lanes_min[4];
+            float lanes_max[4];
+            vst1q_f32(lanes_min, vmin);
+            vst1q_f32(lanes_max, vmax);
+            for (int lane = 0; lane < 4; lane++)
+            {
+                min = std::min(min, lanes_min[lane]);
+                max = std::max(max, lanes_max[lane]);
+            }
+        }
+#endif
+        for (; i < count; i++)
+        {
+            min = std::min(min, data[i]);
+            max = std::max(max, data[i]);
+        }
+    }
+
+    FUI_PlotSeries::FUI_PlotSeries(const std::string& n, olc::Pixel c, size_t requested)
+    {
+        uint64_t rounded = block_size * 2;
+        while (rounded < requested)
+            rounded <<= 1;
+        samples = std::make_unique<std::atomic<float>[]>(rounded);
+        capacity = rounded;
+        mask = rounded - 1;
+        block_count = rounded / block_size;
+        tree_min.assign(block_count * 2, std::numeric_limits<float>::max());
+        tree_max.assign(block_count * 2, std::numeric_limits<float>::lowest());
+        name = n;
+        color = c;
+    }
+
+    const size_t FUI_PlotSeries::get_capacity()
+    {
+        return size_t(capacity);
+    }
+
+    void FUI_PlotSeries::load_min_max(uint64_t start, uint64_t count, float& min, float& max)
+    {
+        // copied out a block at a time with relaxed loads, the producer may be writing the same slots
+        float block[block_size];
+        while (count > 0)
+        {
+            uint64_t amount = std::min(count, block_size);
+            for (uint64_t i = 0; i < amount; i++)
+                block[i] = samples[start + i].load(std::memory_order_relaxed);
+            fui_min_max(block, size_t(amount), min, max);
+            start += amount;
+            count -= amount;
+        }
+    }
+
+    const std::string& FUI_PlotSeries::get_name()
+    {
+        return name;
+    }
+
+    void FUI_PlotSeries::update_summaries(uint64_t end)
+    {
+        // the producer may have lapped us, only the last capacity samples still exist
+        uint64_t oldest = end > capacity ? end - capacity : 0;
+        if (summarized < oldest)
+            summarized = oldest - (oldest % block_size);
+
+        // blocks never straddle the ring boundary since the capacity is a multiple of the block size
+        while (summarized + block_size <= end)
+        {
+            float min = std::numeric_limits<float>::max();
+            float max = std::numeric_limits<float>::lowest();
+            load_min_max(summarized & mask, block_size, min, max);
+            set_block((summarized / block_size) & (block_count - 1), min, max);
+            summarized += block_size;
+        }
+    }
+
+    void FUI_PlotSeries::set_block(uint64_t block, float min, float max)
+    {
+        uint64_t node = block + block_count;
+        tree_min[node] = min;
+        tree_max[node] = max;
+        for (node >>= 1; node > 0; node >>= 1)
+        {
+            tree_min[node] = std::min(tree_min[node * 2], tree_min[node * 2 + 1]);
+            tree_max[node] = std::max(tree_max[node * 2], tree_max[node * 2 + 1]);
+        }
+    }
+
+    void FUI_PlotSeries::get_block_min_max(uint64_t from, uint64_t to, float& min, float& max)
+    {
+        // bottom up, a node on either edge that isn't covered by its parent is taken on its own
+        for (from += block_count, to += block_count; from < to; from >>= 1, to >>= 1)
+        {
+            if (from & 1)
+            {
+                min = std::min(min, tree_min[from]);
+                max = std::max(max, tree_max[from]);
+                from++;
+            }
+            if (to & 1)
+            {
+                to--;
+                min = std::min(min, tree_min[to]);
+                max = std::max(max, tree_max[to]);
+            }
+        }
+    }
+
+    void FUI_PlotSeries::get_min_max(uint64_t begin, uint64_t end, uint64_t summarized_end, float& min, float& max)
+    {
+        auto raw = [&](uint64_t from, uint64_t to)
+        {
+            while (from < to)
+            {
+                uint64_t start = from & mask;
+                uint64_t count = std::min(to - from, capacity - start);
+                load_min_max(start, count, min, max);
+                from += count;
+            }
+        };
+
+        uint64_t first_block = (begin + block_size - 1) / block_size;
+        uint64_t last_block = std::min(end, summarized_end) / block_size;
+        if (first_block >= last_block)
+        {
+            raw(begin, end);
+            return;
+        }
+
+        // partial block on each side, complete blocks in between come from the summary tree, split in two where
+        // they wrap around the ring
+        raw(begin, first_block * block_size);
+        uint64_t first = first_block & (block_count - 1);
+        uint64_t count = last_block - first_block;
+        if (first + count <= block_count)
+            get_block_min_max(first, first + count, min, max);
+        else
+        {
+            get_block_min_max(first, block_count, min, max);
+            get_block_min_max(0, first + count - block_count, min, max);
+        }
+        raw(last_block * block_size, end);
+    }
+
+    FUI_Plot::FUI_Plot(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        parent = pt;
+        position = p;
+        ui_type = FUI_Type::PLOT;
+    }
+
+    FUI_Plot::FUI_Plot(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        position = p;
+        ui_type = FUI_Type::PLOT;
+    }
+
+    FUI_Plot::FUI_Plot(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        parent = pt;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::PLOT;
+    }
+
+    FUI_Plot::FUI_Plot(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        text = t;
+        size = s;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::PLOT;
+    }
+
+    FUI_PlotSeries* FUI_Plot::add_series(const std::string& name, olc::Pixel color, size_t capacity)
+    {
+        request_redraw();
+        series.emplace_back(std::make_unique<FUI_PlotSeries>(name, color, capacity));
+        return series.back().get();
+    }
+
+    void FUI_Plot::set_visible_samples(size_t amount)
+    {
+        if (amount != visible_samples)
+            request_redraw();
+        visible_samples = amount;
+    }
+
+    void FUI_Plot::set_range(olc::vf2d range)
+    {
+        if (range != value_range || auto_range)
+            request_redraw();
+        value_range = range;
+        auto_range = false;
+    }
+
+    void FUI_Plot::set_auto_range(bool state)
+    {
+        if (state != auto_range)
+            request_redraw();
+        auto_range = state;
+    }
+
+    void FUI_Plot::draw(olc::PixelGameEngine* pge)
+    {
+        absolute_position = get_absolute_position();
+
+        // outline
+        pge->FillRectDecal(absolute_position - olc::vf2d{ 1.f, 1.f }, size + olc::vf2d{ 2.f, 2.f }, color_scheme.plot_outline);
+        // body
+        pge->FillRectDecal(absolute_position, size, color_scheme.plot_background);
+        pge->FillRectDecal(olc::vf2d{ absolute_position.x, absolute_position.y + size.y / 2 }, olc::vf2d{ size.x, 1.f }, color_scheme.plot_grid);
+
+        int width = std::max(1, int(size.x));
+        column_min.resize(series.size() * width);
+        column_max.resize(series.size() * width);
+
+        // decimate every series to one min / max pair per pixel column, a column reads at most two partial blocks and
+        // O(log blocks) summary nodes, so this is O(width * log(samples)) per series however many samples are shown
+        float range_min = std::numeric_limits<float>::max();
+        float range_max = std::numeric_limits<float>::lowest();
+        for (size_t s = 0; s < series.size(); s++)
+        {
+            auto& plot_series = *series[s];
+            uint64_t end = plot_series.write_index.load(std::memory_order_acquire);
+            plot_series.update_summaries(end);
+            plot_series.drawn_index = end;
+
+            // keep a block of slack so a producer rarely laps what's being read
+            uint64_t available = std::min<uint64_t>(end, plot_series.capacity - FUI_PlotSeries::block_size);
+            uint64_t count = visible_samples > 0 ? std::min<uint64_t>(visible_samples, available) : available;
+            uint64_t begin = end - count;
+
+            for (int x = 0; x < width; x++)
+            {
+                uint64_t from = begin + (count * x) / width;
+                uint64_t to = begin + (count * (x + 1)) / width;
+                float min = std::numeric_limits<float>::max();
+                float max = std::numeric_limits<float>::lowest();
+                if (to > from)
+                    plot_series.get_min_max(from, to, plot_series.summarized, min, max);
+                column_min[s * width + x] = min;
+                column_max[s * width + x] = max;
+            }
+
+            // seqlock style check, whatever the producer overwrote while it was read (the sample it may be writing
+            // right now included) is dropped, those columns stay empty for this frame
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint64_t written = plot_series.write_index.load(std::memory_order_relaxed);
+            uint64_t valid_from = written + 1 > plot_series.capacity ? written + 1 - plot_series.capacity : 0;
+            for (int x = 0; x < width; x++)
+            {
+                uint64_t from = begin + (count * x) / width;
+                if (from < valid_from)
+                {
+                    column_min[s * width + x] = std::numeric_limits<float>::max();
+                    column_max[s * width + x] = std::numeric_limits<float>::lowest();
+                    continue;
+                }
+                if (column_min[s * width + x] <= column_max[s * width + x])
+                {
+                    range_min = std::min(range_min, column_min[s * width + x]);
+                    range_max = std::max(range_max, column_max[s * width + x]);
                 }
             }
         }
-        else
-            std::cout << "Trying to set_default_item to wrong UI_TYPE\n";
-    }
 
-    void FUI_Element::set_default_items(const std::vector<int>& items)
-    {
-        if (ui_type == FUI_Type::COMBOLIST)
+        if (!auto_range || range_min > range_max)
         {
-            for (auto& element : elements)
+            range_min = value_range.x;
+            range_max = value_range.y;
+        }
+        if (range_max - range_min < 1e-6f)
+            range_max = range_min + 1.f;
+        float scale = (size.y - 1.f) / (range_max - range_min);
+
+        for (size_t s = 0; s < series.size(); s++)
+        {
+            float previous_top = -1.f;
+            float previous_bottom = -1.f;
+            for (int x = 0; x < width; x++)
             {
-                for (auto& item : items)
+                float min = column_min[s * width + x];
+                float max = column_max[s * width + x];
+                if (min > max)
                 {
-                    if (item > elements.size() - 1)
-                        std::cout << "Trying to set a invalid default item (" << item << ")\n";
-                    else
-                    {
-                        bool found = false;
-                        int selected_id = 0;
-                        for (auto& e : selected_elements)
-                        {
-                            if (selected_id == item)
-                                found = true;
-                        }
-                        if (element.first == item && !found)
-                        {
-                            element.second.first = DropdownState::ACTIVE;
-                            selected_elements.emplace_back(std::make_pair(element.first, element.second.second));
-                        }
-                    }
+                    previous_top = -1.f;
+                    continue;
+                }
+                float top = absolute_position.y + size.y - 1.f - (max - range_min) * scale;
+                float bottom = absolute_position.y + size.y - 1.f - (min - range_min) * scale;
+                // stretch towards the previous column so steep edges stay connected
+                if (previous_top >= 0.f)
+                {
+                    top = std::min(top, previous_bottom);
+                    bottom = std::max(bottom, previous_top);
                 }
+                top = std::max(top, absolute_position.y);
+                bottom = std::min(bottom, absolute_position.y + size.y - 1.f);
+                pge->FillRectDecal(olc::vf2d{ absolute_position.x + x, top }, olc::vf2d{ 1.f, std::max(1.f, bottom - top + 1.f) }, series[s]->color);
+                previous_top = top;
+                previous_bottom = bottom;
             }
         }
-        else
-            std::cout << "Trying to set_default_item to wrong UI_TYPE\n";
+
+        // title, range and legend
+        range_max_text.set(range_max, 2);
+        range_min_text.set(range_min, 2);
+        pge->DrawStringPropDecal(olc::vf2d{ absolute_position.x + 2.f, absolute_position.y + 2.f }, range_max_text.get(), color_scheme.plot_text, text_scale);
+        pge->DrawStringPropDecal(olc::vf2d{ absolute_position.x + 2.f, absolute_position.y + size.y - 10.f * text_scale.y }, range_min_text.get(), color_scheme.plot_text, text_scale);
+
+        auto title_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(text)) * text_scale;
+        pge->DrawStringPropDecal(olc::vf2d{ absolute_position.x + (size.x / 2) - (title_size.x / 2), absolute_position.y - title_size.y - 2.f }, text, text_color, text_scale);
+
+        float legend_y = absolute_position.y + 2.f;
+        for (auto& plot_series : series)
+        {
+            auto name_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(plot_series->name)) * text_scale;
+            pge->DrawStringPropDecal(olc::vf2d{ absolute_position.x + size.x - name_size.x - 2.f, legend_y }, plot_series->name, plot_series->color, text_scale);
+            legend_y += name_size.y + 2.f;
+        }
     }
 
-    void FUI_Element::set_max_display_items(const int amount)
+    const double FUI_Plot::get_next_change()
     {
-        if (ui_type == FUI_Type::DROPDOWN || ui_type == FUI_Type::COMBOLIST)
+        // producers pushed samples since the last draw
+        for (auto& plot_series : series)
+            if (plot_series->write_index.load(std::memory_order_relaxed) != plot_series->drawn_index)
+                return frame->time;
+        return FUI_Element::get_next_change();
+    }
+
+    /*
+    ####################################################
+    #               FUI_CANVAS START                   #
+    ####################################################
+    */
+    // maps values to colormap indices, (value - min) * scale is clamped to 0..255 and NaN maps to 0
+    inline void fui_map_indices(const float* data, uint8_t* indices, size_t count, float min, float scale)
+    {
+        size_t i = 0;
+#if defined(FUI_SIMD_SSE)
+        const __m128 vmin = _mm_set1_ps(min);
+        const __m128 vscale = _mm_set1_ps(scale);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 top = _mm_set1_ps(255.f);
+        for (; i + 4 <= count; i += 4)
         {
-            if (amount <= elements.size())
-                max_display_items = amount;
+            __m128 v = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(data + i), vmin), vscale);
+            // max_ps returns the second operand for NaN
+            v = _mm_min_ps(_mm_max_ps(v, zero), top);
+            alignas(16) int32_t lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), _mm_cvttps_epi32(v));
+            indices[i + 0] = uint8_t(lanes[0]);
+            indices[i + 1] = uint8_t(lanes[1]);
+            indices[i + 2] = uint8_t(lanes[2]);
+            indices[i + 3] = uint8_t(lanes[3]);
+        }
+#elif defined(FUI_SIMD_NEON)
+        const float32x4_t vmin = vdupq_n_f32(min);
+        const float32x4_t vscale = vdupq_n_f32(scale);
+        const float32x4_t zero = vdupq_n_f32(0.f);
+        const float32x4_t top = vdupq_n_f32(255.f);
+        for (; i + 4 <= count; i += 4)
+        {
+            float32x4_t v = vmulq_f32(vsubq_f32(vld1q_f32(data + i), vmin), vscale);
+            // NaN lanes are zeroed so they map to 0 like the scalar path
+            v = vbslq_f32(vceqq_f32(v, v), v, zero);
+            v = vminq_f32(vmaxq_f32(v, zero), top);
+            uint32_t lanes[4];
+            vst1q_u32(lanes, vcvtq_u32_f32(v));
+            indices[i + 0] = uint8_t(lanes[0]);
+            indices[i + 1] = uint8_t(lanes[1]);
+            indices[i + 2] = uint8_t(lanes[2]);
+            indices[i + 3] = uint8_t(lanes[3]);
+        }
+#endif
+        for (; i < count; i++)
+        {
+            float v = (data[i] - min) * scale;
+            v = std::min(std::max(0.f, v), 255.f);
+            indices[i] = uint8_t(v);
         }
-        else
-            std::cout << "Trying to set_max_display_items on wrong UI_TYPE\n";
     }
 
-    const std::vector<int> FUI_Element::get_selected_items()
+    FUI_Canvas::FUI_Canvas(const std::string& id, FUI_Window* pt, olc::vi2d p, olc::vi2d s)
     {
-        if (ui_type == FUI_Type::COMBOLIST)
-        {
-            return_selected_items.clear();
-            for (auto& item : selected_elements)
-                return_selected_items.emplace_back(item.first);
+        identifier = id;
+        size = s;
+        parent = pt;
+        position = p;
+        ui_type = FUI_Type::CANVAS;
+        set_colormap({ { 0, 0, 4 }, { 87, 16, 110 }, { 188, 55, 84 }, { 249, 142, 9 }, { 252, 255, 164 } });
+    }
 
-            return return_selected_items;
-        }
-        else
-            std::cout << "Trying to retrieve selected items on wrong UI_TYPE\n";
+    FUI_Canvas::FUI_Canvas(const std::string& id, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        size = s;
+        position = p;
+        ui_type = FUI_Type::CANVAS;
+        set_colormap({ { 0, 0, 4 }, { 87, 16, 110 }, { 188, 55, 84 }, { 249, 142, 9 }, { 252, 255, 164 } });
+    }
 
-        return return_selected_items;
+    FUI_Canvas::FUI_Canvas(const std::string& id, FUI_Window* pt, const std::string& g, olc::vi2d p, olc::vi2d s)
+    {
+        identifier = id;
+        size = s;
+        parent = pt;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::CANVAS;
+        set_colormap({ { 0, 0, 4 }, { 87, 16, 110 }, { 188, 55, 84 }, { 249, 142, 9 }, { 252, 255, 164 } });
     }
 
-    const olc::vf2d FUI_Element::get_position()
+    FUI_Canvas::FUI_Canvas(const std::string& id, const std::string& g, olc::vi2d p, olc::vi2d s)
     {
-        return position;
+        identifier = id;
+        size = s;
+        position = p;
+        group = g;
+        ui_type = FUI_Type::CANVAS;
+        set_colormap({ { 0, 0, 4 }, { 87, 16, 110 }, { 188, 55, 84 }, { 249, 142, 9 }, { 252, 255, 164 } });
     }
 
-    const olc::vf2d FUI_Element::get_absolute_position()
+    void FUI_Canvas::set_grid_size(olc::vi2d gs)
     {
-        if (parent)
-            absolute_position = (parent->get_position() + olc::vf2d{ parent->get_border_thickness(), parent->get_top_border_thickness() });
-        else
-            absolute_position = olc::vf2d{ 0, 0 };
-        return absolute_position + position;
+        grid_size = { std::max(0, gs.x), std::max(0, gs.y) };
+        tile_count = { (grid_size.x + tile_size - 1) / tile_size, (grid_size.y + tile_size - 1) / tile_size };
+        values.assign(size_t(grid_size.x) * grid_size.y, value_range.x);
+        // decals are created on the next draw since a renderer is needed for them
+        tiles.clear();
+        // cached frames still point at the old decals
+        request_redraw();
+        tiles.resize(size_t(tile_count.x) * tile_count.y);
+        fit_view();
     }
 
-    template <typename T>
-    void FUI_Element::set_slider_value(T value)
+    const olc::vi2d FUI_Canvas::get_grid_size()
     {
-        if (ui_type == FUI_Type::SLIDER)
-        {
-            switch (slider_type)
-            {
-            case type::FLOAT:
-                if (value > range.y)
-                    slider_value_float = range.y;
-                else if (value < range.x)
-                    slider_value_float = range.x;
-                else
-                    slider_value_float = value;
-            case type::INT:
-                if (value > range.y)
-                    slider_value_int = range.y;
-                else if (value < range.x)
-                    slider_value_int = range.x;
-                else
-                    slider_value_int = value;
-            }
-        }
-        else
-            std::cout << "Trying to set_slider_value on wrong UI_TYPE\n";
+        return grid_size;
     }
 
-    template <typename T>
-    const T FUI_Element::get_slider_value()
+    void FUI_Canvas::mark_dirty(olc::vi2d cell_position, olc::vi2d cell_size)
     {
-        if (ui_type == FUI_Type::SLIDER)
+        int first_x = std::max(0, cell_position.x) / tile_size;
+        int first_y = std::max(0, cell_position.y) / tile_size;
+        int last_x = std::min(tile_count.x - 1, (cell_position.x + cell_size.x - 1) / tile_size);
+        int last_y = std::min(tile_count.y - 1, (cell_position.y + cell_size.y - 1) / tile_size);
+        for (int y = first_y; y <= last_y; y++)
+            for (int x = first_x; x <= last_x; x++)
+                tiles[size_t(y) * tile_count.x + x].dirty = true;
+    }
+
+    void FUI_Canvas::set_values(const float* v)
+    {
+        // compare tile by tile so unchanged tiles keep their uploaded texture
+        for (int ty = 0; ty < tile_count.y; ty++)
         {
-            switch (slider_type)
+            for (int tx = 0; tx < tile_count.x; tx++)
             {
-            case type::FLOAT:
-                return T(slider_value_float);
-            case type::INT:
-                return T(slider_value_int);
+                auto& tile = tiles[size_t(ty) * tile_count.x + tx];
+                int width = std::min(tile_size, grid_size.x - tx * tile_size);
+                int height = std::min(tile_size, grid_size.y - ty * tile_size);
+                for (int y = 0; y < height; y++)
+                {
+                    size_t offset = size_t(ty * tile_size + y) * grid_size.x + tx * tile_size;
+                    if (tile.dirty || std::memcmp(&values[offset], v + offset, width * sizeof(float)) != 0)
+                    {
+                        std::memcpy(&values[offset], v + offset, width * sizeof(float));
+                        tile.dirty = true;
+                        values_changed = true;
+                    }
+                }
             }
         }
-        else
-            std::cout << "Trying to get_slider_value on wrong UI_TYPE\n";
-
-        return T(-1);
     }
 
-    const std::string FUI_Element::get_inputfield_value()
+    void FUI_Canvas::set_region(olc::vi2d cell_position, olc::vi2d cell_size, const float* v, int stride)
     {
-        if (ui_type == FUI_Type::INPUTFIELD)
-            return inputfield_text;
-        else
-            std::cout << "Trying to get_inputfield_value on wrong UI_TYPE\n";
+        int first_x = std::max(0, cell_position.x);
+        int first_y = std::max(0, cell_position.y);
+        int last_x = std::min(grid_size.x, cell_position.x + cell_size.x);
+        int last_y = std::min(grid_size.y, cell_position.y + cell_size.y);
+        if (first_x >= last_x || first_y >= last_y)
+            return;
 
-        return "";
-    }
+        for (int y = first_y; y < last_y; y++)
+            std::memcpy(&values[size_t(y) * grid_size.x + first_x], v + size_t(y - cell_position.y) * stride + (first_x - cell_position.x), (last_x - first_x) * sizeof(float));
 
-    void FUI_Element::clear_inputfield_value()
-    {
-        if (ui_type == FUI_Type::INPUTFIELD)
-            clear_inputfield = true;
-        else
-            std::cout << "Trying to clear_inputfield_value on wrong UI_TYPE\n";
+        mark_dirty({ first_x, first_y }, { last_x - first_x, last_y - first_y });
+        values_changed = true;
     }
 
-    void FUI_Element::set_inputfield_value(std::string value)
+    void FUI_Canvas::set_value(olc::vi2d cell, float value)
     {
-        if (ui_type == FUI_Type::INPUTFIELD)
-            set_input_text = value;
-        else
-            std::cout << "Trying to set_inputfield_value on wrong UI_TYPE\n";
+        if (cell.x < 0 || cell.y < 0 || cell.x >= grid_size.x || cell.y >= grid_size.y)
+            return;
+
+        values[size_t(cell.y) * grid_size.x + cell.x] = value;
+        tiles[size_t(cell.y / tile_size) * tile_count.x + cell.x / tile_size].dirty = true;
+        values_changed = true;
     }
 
-    void FUI_Element::mask_inputfield_value(bool state)
+    bool FUI_Canvas::update(olc::PixelGameEngine* pge)
     {
-        mask_inputfield = state;
+        FUI_Element::update(pge);
+        bool changed = values_changed;
+        values_changed = false;
+        return changed;
     }
 
-    olc::vf2d FUI_Element::get_text_size(olc::PixelGameEngine* pge)
+    const float FUI_Canvas::get_value(olc::vi2d cell)
     {
-        return static_cast<olc::vf2d>(pge->GetTextSizeProp(text)) * text_scale;
+        if (cell.x < 0 || cell.y < 0 || cell.x >= grid_size.x || cell.y >= grid_size.y)
+            return 0.f;
+
+        return values[size_t(cell.y) * grid_size.x + cell.x];
     }
 
-    void FUI_Element::add_texture(olc::Decal* txtr, std::vector<olc::vi2d> texture_pos, olc::vi2d s)
+    void FUI_Canvas::set_colormap(const std::vector<olc::Pixel>& stops)
     {
-        texture = txtr;
-        texture_positions = texture_pos;
-        texture_size = s;
-
-        texture_scale = { static_cast<float>(size.x) / static_cast<float>(s.x), static_cast<float>(size.y) / static_cast<float>(s.y) };
-        size = { std::round(s.x * texture_scale.x), std::round(s.y * texture_scale.y) };
-        has_textures = true;
+        request_redraw();
+        if (stops.empty())
+            return;
 
-        // warning messages
-        switch (ui_type)
+        for (int i = 0; i < 256; i++)
         {
-        case FUI_Type::BUTTON:
-            if (toggleable)
+            if (stops.size() == 1)
             {
-                if (texture_positions.size() < 4)
-                    std::cout << "There's not enough sprites to cover all toggle button states\n";
+                colormap[i] = stops[0];
+                continue;
             }
-            else
-                if (texture_positions.size() < 3)
-                    std::cout << "There's not enough sprites to cover all button states\n";
-            break;
-        case FUI_Type::CHECKBOX:
-            if (texture_positions.size() < 4)
-                std::cout << "There's not enough sprites to cover all checkbox state\n";
-            break;
+            float t = (i / 255.f) * (stops.size() - 1);
+            int stop = std::min(int(t), int(stops.size()) - 2);
+            colormap[i] = olc::PixelLerp(stops[stop], stops[stop + 1], t - stop);
         }
+
+        for (auto& tile : tiles)
+            tile.dirty = true;
     }
 
-    void FUI_Element::set_on_enter_callback(std::function<void()> callback)
+    void FUI_Canvas::set_value_range(olc::vf2d range)
     {
-        if (ui_type == FUI_Type::INPUTFIELD)
-        {
-            input_enter_callback = callback;
-        }
-        else
-            std::cout << "Trying to set_on_enter_action on wrong UI_TYPE\n";
+        request_redraw();
+        value_range = range;
+        for (auto& tile : tiles)
+            tile.dirty = true;
     }
 
-    void FUI_Element::run_callback()
+    void FUI_Canvas::set_view(olc::vf2d offset, float z)
     {
-        if (ui_type == FUI_Type::BUTTON)
-        {
-            callback();
-        }
-        else
-            std::cout << "Trying to run_callback on wrong UI_TYPE\n";
+        if (offset != view_offset || z != zoom)
+            request_redraw();
+        view_offset = offset;
+        zoom = std::max(0.01f, z);
     }
 
-    void FUI_Element::add_command_handler(std::function<void(std::string&, std::string*)> handler)
+    void FUI_Canvas::fit_view()
     {
-        if (ui_type == FUI_Type::CONSOLE)
-            command_handler = handler;
-        else
-            std::cout << "Trying to add_command_handler to wrong UI_TYPE\n";
+        view_offset = { 0.f, 0.f };
+        if (grid_size.x > 0 && grid_size.y > 0)
+            zoom = std::max(0.01f, std::min(size.x / grid_size.x, size.y / grid_size.y));
     }
 
-    void FUI_Element::add_command_entry(std::string& entry)
+    const olc::vi2d FUI_Canvas::get_hovered_cell(olc::PixelGameEngine*)
     {
-        if (ui_type == FUI_Type::CONSOLE)
-            command_entry = entry;
-        else
-            std::cout << "Trying to add_command_entry to wrong UI_TYPE\n";
+        olc::vf2d mouse = static_cast<olc::vf2d>(frame->mouse_position) - get_absolute_position();
+        if (mouse.x < 0.f || mouse.y < 0.f || mouse.x >= size.x || mouse.y >= size.y)
+            return { -1, -1 };
+
+        olc::vf2d cell = view_offset + mouse / zoom;
+        if (cell.x < 0.f || cell.y < 0.f || cell.x >= grid_size.x || cell.y >= grid_size.y)
+            return { -1, -1 };
+
+        return { int(cell.x), int(cell.y) };
     }
 
-    void FUI_Element::clear_console()
-    {
-        if (ui_type == FUI_Type::CONSOLE)
-            should_clear_console = true;
-        else
-            std::cout << "Trying to clear_console on wrong UI_TYPE\n";
+    void FUI_Canvas::input(olc::PixelGameEngine*)
+    {
+        olc::vf2d mouse = static_cast<olc::vf2d>(frame->mouse_position) - absolute_position;
+        bool is_hovered = mouse.x >= 0.f && mouse.x <= size.x && mouse.y >= 0.f && mouse.y <= size.y;
+
+        // zoom around the cell under the mouse
+        if (is_hovered && frame->mouse_wheel != 0)
+        {
+            olc::vf2d anchor = view_offset + mouse / zoom;
+            zoom = std::min(256.f, std::max(0.01f, frame->mouse_wheel > 0 ? zoom * 1.25f : zoom / 1.25f));
+            view_offset = anchor - mouse / zoom;
+            request_redraw();
+        }
+
+        if (is_hovered && frame->get_mouse(0).bPressed)
+        {
+            panning = true;
+            pan_start = view_offset + mouse / zoom;
+        }
+        if (panning)
+        {
+            view_offset = pan_start - mouse / zoom;
+            request_redraw();
+            if (frame->get_mouse(0).bReleased || !frame->get_mouse(0).bHeld)
+                panning = false;
+        }
     }
 
-    void FUI_Element::set_checkbox_state(bool state)
+    void FUI_Canvas::update_tile(int tile_x, int tile_y)
     {
-        if (ui_type == FUI_Type::CHECKBOX)
-            checkbox_state = state;
+        auto& tile = tiles[size_t(tile_y) * tile_count.x + tile_x];
+        int width = std::min(tile_size, grid_size.x - tile_x * tile_size);
+        int height = std::min(tile_size, grid_size.y - tile_y * tile_size);
+
+        if (!tile.sprite)
+            tile.sprite = std::make_unique<olc::Sprite>(width, height);
+
+        float scale = value_range.y != value_range.x ? 255.f / (value_range.y - value_range.x) : 0.f;
+        uint8_t indices[tile_size];
+        olc::Pixel* pixels = tile.sprite->GetData();
+        for (int y = 0; y < height; y++)
+        {
+            const float* row = &values[size_t(tile_y * tile_size + y) * grid_size.x + tile_x * tile_size];
+            fui_map_indices(row, indices, width, value_range.x, scale);
+            for (int x = 0; x < width; x++)
+                pixels[y * width + x] = colormap[indices[x]];
+        }
+
+        // the decal is created after the first fill so new tiles are only uploaded once
+        if (!tile.decal)
+            tile.decal = std::make_unique<olc::Decal>(tile.sprite.get());
         else
-            std::cout << "Trying to set_checkbox_state on wrong UI_TYPE\n";
+            tile.decal->Update();
+        tile.dirty = false;
     }
 
-    const bool FUI_Element::get_checkbox_state()
+    void FUI_Canvas::draw(olc::PixelGameEngine* pge)
     {
-        if (ui_type == FUI_Type::CHECKBOX)
-            return checkbox_state;
-        else
-            std::cout << "Trying to get_checkbox_state on wrong UI_TYPE\n";
+        absolute_position = get_absolute_position();
 
-        return false;
+        // outline
+        pge->FillRectDecal(absolute_position - olc::vf2d{ 1.f, 1.f }, size + olc::vf2d{ 2.f, 2.f }, color_scheme.canvas_outline);
+        // body
+        pge->FillRectDecal(absolute_position, size, color_scheme.canvas_background);
+
+        if (grid_size.x == 0 || grid_size.y == 0)
+            return;
+
+        // visible cells, every tile is cut down to them so nothing is drawn outside the canvas
+        olc::vf2d view_start = { std::max(0.f, view_offset.x), std::max(0.f, view_offset.y) };
+        olc::vf2d view_end = { std::min(float(grid_size.x), view_offset.x + size.x / zoom), std::min(float(grid_size.y), view_offset.y + size.y / zoom) };
+        if (view_start.x >= view_end.x || view_start.y >= view_end.y)
+            return;
+
+        int first_x = int(view_start.x) / tile_size;
+        int first_y = int(view_start.y) / tile_size;
+        int last_x = std::min(tile_count.x - 1, int(std::ceil(view_end.x)) / tile_size);
+        int last_y = std::min(tile_count.y - 1, int(std::ceil(view_end.y)) / tile_size);
+
+        for (int ty = first_y; ty <= last_y; ty++)
+        {
+            for (int tx = first_x; tx <= last_x; tx++)
+            {
+                olc::vf2d tile_start = { float(tx * tile_size), float(ty * tile_size) };
+                olc::vf2d tile_end = { std::min(float(grid_size.x), tile_start.x + tile_size), std::min(float(grid_size.y), tile_start.y + tile_size) };
+                olc::vf2d start = { std::max(tile_start.x, view_start.x), std::max(tile_start.y, view_start.y) };
+                olc::vf2d end = { std::min(tile_end.x, view_end.x), std::min(tile_end.y, view_end.y) };
+                if (start.x >= end.x || start.y >= end.y)
+                    continue;
+
+                auto& tile = tiles[size_t(ty) * tile_count.x + tx];
+                // tiles that are out of view stay dirty until they're scrolled in
+                if (tile.dirty)
+                    update_tile(tx, ty);
+
+                pge->DrawPartialDecal(absolute_position + (start - view_offset) * zoom, (end - start) * zoom,
+                    tile.decal.get(), start - tile_start, end - start);
+            }
+        }
     }
 
     /*
     ####################################################
-    #               FUI_LABEL START                    #
+    #               FUI_FILEVIEW START                 #
     ####################################################
     */
-    FUI_Label::FUI_Label(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p)
+    FUI_MappedFile::~FUI_MappedFile()
     {
-        identifier = id;
-        parent = pt;
-        text = t;
-        position = p;
-        ui_type = FUI_Type::LABEL;
+        close();
     }
 
-    FUI_Label::FUI_Label(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p)
+    bool FUI_MappedFile::open(const std::string& path)
     {
-        identifier = id;
-        parent = pt;
-        text = t;
-        position = p;
-        group = g;
-        ui_type = FUI_Type::LABEL;
-    }
+        close();
+#if defined(_WIN32)
+        file_handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_handle == INVALID_HANDLE_VALUE)
+            return false;
 
-    FUI_Label::FUI_Label(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p)
-    {
-        identifier = id;
-        text = t;
-        position = p;
-        group = g;
-        ui_type = FUI_Type::LABEL;
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file_handle, &file_size))
+        {
+            close();
+            return false;
+        }
+        length = uint64_t(file_size.QuadPart);
+
+        // empty files can't be mapped
+        if (length > 0)
+        {
+            mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!mapping_handle)
+            {
+                close();
+                return false;
+            }
+            data = static_cast<const char*>(MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0));
+            if (!data)
+            {
+                close();
+                return false;
+            }
+        }
+#else
+        int descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor < 0)
+            return false;
+
+        struct stat info;
+        if (fstat(descriptor, &info) != 0)
+        {
+            ::close(descriptor);
+            return false;
+        }
+        length = uint64_t(info.st_size);
+
+        // empty files can't be mapped
+        if (length > 0)
+        {
+            void* mapping = mmap(nullptr, size_t(length), PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (mapping == MAP_FAILED)
+            {
+                ::close(descriptor);
+                length = 0;
+                return false;
+            }
+            data = static_cast<const char*>(mapping);
+        }
+        // the mapping stays valid after the descriptor is closed
+        ::close(descriptor);
+#endif
+        opened = true;
+        return true;
     }
 
-    FUI_Label::FUI_Label(const std::string& id, const std::string& t, olc::vi2d p)
+    void FUI_MappedFile::close()
     {
-        identifier = id;
-        text = t;
-        position = p;
-        ui_type = FUI_Type::LABEL;
+#if defined(_WIN32)
+        if (data)
+            UnmapViewOfFile(data);
+        if (mapping_handle)
+            CloseHandle(mapping_handle);
+        if (file_handle != INVALID_HANDLE_VALUE)
+            CloseHandle(file_handle);
+        mapping_handle = nullptr;
+        file_handle = INVALID_HANDLE_VALUE;
+#else
+        if (data)
+            munmap(const_cast<char*>(data), size_t(length));
+#endif
+        data = nullptr;
+        length = 0;
+        opened = false;
     }
 
-    void FUI_Label::draw(olc::PixelGameEngine* pge)
+    void FUI_MappedFile::release(uint64_t offset, uint64_t size)
     {
-        // Adapt positioning depending on if there's a parent to the element or not
-        absolute_position = get_absolute_position();
-
-        pge->DrawStringPropDecal(absolute_position, text, text_color, text_scale);
+#if !defined(_WIN32)
+        uint64_t page = uint64_t(sysconf(_SC_PAGESIZE));
+        uint64_t start = offset - (offset % page);
+        uint64_t end = std::min(offset + size, length);
+        if (data && end > start)
+            madvise(const_cast<char*>(data) + start, size_t(end - start), MADV_DONTNEED);
+#endif
     }
 
-    /*
-    ####################################################
-    #               FUI_BUTTON START                   #
-    ####################################################
-    */
-    FUI_Button::FUI_Button(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s, std::function<void()> cb)
+    FUI_FileView::FUI_FileView(const std::string& id, FUI_Window* pt, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
-        text = t;
         size = s;
         parent = pt;
         position = p;
-        callback = cb;
-        ui_type = FUI_Type::BUTTON;
+        ui_type = FUI_Type::FILEVIEW;
     }
 
-    FUI_Button::FUI_Button(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s, std::function<void()> cb)
+    FUI_FileView::FUI_FileView(const std::string& id, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
-        text = t;
         size = s;
         position = p;
-        callback = cb;
-        ui_type = FUI_Type::BUTTON;
+        ui_type = FUI_Type::FILEVIEW;
     }
 
-    FUI_Button::FUI_Button(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s, std::function<void()> cb)
+    FUI_FileView::FUI_FileView(const std::string& id, FUI_Window* pt, const std::string& g, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
-        text = t;
         size = s;
         parent = pt;
         position = p;
-        callback = cb;
         group = g;
-        ui_type = FUI_Type::BUTTON;
+        ui_type = FUI_Type::FILEVIEW;
     }
 
-    FUI_Button::FUI_Button(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s, std::function<void()> cb)
+    FUI_FileView::FUI_FileView(const std::string& id, const std::string& g, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
-        text = t;
         size = s;
         position = p;
-        callback = cb;
         group = g;
-        ui_type = FUI_Type::BUTTON;
+        ui_type = FUI_Type::FILEVIEW;
     }
 
-    void FUI_Button::draw(olc::PixelGameEngine* pge)
+    FUI_FileView::~FUI_FileView()
     {
-        absolute_position = get_absolute_position();
+        close();
+    }
 
-        if (has_textures)
+    bool FUI_FileView::open(const std::string& path)
+    {
+        request_redraw();
+        close();
+        if (!file.open(path))
         {
-            // Draw the body of the button
-            switch (state)
-            {
-            case State::NONE:
-                pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::NONE)], texture_size, texture_scale);
-                break;
-            case State::HOVER:
-                if (texture_positions.size() > 1)
-                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::HOVER)], texture_size, texture_scale);
-                else
-                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::NONE)], texture_size, texture_scale);
-                break;
-            case State::CLICK:
-                if (texture_positions.size() > 2)
-                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::CLICK)], texture_size, texture_scale);
-                else
-                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::NONE)], texture_size, texture_scale);
-                break;
-            case State::ACTIVE:
-                if (texture_positions.size() > 3)
-                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::CLICK)], texture_size, texture_scale);
-                else
-                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::NONE)], texture_size, texture_scale);
-                break;
-            }
+            std::cout << "Could not map file " + path + " (function affected: open, fileview_id affected: " + identifier + ")\n";
+            return false;
         }
-        else
+
+        first_row = 0;
+        first_column = 0;
+        cancel_indexing = false;
+        indexing = true;
+        index_thread = std::thread(&FUI_FileView::build_index, this);
+        return true;
+    }
+
+    void FUI_FileView::close()
+    {
+        request_redraw();
+        stop_indexing();
+        file.close();
+        checkpoints.clear();
+        indexed_lines = 0;
+        first_row = 0;
+    }
+
+    void FUI_FileView::stop_indexing()
+    {
+        cancel_indexing = true;
+        if (index_thread.joinable())
+            index_thread.join();
+        indexing = false;
+    }
+
+    const uint64_t FUI_FileView::next_line(uint64_t offset)
+    {
+        uint64_t remaining = std::min(file.get_size() - offset, max_line_length);
+        auto newline = static_cast<const char*>(std::memchr(file.get_data() + offset, '\n', size_t(remaining)));
+        return newline ? uint64_t(newline - file.get_data()) + 1 : offset + remaining;
+    }
+
+    void FUI_FileView::build_index()
+    {
+        // pages behind the indexer are dropped so scanning a huge file doesn't keep it all resident
+        const uint64_t release_interval = 64ull << 20;
+        uint64_t released = 0;
+        uint64_t offset = 0;
+        uint64_t line = 0;
+        while (offset < file.get_size() && !cancel_indexing.load(std::memory_order_relaxed))
         {
-            auto text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(text))* text_scale;
+            if (offset - released >= release_interval)
+            {
+                file.release(released, offset - released);
+                released = offset;
+            }
 
-            // Draw the body of the button
-            switch (state)
+            if (line % checkpoint_interval == 0)
             {
-            case State::NONE:
-                pge->FillRectDecal(absolute_position, size, color_scheme.button_normal);
-                break;
-            case State::HOVER:
-                pge->FillRectDecal(absolute_position, size, color_scheme.button_hover);
-                break;
-            case State::CLICK:
-                pge->FillRectDecal(absolute_position, size, color_scheme.button_click);
-                break;
-            case State::ACTIVE:
-                pge->FillRectDecal(absolute_position, size, color_scheme.button_active);
-                break;
+                std::lock_guard<std::mutex> lock(checkpoint_mutex);
+                checkpoints.push_back(offset);
             }
-            // Draw the text
-            olc::vf2d text_position = olc::vf2d{ absolute_position.x + (size.x / 2) - (text_size.x / 2),
-                absolute_position.y + (size.y / 2) - (text_size.y / 2) };
-            pge->DrawStringPropDecal(text_position, text, text_color, text_scale);
+            offset = next_line(offset);
+            line++;
+            // lines only become visible once their checkpoint exists
+            if (line % checkpoint_interval == 0)
+                indexed_lines.store(line, std::memory_order_release);
         }
+        indexed_lines.store(line, std::memory_order_release);
+        indexing = false;
     }
 
-    void FUI_Button::input(olc::PixelGameEngine* pge)
+    const uint64_t FUI_FileView::get_line_offset(uint64_t line)
     {
-        if (!toggleable)
+        uint64_t offset = 0;
         {
-            if (pge->GetMousePos().x >= absolute_position.x &&
-                pge->GetMousePos().x <= absolute_position.x + size.x &&
-                pge->GetMousePos().y >= absolute_position.y &&
-                pge->GetMousePos().y <= absolute_position.y + size.y)
-            {
-                if (pge->GetMouse(0).bPressed)
-                    state = State::CLICK;
-                else if (pge->GetMouse(0).bReleased && state == State::CLICK)
-                {
-                    callback();
-                    state = State::HOVER;
-                }
-
-                if (state != State::CLICK)
-                    state = State::HOVER;
-            }
-            else
-                state = State::NONE;
+            std::lock_guard<std::mutex> lock(checkpoint_mutex);
+            if (line / checkpoint_interval < checkpoints.size())
+                offset = checkpoints[line / checkpoint_interval];
         }
+        for (uint64_t i = 0; i < line % checkpoint_interval && offset < file.get_size(); i++)
+            offset = next_line(offset);
+        return offset;
+    }
+
+    void FUI_FileView::set_mode(Mode m)
+    {
+        if (mode == m)
+            return;
+        request_redraw();
+
+        // keep roughly the same part of the file in view
+        if (m == Mode::HEX)
+            first_row = int64_t(get_line_offset(uint64_t(first_row)) / bytes_per_row);
         else
+            first_row = 0;
+        mode = m;
+        first_column = 0;
+    }
+
+    const FUI_FileView::Mode FUI_FileView::get_mode()
+    {
+        return mode;
+    }
+
+    const uint64_t FUI_FileView::get_row_count()
+    {
+        if (mode == Mode::HEX)
+            return (file.get_size() + bytes_per_row - 1) / bytes_per_row;
+
+        return indexed_lines.load(std::memory_order_acquire);
+    }
+
+    const bool FUI_FileView::is_indexing()
+    {
+        return indexing;
+    }
+
+    void FUI_FileView::scroll_to_row(int64_t row)
+    {
+        int rows_in_view = std::max(1, int(size.y / row_height));
+        int64_t max_row = std::max<int64_t>(0, int64_t(get_row_count()) - rows_in_view);
+        first_row = std::max<int64_t>(0, std::min(row, max_row));
+    }
+
+    void FUI_FileView::scroll_rows(int64_t amount)
+    {
+        scroll_to_row(first_row + amount);
+    }
+
+    const int64_t FUI_FileView::get_first_row()
+    {
+        return first_row;
+    }
+
+    void FUI_FileView::set_row_height(float height)
+    {
+        request_redraw();
+        row_height = std::max(1.f, height);
+    }
+
+    void FUI_FileView::input(olc::PixelGameEngine*)
+    {
+        auto mouse = frame->mouse_position;
+        if (!(mouse.x >= absolute_position.x && mouse.x <= absolute_position.x + size.x &&
+            mouse.y >= absolute_position.y && mouse.y < absolute_position.y + size.y))
+            return;
+
+        int rows_in_view = std::max(1, int(size.y / row_height));
+
+        // shift scrolls sideways through long lines
+        if (frame->get_key(olc::Key::SHIFT).bHeld && mode == Mode::TEXT)
         {
-            if (pge->GetMousePos().x >= absolute_position.x &&
-                pge->GetMousePos().x <= absolute_position.x + size.x &&
-                pge->GetMousePos().y >= absolute_position.y &&
-                pge->GetMousePos().y <= absolute_position.y + size.y)
-            {
-                if (pge->GetMouse(0).bPressed)
-                {
-                    if (state == State::ACTIVE)
-                        was_active = true;
+            if (frame->mouse_wheel > 0)
+                first_column = std::max(0, first_column - 8);
+            else if (frame->mouse_wheel < 0)
+                first_column = std::min(int(max_line_length), first_column + 8);
+        }
+        else if (frame->mouse_wheel > 0)
+            scroll_rows(-3);
+        else if (frame->mouse_wheel < 0)
+            scroll_rows(3);
+
+        if (frame->get_key(olc::Key::PGUP).bPressed)
+            scroll_rows(-rows_in_view);
+        if (frame->get_key(olc::Key::PGDN).bPressed)
+            scroll_rows(rows_in_view);
+        if (frame->get_key(olc::Key::HOME).bPressed)
+            scroll_to_row(0);
+        if (frame->get_key(olc::Key::END).bPressed)
+            scroll_to_row(int64_t(get_row_count()));
+    }
+
+    void FUI_FileView::draw_text(olc::PixelGameEngine* pge, int rows_in_view)
+    {
+        uint64_t row_count = get_row_count();
+        int max_columns = std::max(1, int((size.x - 4.f) / (8.f * text_scale.x)));
+        float text_offset = (row_height - 8.f * text_scale.y) / 2.f;
+
+        // one lookup for the first row, every row after it is found from the previous one
+        uint64_t offset = get_line_offset(uint64_t(first_row));
+        for (int i = 0; i < rows_in_view && uint64_t(first_row + i) < row_count; i++)
+        {
+            uint64_t end = next_line(offset);
+            uint64_t line_end = end;
+            while (line_end > offset && (file.get_data()[line_end - 1] == '\n' || file.get_data()[line_end - 1] == '\r'))
+                line_end--;
+
+            uint64_t start = std::min(line_end, offset + first_column);
+            uint64_t stop = std::min(line_end, start + max_columns);
+            scratch.assign(file.get_data() + start, size_t(stop - start));
+            for (auto& c : scratch)
+                if (c < 32 || c > 126)
+                    c = c == '\t' ? ' ' : '.';
+
+            pge->DrawStringDecal(olc::vf2d{ absolute_position.x + 2.f, absolute_position.y + row_height * i + text_offset }, scratch, color_scheme.fileview_text, text_scale);
+            offset = end;
+        }
+    }
 
-                    state = State::CLICK;
-                }
-                else if (pge->GetMouse(0).bReleased && state == State::CLICK)
-                {
-                    if (was_active)
-                    {
-                        state = State::HOVER;
-                        was_active = false;
-                    }
-                    else
-                        state = State::ACTIVE;
-                }
+    void FUI_FileView::draw_hex(olc::PixelGameEngine* pge, int rows_in_view)
+    {
+        static const char digits[] = "0123456789abcdef";
+        uint64_t row_count = get_row_count();
+        float char_width = 8.f * text_scale.x;
+        float text_offset = (row_height - 8.f * text_scale.y) / 2.f;
 
-                if (state != State::CLICK && state != State::ACTIVE)
-                    state = State::HOVER;
+        for (int i = 0; i < rows_in_view && uint64_t(first_row + i) < row_count; i++)
+        {
+            uint64_t offset = uint64_t(first_row + i) * bytes_per_row;
+            int count = int(std::min<uint64_t>(bytes_per_row, file.get_size() - offset));
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(file.get_data() + offset);
+            olc::vf2d row_position = { absolute_position.x + 2.f, absolute_position.y + row_height * i + text_offset };
+
+            scratch.clear();
+            for (int shift = 36; shift >= 0; shift -= 4)
+                scratch.push_back(digits[(offset >> shift) & 0xF]);
+            pge->DrawStringDecal(row_position, scratch, color_scheme.fileview_offset, text_scale);
+
+            scratch.clear();
+            for (int b = 0; b < bytes_per_row; b++)
+            {
+                if (b == bytes_per_row / 2)
+                    scratch.push_back(' ');
+                scratch.push_back(b < count ? digits[bytes[b] >> 4] : ' ');
+                scratch.push_back(b < count ? digits[bytes[b] & 0xF] : ' ');
+                scratch.push_back(' ');
             }
-            else if (state == State::CLICK && was_active)
-                state = State::ACTIVE;
-            else if (state != State::ACTIVE)
-                state = State::NONE;
+            scratch.push_back(' ');
+            for (int b = 0; b < count; b++)
+                scratch.push_back(bytes[b] >= 32 && bytes[b] <= 126 ? char(bytes[b]) : '.');
+            pge->DrawStringDecal(row_position + olc::vf2d{ char_width * 12.f, 0.f }, scratch, color_scheme.fileview_text, text_scale);
+        }
+    }
+
+    void FUI_FileView::draw(olc::PixelGameEngine* pge)
+    {
+        absolute_position = get_absolute_position();
+
+        // outline
+        pge->FillRectDecal(absolute_position - olc::vf2d{ 1.f, 1.f }, size + olc::vf2d{ 2.f, 2.f }, color_scheme.fileview_outline);
+        // body
+        pge->FillRectDecal(absolute_position, size, color_scheme.fileview_background);
 
-            if (state == State::ACTIVE)
-                button_state = true;
-            else
-                button_state = false;
+        if (!file.is_open())
+            return;
+
+        int rows_in_view = std::max(1, int(size.y / row_height));
+        if (mode == Mode::HEX)
+            draw_hex(pge, rows_in_view);
+        else
+            draw_text(pge, rows_in_view);
+
+        uint64_t row_count = get_row_count();
+        if (row_count > uint64_t(rows_in_view))
+        {
+            float scroll_size = std::max(8.f, size.y * float(double(rows_in_view) / row_count));
+            float scroll_y_pos = (size.y - scroll_size) * float(double(first_row) / (row_count - rows_in_view));
+            pge->FillRectDecal({ absolute_position.x + size.x - 3, absolute_position.y + std::min(scroll_y_pos, size.y - scroll_size) }, { 3, scroll_size }, color_scheme.scroll_indicator);
         }
     }
 
     /*
     ####################################################
-    #               FUI_CHECKBOX START                 #
+    #               FUI_LOGTAIL START                  #
     ####################################################
     */
-    FUI_Checkbox::FUI_Checkbox(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s)
+    FUI_LogTail::FUI_LogTail(const std::string& id, FUI_Window* pt, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
-        text = t;
         size = s;
         parent = pt;
         position = p;
-        ui_type = FUI_Type::CHECKBOX;
+        ui_type = FUI_Type::LOGTAIL;
     }
 
-    FUI_Checkbox::FUI_Checkbox(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s)
+    FUI_LogTail::FUI_LogTail(const std::string& id, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
-        text = t;
         size = s;
         position = p;
-        ui_type = FUI_Type::CHECKBOX;
+        ui_type = FUI_Type::LOGTAIL;
     }
 
-    FUI_Checkbox::FUI_Checkbox(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    FUI_LogTail::FUI_LogTail(const std::string& id, FUI_Window* pt, const std::string& g, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
-        text = t;
         size = s;
         parent = pt;
         position = p;
         group = g;
-        ui_type = FUI_Type::CHECKBOX;
+        ui_type = FUI_Type::LOGTAIL;
     }
 
-    FUI_Checkbox::FUI_Checkbox(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    FUI_LogTail::FUI_LogTail(const std::string& id, const std::string& g, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
-        text = t;
         size = s;
         position = p;
         group = g;
-        ui_type = FUI_Type::CHECKBOX;
+        ui_type = FUI_Type::LOGTAIL;
     }
 
-    void FUI_Checkbox::draw(olc::PixelGameEngine* pge)
+    FUI_LogTail::~FUI_LogTail()
     {
-        absolute_position = get_absolute_position();
-
-        // Draw the text
-        auto text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(text))* text_scale;
-        auto text_position = olc::vf2d{ absolute_position.x - text_size.x, absolute_position.y + (size.y / 2) - (text_size.y / 2) };
+        close();
+    }
 
-        if (!has_textures)
+    bool FUI_LogTail::open(const std::string& p, bool from_end)
+    {
+        request_redraw();
+        close();
+        path = p;
+        clear_lines();
+        if (!open_stream(from_end))
         {
-            pge->FillRectDecal(absolute_position, size, color_scheme.checkbox_normal);
-            pge->DrawStringPropDecal(text_position, text, text_color, text_scale);
+            std::cout << "Could not open file " + path + " (function affected: open, logtail_id affected: " + identifier + ")\n";
+            return false;
         }
-        olc::vf2d checkbox_filling = olc::vf2d{ 1.0f, 1.0f };
-        // Draw the body of the checkbox
-        if (has_textures)
+        return true;
+    }
+
+    bool FUI_LogTail::open_stream(bool from_end)
+    {
+        stream.close();
+        stream.clear();
+        stream.open(path, std::ios::binary);
+        if (!stream.is_open())
+            return false;
+
+        read_offset = 0;
+        skip_partial = false;
+        if (from_end)
         {
-            switch (state)
+            // start a bit before the end and drop the first, probably cut off, line
+            stream.seekg(0, std::ios::end);
+            uint64_t file_size = uint64_t(stream.tellg());
+            const uint64_t context = 64 << 10;
+            if (file_size > context)
             {
-            case State::NONE:
-                pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::NONE)], texture_size, texture_scale);
-                break;
-            case State::HOVER:
-                if (texture_positions.size() > 1)
-                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::HOVER)], texture_size, texture_scale);
-                else
-                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::NONE)], texture_size, texture_scale);
-                break;
-            case State::CLICK:
-                if (texture_positions.size() > 2)
-                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::CLICK)], texture_size, texture_scale);
-                else
-                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::NONE)], texture_size, texture_scale);
-                break;
-            case State::ACTIVE:
-                if (texture_positions.size() > 3)
-                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::CLICK)], texture_size, texture_scale);
-                else
-                    pge->DrawPartialDecal(absolute_position, texture, texture_positions[static_cast<int>(State::NONE)], texture_size, texture_scale);
-                break;
+                read_offset = file_size - context;
+                skip_partial = true;
             }
         }
-        else
+        pending = true;
+        reopen = false;
+        next_poll = std::chrono::steady_clock::now();
+
+#if defined(__linux__)
+        close_watch();
+        notify_descriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (notify_descriptor >= 0)
+            watch_descriptor = inotify_add_watch(notify_descriptor, path.c_str(), IN_MODIFY | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF);
+        // falls back to polling if the watch couldn't be set up
+        if (watch_descriptor < 0)
+            close_watch();
+#endif
+        return true;
+    }
+
+    void FUI_LogTail::close_watch()
+    {
+#if defined(__linux__)
+        if (notify_descriptor >= 0)
+            ::close(notify_descriptor);
+        notify_descriptor = -1;
+        watch_descriptor = -1;
+#endif
+    }
+
+    void FUI_LogTail::close()
+    {
+        request_redraw();
+        close_watch();
+        stream.close();
+        pending = false;
+        reopen = false;
+    }
+
+    void FUI_LogTail::clear_lines()
+    {
+        buffer.clear();
+        buffer_start = 0;
+        line_starts.clear();
+        first_line_number = 0;
+        first_row = 0;
+    }
+
+    void FUI_LogTail::set_limits(size_t lines, size_t bytes)
+    {
+        request_redraw();
+        max_lines = std::max<size_t>(1, lines);
+        max_bytes = std::max<size_t>(1, bytes);
+        evict();
+    }
+
+    void FUI_LogTail::set_read_chunk(size_t bytes)
+    {
+        read_chunk = std::max<size_t>(1, bytes);
+    }
+
+    void FUI_LogTail::set_poll_interval(std::chrono::milliseconds interval)
+    {
+        poll_interval = interval;
+    }
+
+    void FUI_LogTail::set_auto_scroll(bool state)
+    {
+        request_redraw();
+        auto_scroll = state;
+    }
+
+    const bool FUI_LogTail::get_auto_scroll()
+    {
+        return auto_scroll;
+    }
+
+    const size_t FUI_LogTail::get_line_count()
+    {
+        return line_starts.size();
+    }
+
+    const uint64_t FUI_LogTail::get_total_lines()
+    {
+        return first_line_number + line_starts.size();
+    }
+
+    void FUI_LogTail::set_row_height(float height)
+    {
+        request_redraw();
+        row_height = std::max(1.f, height);
+    }
+
+    void FUI_LogTail::append(const char* data, size_t length)
+    {
+        if (skip_partial)
         {
-            switch (state)
-            {
-            case State::NONE:
-                break;
-            case State::HOVER:
-                pge->FillRectDecal(absolute_position + checkbox_filling,
-                    { static_cast<float>(size.x) - 2.0f, static_cast<float>(size.y) - 2.0f }, color_scheme.checkbox_hover);
-                break;
-            case State::CLICK:
-                pge->FillRectDecal(absolute_position + checkbox_filling,
-                    { static_cast<float>(size.x) - 2.0f, static_cast<float>(size.y) - 2.0f }, color_scheme.checkbox_click);
-                break;
-            case State::ACTIVE:
-                pge->FillRectDecal(absolute_position + checkbox_filling,
-                    { static_cast<float>(size.x) - 2.0f, static_cast<float>(size.y) - 2.0f }, color_scheme.checkbox_active);
+            auto newline = static_cast<const char*>(std::memchr(data, '\n', length));
+            if (!newline)
+                return;
+            length -= size_t(newline + 1 - data);
+            data = newline + 1;
+            skip_partial = false;
+        }
+        if (length == 0)
+            return;
+
+        uint64_t end = buffer_start + buffer.size();
+        if (buffer.empty() || buffer.back() == '\n')
+            line_starts.push_back(end);
+        buffer.append(data, length);
+
+        const char* current = data;
+        const char* stop = data + length;
+        while (current < stop)
+        {
+            auto newline = static_cast<const char*>(std::memchr(current, '\n', size_t(stop - current)));
+            uint64_t segment_end = end + uint64_t((newline ? newline : stop) - data);
+            while (segment_end - line_starts.back() > max_line_length)
+                line_starts.push_back(line_starts.back() + max_line_length);
+            if (!newline)
                 break;
-            }
+
+            current = newline + 1;
+            if (current < stop)
+                line_starts.push_back(end + uint64_t(current - data));
         }
+
+        evict();
     }
 
-    void FUI_Checkbox::input(olc::PixelGameEngine* pge)
+    void FUI_LogTail::evict()
     {
-        if (pge->GetMousePos().x >= absolute_position.x &&
-            pge->GetMousePos().x <= absolute_position.x + size.x &&
-            pge->GetMousePos().y >= absolute_position.y &&
-            pge->GetMousePos().y <= absolute_position.y + size.y)
+        int64_t evicted = 0;
+        while (line_starts.size() > 1 &&
+            (line_starts.size() > max_lines || buffer_start + buffer.size() - line_starts.front() > max_bytes))
         {
-            if (pge->GetMouse(0).bPressed)
-            {
-                if (state == State::ACTIVE)
-                    was_active = true;
+            line_starts.pop_front();
+            evicted++;
+        }
+        first_line_number += evicted;
+        first_row = std::max<int64_t>(0, first_row - evicted);
+
+        // the text of evicted lines is only dropped once it's half the buffer, so compacting stays amortized O(1)
+        if (line_starts.empty())
+            return;
+        uint64_t unused = line_starts.front() - buffer_start;
+        if (unused > 0 && unused >= buffer.size() / 2)
+        {
+            buffer.erase(0, size_t(unused));
+            buffer_start += unused;
+        }
+    }
 
-                state = State::CLICK;
-            }
-            else if (pge->GetMouse(0).bReleased && state == State::CLICK)
+    bool FUI_LogTail::update_tail()
+    {
+        if (path.empty())
+            return false;
+
+        auto now = std::chrono::steady_clock::now();
+        bool check = pending;
+        bool polling = true;
+
+#if defined(__linux__)
+        if (notify_descriptor >= 0)
+        {
+            polling = false;
+            alignas(inotify_event) char events[4096];
+            ssize_t length;
+            while ((length = read(notify_descriptor, events, sizeof(events))) > 0)
             {
-                if (was_active)
+                for (char* e = events; e < events + length; e += sizeof(inotify_event) + reinterpret_cast<inotify_event*>(e)->len)
                 {
-                    state = State::HOVER;
-                    was_active = false;
+                    // the file was rotated away, the new one is opened once the rest of the old one is read
+                    if (reinterpret_cast<inotify_event*>(e)->mask & (IN_MOVE_SELF | IN_DELETE_SELF))
+                        reopen = true;
                 }
-                else
-                    state = State::ACTIVE;
+                check = true;
+            }
+        }
+#endif
+        if ((polling || reopen) && now >= next_poll)
+        {
+            check = true;
+            next_poll = now + poll_interval;
+        }
+
+        if (!check)
+            return false;
+
+        bool changed = false;
+        if (stream.is_open())
+        {
+            stream.clear();
+            stream.seekg(0, std::ios::end);
+            uint64_t file_size = uint64_t(stream.tellg());
+
+            // truncated, start over
+            if (file_size < read_offset)
+            {
+                clear_lines();
+                read_offset = 0;
+                skip_partial = false;
+                changed = true;
             }
 
-            if (state != State::CLICK && state != State::ACTIVE)
-                state = State::HOVER;
+            uint64_t amount = std::min<uint64_t>(file_size - read_offset, read_chunk);
+            if (amount > 0)
+            {
+                read_buffer.resize(std::max(read_buffer.size(), read_chunk));
+                stream.seekg(std::streamoff(read_offset));
+                stream.read(read_buffer.data(), std::streamsize(amount));
+                amount = uint64_t(stream.gcount());
+                append(read_buffer.data(), size_t(amount));
+                read_offset += amount;
+                changed = changed || amount > 0;
+            }
+            pending = read_offset < file_size;
         }
-        else if (state == State::CLICK && was_active)
-            state = State::ACTIVE;
-        else if (state != State::ACTIVE)
-            state = State::NONE;
 
-        if (state == State::ACTIVE)
-            checkbox_state = true;
-        else
-            checkbox_state = false;
+        // keeps retrying every poll interval until the new file shows up
+        if (reopen && !pending)
+        {
+            // the old file's last line is finished even without a newline, the new file starts a line of its own
+            if (!buffer.empty() && buffer.back() != '\n')
+                buffer.push_back('\n');
+            open_stream(false);
+        }
+        return changed;
+    }
+
+    bool FUI_LogTail::update(olc::PixelGameEngine* pge)
+    {
+        FUI_Element::update(pge);
+        return update_tail();
+    }
+
+    void FUI_LogTail::scroll_rows(int64_t amount)
+    {
+        int rows_in_view = std::max(1, int(size.y / row_height));
+        int64_t max_row = std::max<int64_t>(0, int64_t(line_starts.size()) - rows_in_view);
+        first_row = std::max<int64_t>(0, std::min(first_row + amount, max_row));
+        // scrolling back to the bottom follows the file again
+        auto_scroll = first_row == max_row;
+    }
+
+    void FUI_LogTail::input(olc::PixelGameEngine*)
+    {
+        auto mouse = frame->mouse_position;
+        if (!(mouse.x >= absolute_position.x && mouse.x <= absolute_position.x + size.x &&
+            mouse.y >= absolute_position.y && mouse.y < absolute_position.y + size.y))
+            return;
+
+        if (frame->mouse_wheel > 0)
+            scroll_rows(-3);
+        else if (frame->mouse_wheel < 0)
+            scroll_rows(3);
+    }
+
+    void FUI_LogTail::draw(olc::PixelGameEngine* pge)
+    {
+        absolute_position = get_absolute_position();
+
+        // outline
+        pge->FillRectDecal(absolute_position - olc::vf2d{ 1.f, 1.f }, size + olc::vf2d{ 2.f, 2.f }, color_scheme.logtail_outline);
+        // body
+        pge->FillRectDecal(absolute_position, size, color_scheme.logtail_background);
+
+        int rows_in_view = std::max(1, int(size.y / row_height));
+        int64_t line_count = int64_t(line_starts.size());
+        if (auto_scroll)
+            first_row = std::max<int64_t>(0, line_count - rows_in_view);
+
+        int max_columns = std::max(1, int((size.x - 4.f) / (8.f * text_scale.x)));
+        float text_offset = (row_height - 8.f * text_scale.y) / 2.f;
+        for (int i = 0; i < rows_in_view && first_row + i < line_count; i++)
+        {
+            size_t line = size_t(first_row + i);
+            size_t start = size_t(line_starts[line] - buffer_start);
+            size_t end = line + 1 < line_starts.size() ? size_t(line_starts[line + 1] - buffer_start) : buffer.size();
+            while (end > start && (buffer[end - 1] == '\n' || buffer[end - 1] == '\r'))
+                end--;
+
+            scratch.assign(buffer.data() + start, std::min(end - start, size_t(max_columns)));
+            for (auto& c : scratch)
+                if (c < 32 || c > 126)
+                    c = c == '\t' ? ' ' : '.';
+
+            pge->DrawStringDecal(olc::vf2d{ absolute_position.x + 2.f, absolute_position.y + row_height * i + text_offset }, scratch, color_scheme.logtail_text, text_scale);
+        }
+
+        if (line_count > rows_in_view)
+        {
+            float scroll_size = std::max(8.f, size.y * (float(rows_in_view) / line_count));
+            float scroll_y_pos = (size.y - scroll_size) * (float(first_row) / (line_count - rows_in_view));
+            pge->FillRectDecal({ absolute_position.x + size.x - 3, absolute_position.y + scroll_y_pos }, { 3, scroll_size }, color_scheme.scroll_indicator);
+        }
+    }
+
+    const double FUI_LogTail::get_next_change()
+    {
+        if (path.empty())
+            return FUI_Element::get_next_change();
+        // more of the file is waiting to be read
+        if (pending)
+            return frame->time;
+#if defined(__linux__)
+        // the watch is read every frame anyway, a sleeping host only has to wake up now and then to read it
+        if (notify_descriptor >= 0 && !reopen)
+            return frame->time + std::chrono::duration<double>(poll_interval).count();
+#endif
+        double wait = std::chrono::duration<double>(next_poll - std::chrono::steady_clock::now()).count();
+        return frame->time + std::max(0.0, wait);
     }
 
     /*
     ####################################################
-    #               FUI_DROPDOWN START                 #
+    #               FUI_TIMELINE START                 #
     ####################################################
     */
-    FUI_Dropdown::FUI_Dropdown(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s)
+    FUI_Timeline::FUI_Timeline(const std::string& id, FUI_Window* pt, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
-        text = t;
         size = s;
         parent = pt;
         position = p;
-        ui_type = FUI_Type::DROPDOWN;
+        ui_type = FUI_Type::TIMELINE;
     }
 
-    FUI_Dropdown::FUI_Dropdown(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s)
+    FUI_Timeline::FUI_Timeline(const std::string& id, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
-        text = t;
         size = s;
         position = p;
-        ui_type = FUI_Type::DROPDOWN;
+        ui_type = FUI_Type::TIMELINE;
     }
 
-    FUI_Dropdown::FUI_Dropdown(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    FUI_Timeline::FUI_Timeline(const std::string& id, FUI_Window* pt, const std::string& g, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
-        text = t;
         size = s;
         parent = pt;
         position = p;
         group = g;
-        ui_type = FUI_Type::DROPDOWN;
+        ui_type = FUI_Type::TIMELINE;
     }
 
-    FUI_Dropdown::FUI_Dropdown(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    FUI_Timeline::FUI_Timeline(const std::string& id, const std::string& g, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
-        text = t;
         size = s;
         position = p;
         group = g;
-        ui_type = FUI_Type::DROPDOWN;
+        ui_type = FUI_Type::TIMELINE;
     }
 
-    void FUI_Dropdown::draw(olc::PixelGameEngine* pge)
+    void FUI_Timeline::add_span(int depth, double start, double end, const std::string& name, olc::Pixel color, uint64_t user_id)
     {
-        absolute_position = get_absolute_position();
-        auto title_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(text))* text_scale;
+        if (depth < 0)
+            return;
+        if (depth >= int(lanes.size()))
+            lanes.resize(depth + 1);
 
-        if (is_open)
+        auto& lane = lanes[depth];
+        // spans usually arrive in order, anything else gets sorted before the next draw
+        if (!lane.spans.empty() && start < lane.spans.back().start)
+            lane.sorted = false;
+
+        FUI_TimelineSpan span;
+        span.start = start;
+        span.end = std::max(start, end);
+        span.name = name;
+        span.color = color;
+        span.user_id = user_id;
+        lane.spans.push_back(std::move(span));
+        if (lane.sorted)
+            lane.max_end.push_back(lane.max_end.empty() ? lane.spans.back().end : std::max(lane.max_end.back(), lane.spans.back().end));
+        hovered_span = nullptr;
+        spans_added = true;
+    }
+
+    bool FUI_Timeline::update(olc::PixelGameEngine* pge)
+    {
+        FUI_Element::update(pge);
+        bool changed = spans_added;
+        spans_added = false;
+        return changed;
+    }
+
+    void FUI_Timeline::clear()
+    {
+        request_redraw();
+        lanes.clear();
+        hovered_span = nullptr;
+    }
+
+    void FUI_Timeline::prepare_lane(Lane& lane)
+    {
+        if (lane.sorted)
+            return;
+
+        std::stable_sort(lane.spans.begin(), lane.spans.end(), [](const FUI_TimelineSpan& a, const FUI_TimelineSpan& b) { return a.start < b.start; });
+        lane.max_end.resize(lane.spans.size());
+        double max_end = std::numeric_limits<double>::lowest();
+        for (size_t i = 0; i < lane.spans.size(); i++)
         {
-            float future_y = size.y * elements.size();
-            if (max_display_items > 0)
-                future_y = size.y * max_display_items;
-            active_size.y += animation_speed * pge->GetElapsedTime();
-            if (active_size.y >= future_y)
-                active_size.y = future_y;
+            max_end = std::max(max_end, lane.spans[i].end);
+            lane.max_end[i] = max_end;
         }
-        else
+        lane.sorted = true;
+    }
+
+    const size_t FUI_Timeline::first_overlap(Lane& lane, double time)
+    {
+        return size_t(std::upper_bound(lane.max_end.begin(), lane.max_end.end(), time) - lane.max_end.begin());
+    }
+
+    void FUI_Timeline::set_view(double start, double duration)
+    {
+        if (start != view_start || duration != view_duration)
+            request_redraw();
+        view_start = start;
+        view_duration = std::max(1e-12, duration);
+    }
+
+    void FUI_Timeline::fit_view()
+    {
+        double start = std::numeric_limits<double>::max();
+        double end = std::numeric_limits<double>::lowest();
+        for (auto& lane : lanes)
         {
-            active_size.y -= animation_speed * pge->GetElapsedTime();
-            if (active_size.y <= 0)
-                active_size.y = 0;
+            prepare_lane(lane);
+            if (lane.spans.empty())
+                continue;
+            start = std::min(start, lane.spans.front().start);
+            end = std::max(end, lane.max_end.back());
         }
+        if (start <= end)
+            set_view(start, end - start);
+        view_y = 0.f;
+    }
 
-        // title position
-        olc::vf2d text_position = olc::vf2d{ absolute_position.x - title_text_size.x,
-            absolute_position.y + (size.y / 2) - (title_text_size.y / 2) };
-        pge->DrawStringPropDecal(text_position, text, text_color, text_scale);
+    const double FUI_Timeline::get_view_start()
+    {
+        return view_start;
+    }
+
+    const double FUI_Timeline::get_view_duration()
+    {
+        return view_duration;
+    }
+
+    void FUI_Timeline::set_row_height(float height)
+    {
+        request_redraw();
+        row_height = std::max(1.f, height);
+    }
+
+    const FUI_TimelineSpan* FUI_Timeline::get_hovered_span()
+    {
+        return hovered_span;
+    }
+
+    const FUI_TimelineSpan* FUI_Timeline::find_span(olc::vf2d mouse)
+    {
+        int depth = int(std::floor((mouse.y - ruler_height + view_y) / row_height));
+        // the lane partly scrolled under the ruler isn't drawn, so it can't be hovered either
+        if (mouse.y < ruler_height || depth < std::ceil(view_y / row_height) || depth >= int(lanes.size()))
+            return nullptr;
+
+        auto& lane = lanes[depth];
+        prepare_lane(lane);
+        double time = view_start + mouse.x * (view_duration / size.x);
+        // a span has to be at least a pixel wide to be hovered, same as when it's drawn on its own
+        double min_duration = view_duration / size.x;
+        for (size_t i = first_overlap(lane, time); i < lane.spans.size() && lane.spans[i].start <= time; i++)
+            if (lane.spans[i].end >= time && lane.spans[i].end - lane.spans[i].start >= min_duration)
+                return &lane.spans[i];
+        return nullptr;
+    }
+
+    void FUI_Timeline::input(olc::PixelGameEngine*)
+    {
+        olc::vf2d mouse = static_cast<olc::vf2d>(frame->mouse_position) - absolute_position;
+        bool is_hovered = mouse.x >= 0.f && mouse.x <= size.x && mouse.y >= 0.f && mouse.y <= size.y;
 
-        switch (state)
+        hovered_span = is_hovered ? find_span(mouse) : nullptr;
+
+        // zoom around the time under the mouse
+        if (is_hovered && frame->mouse_wheel != 0)
         {
-        case DropdownState::NONE:
-            pge->FillRectDecal(absolute_position, size, color_scheme.dropdown_normal);
-            break;
-        case DropdownState::HOVER:
-            pge->FillRectDecal(absolute_position, size, color_scheme.dropdown_hover);
-            break;
-        case DropdownState::ACTIVE:
-            pge->FillRectDecal(absolute_position, size, color_scheme.dropdown_active);
-            break;
+            double anchor = view_start + mouse.x * (view_duration / size.x);
+            view_duration = std::max(1e-12, frame->mouse_wheel > 0 ? view_duration / 1.25 : view_duration * 1.25);
+            view_start = anchor - mouse.x * (view_duration / size.x);
+            request_redraw();
         }
-        if (active_size.y != size.y * elements.size())
-            pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y }, olc::vf2d{ size.x, active_size.y }, color_scheme.dropdown_normal);
 
-        if (!selected_element.second.second.empty())
+        if (is_hovered && frame->get_mouse(0).bPressed)
         {
-            auto element_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(selected_element.second.second))* selected_element.second.first;
-            text_position = olc::vf2d{ absolute_position.x + (size.x / 2) - (element_text_size.x / 2),
-                absolute_position.y + (size.y / 2) - (element_text_size.y / 2) };
-            pge->DrawStringPropDecal(text_position, selected_element.second.second, text_color, selected_element.second.first);
+            panning = true;
+            pan_mouse = mouse;
+            pan_start = view_start;
+            pan_y = view_y;
         }
-
-        if (max_display_items > 0 && max_display_items < elements.size())
+        if (panning)
         {
-            int i = 1;
-            for (int j = item_start_index - 1; j < item_start_index + max_display_items - 1; j++)
-            {
-                auto element_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(elements[j].second.second.second))* elements[j].second.second.first;
-                if (active_size.y >= size.y * i)
-                {
-                    switch (elements[j].second.first)
-                    {
-                    case DropdownState::NONE:
-                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.dropdown_normal);
-                        break;
-                    case DropdownState::HOVER:
-                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.dropdown_hover);
-                        break;
-                    case DropdownState::ACTIVE:
-                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.dropdown_active);
-                        break;
-                    }
-                }
-                text_position = olc::vf2d{ absolute_position.x + (size.x / 2) - (element_text_size.x / 2),
-                    absolute_position.y + size.y + (size.y * i) - (size.y / 2) - (element_text_size.y / 2) };
-                if (absolute_position.y + size.y + active_size.y > text_position.y + element_text_size.y)
-                    pge->DrawStringPropDecal(text_position, elements[j].second.second.second, text_color, elements[j].second.second.first);
+            view_start = pan_start - (mouse.x - pan_mouse.x) * (view_duration / size.x);
+            float max_y = std::max(0.f, lanes.size() * row_height - (size.y - ruler_height));
+            view_y = std::max(0.f, std::min(max_y, pan_y - (mouse.y - pan_mouse.y)));
+            request_redraw();
+            if (frame->get_mouse(0).bReleased || !frame->get_mouse(0).bHeld)
+                panning = false;
+        }
+    }
 
-                i++;
-            }
+    void FUI_Timeline::draw_ruler(olc::PixelGameEngine* pge)
+    {
+        pge->FillRectDecal(absolute_position, olc::vf2d{ size.x, ruler_height }, color_scheme.timeline_ruler);
 
-            if (is_open && (max_display_items < elements.size()))
+        // a tick at most every 100 pixels, on a 1 / 2 / 5 step
+        double target = view_duration * 100.0 / std::max(1.f, size.x);
+        double base = std::pow(10.0, std::floor(std::log10(target)));
+        double step = base * 10.0;
+        for (double multiple : { 1.0, 2.0, 5.0 })
+        {
+            if (base * multiple >= target)
             {
-                float scroll_size = (size.y + active_size.y) / (elements.size() - max_display_items);
-                float scroll_y_pos = ((item_start_index - 1) * scroll_size);
-                scroll_y_pos = scroll_y_pos - (scroll_y_pos / (elements.size() - max_display_items));
-
-                pge->FillRectDecal({ absolute_position.x + size.x - 3, absolute_position.y + scroll_y_pos },
-                    { 3, scroll_size }, color_scheme.scroll_indicator);
-
+                step = base * multiple;
+                break;
             }
         }
-        else
-        {
-            int i = 1;
-            for (auto& element : elements)
-            {
-                auto element_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(element.second.second.second))* element.second.second.first;
-                if (active_size.y >= size.y * i)
-                {
-                    switch (element.second.first)
-                    {
-                    case DropdownState::NONE:
-                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.dropdown_normal);
-                        break;
-                    case DropdownState::HOVER:
-                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.dropdown_hover);
-                        break;
-                    case DropdownState::ACTIVE:
-                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.dropdown_active);
-                        break;
-                    }
-                }
-                text_position = olc::vf2d{ absolute_position.x + (size.x / 2) - (element_text_size.x / 2),
-                    absolute_position.y + size.y + (size.y * i) - (size.y / 2) - (element_text_size.y / 2) };
-                if (absolute_position.y + size.y + active_size.y > text_position.y + element_text_size.y)
-                    pge->DrawStringPropDecal(text_position, element.second.second.second, text_color, element.second.second.first);
 
-                i++;
-            }
+        char buffer[32];
+        double scale = size.x / view_duration;
+        for (double tick = std::ceil(view_start / step) * step; tick <= view_start + view_duration; tick += step)
+        {
+            float x = absolute_position.x + float((tick - view_start) * scale);
+            pge->FillRectDecal(olc::vf2d{ x, absolute_position.y + ruler_height - 3.f }, olc::vf2d{ 1.f, 3.f }, color_scheme.timeline_ruler_text);
+            size_t length = fui_format_number(buffer, sizeof(buffer) - 1, std::abs(tick) < step * 1e-6 ? 0.0 : tick, -1);
+            buffer[length] = '\0';
+            if (x + 2.f + length * 8.f * text_scale.x <= absolute_position.x + size.x)
+                pge->DrawStringDecal(olc::vf2d{ x + 2.f, absolute_position.y + 2.f }, buffer, color_scheme.timeline_ruler_text, text_scale);
         }
     }
 
-    void FUI_Dropdown::input(olc::PixelGameEngine* pge)
+    void FUI_Timeline::draw(olc::PixelGameEngine* pge)
     {
-        bool could_close = false;
-        if (pge->GetMousePos().x >= absolute_position.x &&
-            pge->GetMousePos().x <= absolute_position.x + size.x &&
-            pge->GetMousePos().y >= absolute_position.y &&
-            pge->GetMousePos().y <= absolute_position.y + size.y)
-        {
-            if (pge->GetMouse(1).bPressed)
-                selected_element.second.second.clear();
+        absolute_position = get_absolute_position();
 
-            if (pge->GetMouse(0).bPressed)
-                state = DropdownState::ACTIVE;
-            else if (pge->GetMouse(0).bReleased && state == DropdownState::ACTIVE)
-            {
-                is_open = !is_open;
-                state = DropdownState::HOVER;
-            }
+        // outline
+        pge->FillRectDecal(absolute_position - olc::vf2d{ 1.f, 1.f }, size + olc::vf2d{ 2.f, 2.f }, color_scheme.timeline_outline);
+        // body
+        pge->FillRectDecal(absolute_position, size, color_scheme.timeline_background);
+        draw_ruler(pge);
 
-            if (state != DropdownState::ACTIVE)
-                state = DropdownState::HOVER;
-        }
-        else
+        double scale = size.x / view_duration;
+        double view_end = view_start + view_duration;
+        float text_height = 8.f * text_scale.y;
+
+        // lanes have to fit entirely, decals can't be clipped, so a lane partly scrolled under the ruler is skipped
+        int first_depth = std::max(0, int(std::ceil(view_y / row_height)));
+        for (int depth = first_depth; depth < int(lanes.size()); depth++)
         {
-            state = DropdownState::NONE;
-            int element_amount;
-            if (max_display_items > 0)
-                element_amount = max_display_items;
-            else
-                element_amount = elements.size();
-            if (!(pge->GetMousePos().x >= absolute_position.x &&
-                pge->GetMousePos().x <= absolute_position.x + size.x &&
-                pge->GetMousePos().y >= absolute_position.y &&
-                pge->GetMousePos().y <= absolute_position.y + size.y + (size.y * element_amount)))
-            {
-                if (pge->GetMouse(0).bPressed)
-                    could_close = true;
-            }
-        }
+            float y = absolute_position.y + ruler_height + depth * row_height - view_y;
+            if (y + row_height > absolute_position.y + size.y)
+                break;
 
+            auto& lane = lanes[depth];
+            prepare_lane(lane);
 
-        if (is_open)
-        {
-            if (max_display_items > 0 && max_display_items < elements.size()) // if we have a max display limit we want to run a slightly different method of checking input
+            // pending aggregate block, neighbouring merged pixels become one rect
+            float block_start = -1.f;
+            float block_end = -1.f;
+            auto flush_block = [&]()
             {
-                int i = 1;
-                for (int j = item_start_index - 1; j < item_start_index + max_display_items - 1; j++)
+                if (block_end > block_start)
+                    pge->FillRectDecal(olc::vf2d{ absolute_position.x + block_start, y }, olc::vf2d{ block_end - block_start, row_height - 1.f }, color_scheme.timeline_aggregate);
+                block_start = block_end = -1.f;
+            };
+
+            size_t i = first_overlap(lane, view_start);
+            while (i < lane.spans.size() && lane.spans[i].start < view_end)
+            {
+                auto& span = lane.spans[i];
+                float x0 = float(std::max(0.0, (span.start - view_start) * scale));
+                float x1 = float(std::min(double(size.x), (span.end - view_start) * scale));
+
+                if (x1 - x0 >= 1.f)
                 {
-                    if (pge->GetMousePos().x >= absolute_position.x &&
-                        pge->GetMousePos().x <= absolute_position.x + size.x &&
-                        pge->GetMousePos().y > absolute_position.y + (size.y * i) &&
-                        pge->GetMousePos().y < absolute_position.y + (size.y * i) + size.y)
+                    flush_block();
+                    olc::vf2d span_position = { absolute_position.x + x0, y };
+                    olc::vf2d span_size = { x1 - x0, row_height - 1.f };
+                    pge->FillRectDecal(span_position, span_size, span.color);
+                    if (&span == hovered_span)
                     {
-                        if (pge->GetMouse(0).bPressed)
-                            elements[j].second.first = DropdownState::ACTIVE;
-                        else if (pge->GetMouse(0).bReleased && elements[j].second.first == DropdownState::ACTIVE)
-                        {
-                            selected_element.first = elements[j].first;
-                            selected_element.second = elements[j].second.second;
-                            elements[j].second.first = DropdownState::HOVER;
-                            is_open = false;
-                        }
-                        else if (elements[j].second.first != DropdownState::ACTIVE)
-                            elements[j].second.first = DropdownState::HOVER;
+                        pge->FillRectDecal(span_position, olc::vf2d{ span_size.x, 1.f }, color_scheme.timeline_hover);
+                        pge->FillRectDecal(span_position + olc::vf2d{ 0.f, span_size.y - 1.f }, olc::vf2d{ span_size.x, 1.f }, color_scheme.timeline_hover);
                     }
-                    else
+
+                    // labels only where they fit, the width is measured once per span
+                    if (span_size.x > 8.f * text_scale.x && text_height <= row_height)
                     {
-                        elements[j].second.first = DropdownState::NONE;
-                        if (could_close && pge->GetMouse(0).bPressed)
-                            is_open = false;
+                        if (span.label_width < 0.f)
+                            span.label_width = pge->GetTextSizeProp(span.name).x * text_scale.x;
+                        if (span.label_width + 4.f <= span_size.x)
+                            pge->DrawStringPropDecal(span_position + olc::vf2d{ 2.f, (row_height - 1.f - text_height) / 2.f }, span.name, text_color, text_scale);
                     }
                     i++;
+                    continue;
                 }
-                if (pge->GetMousePos().x >= absolute_position.x &&
-                    pge->GetMousePos().x <= absolute_position.x + size.x &&
-                    pge->GetMousePos().y >= absolute_position.y &&
-                    pge->GetMousePos().y <= absolute_position.y + size.y + active_size.y)
-                {
-                    if (elements.size() > max_display_items)
-                    {
-                        if (pge->GetMouseWheel() > 0)
-                        {
-                            if (item_start_index > 1)
-                                item_start_index--;
-                        }
-                        else if (pge->GetMouseWheel() < 0)
-                        {
-                            if (item_start_index < (elements.size() - max_display_items + 1))
-                                item_start_index++;
-                        }
-                    }
-                }
-            }
-            else // if we don't have any max display limit
-            {
-                int i = 1;
-                for (auto& element : elements)
+
+                // merge everything that starts before the next pixel boundary into one block
+                float pixel = std::floor(x0);
+                double boundary = view_start + (pixel + 1.0) / scale;
+                size_t next = size_t(std::lower_bound(lane.spans.begin() + i + 1, lane.spans.end(), boundary,
+                    [](const FUI_TimelineSpan& s, double t) { return s.start < t; }) - lane.spans.begin());
+                // spans of one depth don't overlap, so only the last of them can reach past this pixel
+                if (next - 1 > i && (lane.spans[next - 1].end - lane.spans[next - 1].start) * scale >= 1.0)
+                    next--;
+                float end = std::min(size.x, pixel + 1.f);
+
+                if (block_end >= 0.f && pixel <= block_end)
+                    block_end = std::max(block_end, end);
+                else
                 {
-                    if (pge->GetMousePos().x >= absolute_position.x &&
-                        pge->GetMousePos().x <= absolute_position.x + size.x &&
-                        pge->GetMousePos().y > absolute_position.y + (size.y * i) &&
-                        pge->GetMousePos().y < absolute_position.y + (size.y * i) + size.y)
-                    {
-                        if (pge->GetMouse(0).bPressed)
-                            element.second.first = DropdownState::ACTIVE;
-                        else if (pge->GetMouse(0).bReleased && element.second.first == DropdownState::ACTIVE)
-                        {
-                            selected_element.first = element.first;
-                            selected_element.second = element.second.second;
-                            element.second.first = DropdownState::HOVER;
-                            is_open = false;
-                        }
-                        else if (element.second.first != DropdownState::ACTIVE)
-                            element.second.first = DropdownState::HOVER;
-                    }
-                    else
-                    {
-                        element.second.first = DropdownState::NONE;
-                        if (could_close && pge->GetMouse(0).bPressed)
-                            is_open = false;
-                    }
-                    i++;
+                    flush_block();
+                    block_start = pixel;
+                    block_end = end;
                 }
+                i = next;
             }
+            flush_block();
         }
 
-        if (is_open)
-            is_focused = true;
-        else
-            is_focused = false;
+        float content_height = lanes.size() * row_height;
+        float view_height = size.y - ruler_height;
+        if (content_height > view_height)
+        {
+            float scroll_size = std::max(8.f, view_height * (view_height / content_height));
+            float scroll_y_pos = (view_height - scroll_size) * (view_y / (content_height - view_height));
+            pge->FillRectDecal({ absolute_position.x + size.x - 3, absolute_position.y + ruler_height + scroll_y_pos }, { 3, scroll_size }, color_scheme.scroll_indicator);
+        }
     }
 
     /*
     ####################################################
-    #               FUI_COMBOLIST START                #
+    #               FUI_NODEGRAPH START                #
     ####################################################
     */
-    FUI_Combolist::FUI_Combolist(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s)
+    // clips a line to a rect (Liang-Barsky), returns false if nothing is left
+    inline bool fui_clip_line(olc::vf2d& a, olc::vf2d& b, olc::vf2d min, olc::vf2d max)
+    {
+        float t0 = 0.f;
+        float t1 = 1.f;
+        olc::vf2d d = b - a;
+        float p[4] = { -d.x, d.x, -d.y, d.y };
+        float q[4] = { a.x - min.x, max.x - a.x, a.y - min.y, max.y - a.y };
+        for (int i = 0; i < 4; i++)
+        {
+            if (p[i] == 0.f)
+            {
+                if (q[i] < 0.f)
+                    return false;
+                continue;
+            }
+            float t = q[i] / p[i];
+            if (p[i] < 0.f)
+                t0 = std::max(t0, t);
+            else
+                t1 = std::min(t1, t);
+            if (t0 > t1)
+                return false;
+        }
+        olc::vf2d start = a;
+        a = start + d * t0;
+        b = start + d * t1;
+        return true;
+    }
+
+    FUI_GraphNode::FUI_GraphNode(const std::string& id, const std::string& title, olc::vf2d p, olc::vf2d s, int inputs, int outputs)
+    {
+        identifier = id;
+        text = title;
+        position = p;
+        input_count = std::max(0, inputs);
+        output_count = std::max(0, outputs);
+        // tall enough for every pin
+        size = { s.x, std::max(s.y, title_height + std::max(input_count, output_count) * pin_spacing) };
+        ui_type = FUI_Type::GRAPHNODE;
+    }
+
+    FUI_GraphNode::~FUI_GraphNode()
+    {
+        for (auto& child : children)
+            child->set_container(nullptr);
+    }
+
+    void FUI_GraphNode::add_child(std::shared_ptr<FUI_Element> child)
+    {
+        child->set_container(this);
+        children.emplace_back(child);
+    }
+
+    void FUI_GraphNode::remove_child(FUI_Element* child)
+    {
+        for (size_t i = 0; i < children.size(); i++)
+        {
+            if (children[i].get() == child)
+            {
+                child->set_container(nullptr);
+                children.erase(children.begin() + i);
+                break;
+            }
+        }
+    }
+
+    const olc::vf2d FUI_GraphNode::get_content_position()
+    {
+        return get_absolute_position() + olc::vf2d{ 0.f, title_height };
+    }
+
+    const int FUI_GraphNode::get_input_count()
+    {
+        return input_count;
+    }
+
+    const int FUI_GraphNode::get_output_count()
+    {
+        return output_count;
+    }
+
+    const olc::vf2d FUI_GraphNode::get_input_position(int slot)
+    {
+        return position + olc::vf2d{ 0.f, title_height + (slot + 0.5f) * pin_spacing };
+    }
+
+    const olc::vf2d FUI_GraphNode::get_output_position(int slot)
+    {
+        return position + olc::vf2d{ size.x, title_height + (slot + 0.5f) * pin_spacing };
+    }
+
+    FUI_NodeGraph::FUI_NodeGraph(const std::string& id, FUI_Window* pt, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
-        text = t;
         size = s;
         parent = pt;
         position = p;
-        ui_type = FUI_Type::COMBOLIST;
+        ui_type = FUI_Type::NODEGRAPH;
     }
 
-    FUI_Combolist::FUI_Combolist(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s)
+    FUI_NodeGraph::FUI_NodeGraph(const std::string& id, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
-        text = t;
         size = s;
         position = p;
-        ui_type = FUI_Type::COMBOLIST;
+        ui_type = FUI_Type::NODEGRAPH;
     }
 
-    FUI_Combolist::FUI_Combolist(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    FUI_NodeGraph::FUI_NodeGraph(const std::string& id, FUI_Window* pt, const std::string& g, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
-        text = t;
         size = s;
         parent = pt;
         position = p;
         group = g;
-        ui_type = FUI_Type::COMBOLIST;
+        ui_type = FUI_Type::NODEGRAPH;
     }
 
-    FUI_Combolist::FUI_Combolist(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    FUI_NodeGraph::FUI_NodeGraph(const std::string& id, const std::string& g, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
-        text = t;
         size = s;
         position = p;
         group = g;
-        ui_type = FUI_Type::COMBOLIST;
+        ui_type = FUI_Type::NODEGRAPH;
+    }
+
+    uint64_t FUI_NodeGraph::cell_key(int x, int y)
+    {
+        return (uint64_t(uint32_t(x)) << 32) | uint64_t(uint32_t(y));
+    }
+
+    const olc::vi2d FUI_NodeGraph::to_cell(olc::vf2d point)
+    {
+        return { int(std::floor(point.x / cell_size)), int(std::floor(point.y / cell_size)) };
+    }
+
+    void FUI_NodeGraph::grid_insert(FUI_GraphNode* node)
+    {
+        // pins stick out of the node a little
+        node->cell_min = to_cell(node->position - olc::vf2d{ pin_radius, pin_radius });
+        node->cell_max = to_cell(node->position + node->size + olc::vf2d{ pin_radius, pin_radius });
+        for (int y = node->cell_min.y; y <= node->cell_max.y; y++)
+            for (int x = node->cell_min.x; x <= node->cell_max.x; x++)
+                grid[cell_key(x, y)].nodes.push_back(node);
+    }
+
+    void FUI_NodeGraph::grid_remove(FUI_GraphNode* node)
+    {
+        for (int y = node->cell_min.y; y <= node->cell_max.y; y++)
+        {
+            for (int x = node->cell_min.x; x <= node->cell_max.x; x++)
+            {
+                auto cell = grid.find(cell_key(x, y));
+                if (cell == grid.end())
+                    continue;
+                auto& cell_nodes = cell->second.nodes;
+                auto it = std::find(cell_nodes.begin(), cell_nodes.end(), node);
+                if (it != cell_nodes.end())
+                {
+                    *it = cell_nodes.back();
+                    cell_nodes.pop_back();
+                }
+                if (cell_nodes.empty() && cell->second.links.empty())
+                    grid.erase(cell);
+            }
+        }
+        node->cell_max = node->cell_min - olc::vi2d{ 1, 1 };
+    }
+
+    void FUI_NodeGraph::grid_insert(Link* link)
+    {
+        link->cell_min = to_cell(link->bounds_min);
+        link->cell_max = to_cell(link->bounds_max);
+        link->large = (link->cell_max.x - link->cell_min.x + 1) * (link->cell_max.y - link->cell_min.y + 1) > max_link_cells;
+        if (link->large)
+        {
+            large_links.push_back(link);
+            return;
+        }
+        for (int y = link->cell_min.y; y <= link->cell_max.y; y++)
+            for (int x = link->cell_min.x; x <= link->cell_max.x; x++)
+                grid[cell_key(x, y)].links.push_back(link);
     }
 
-    void FUI_Combolist::draw(olc::PixelGameEngine* pge)
+    void FUI_NodeGraph::grid_remove(Link* link)
     {
-        absolute_position = get_absolute_position();
-        auto title_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(text))* text_scale;
-
-        if (is_open)
+        if (link->large)
         {
-            float future_y = size.y * elements.size();
-            if (max_display_items > 0)
-                future_y = size.y * max_display_items;
-            active_size.y += animation_speed * pge->GetElapsedTime();
-            if (active_size.y >= future_y)
-                active_size.y = future_y;
+            auto it = std::find(large_links.begin(), large_links.end(), link);
+            if (it != large_links.end())
+            {
+                *it = large_links.back();
+                large_links.pop_back();
+            }
+            link->large = false;
+            return;
         }
-        else
+        for (int y = link->cell_min.y; y <= link->cell_max.y; y++)
         {
-            active_size.y -= animation_speed * pge->GetElapsedTime();
-            if (active_size.y <= 0)
-                active_size.y = 0;
+            for (int x = link->cell_min.x; x <= link->cell_max.x; x++)
+            {
+                auto cell = grid.find(cell_key(x, y));
+                if (cell == grid.end())
+                    continue;
+                auto& cell_links = cell->second.links;
+                auto it = std::find(cell_links.begin(), cell_links.end(), link);
+                if (it != cell_links.end())
+                {
+                    *it = cell_links.back();
+                    cell_links.pop_back();
+                }
+                if (cell_links.empty() && cell->second.nodes.empty())
+                    grid.erase(cell);
+            }
         }
+        link->cell_max = link->cell_min - olc::vi2d{ 1, 1 };
+    }
 
-        // title position
-        olc::vf2d text_position = olc::vf2d{ absolute_position.x - title_text_size.x,
-            absolute_position.y + (size.y / 2) - (title_text_size.y / 2) };
-        pge->DrawStringPropDecal(text_position, text, text_color, text_scale);
+    void FUI_NodeGraph::tessellate(Link* link)
+    {
+        auto from = link->link.from;
+        auto to = link->link.to;
+        if (link->from_version == from->version && link->to_version == to->version)
+            return;
 
-        switch (state)
+        olc::vf2d a = from->get_output_position(link->link.from_slot);
+        olc::vf2d b = to->get_input_position(link->link.to_slot);
+        float handle = std::max(40.f, std::abs(b.x - a.x) * 0.5f);
+        olc::vf2d c1 = a + olc::vf2d{ handle, 0.f };
+        olc::vf2d c2 = b - olc::vf2d{ handle, 0.f };
+
+        // segment count follows the length of the control polygon
+        float length = (c1 - a).mag() + (c2 - c1).mag() + (b - c2).mag();
+        int segments = std::max(8, std::min(48, int(length / 12.f)));
+        link->points.resize(segments + 1);
+        link->bounds_min = a;
+        link->bounds_max = a;
+        for (int i = 0; i <= segments; i++)
         {
-        case DropdownState::NONE:
-            pge->FillRectDecal(absolute_position, size, color_scheme.dropdown_normal);
-            break;
-        case DropdownState::HOVER:
-            pge->FillRectDecal(absolute_position, size, color_scheme.dropdown_hover);
-            break;
+            float t = float(i) / segments;
+            float u = 1.f - t;
+            olc::vf2d point = a * (u * u * u) + c1 * (3.f * u * u * t) + c2 * (3.f * u * t * t) + b * (t * t * t);
+            link->points[i] = point;
+            link->bounds_min = { std::min(link->bounds_min.x, point.x), std::min(link->bounds_min.y, point.y) };
+            link->bounds_max = { std::max(link->bounds_max.x, point.x), std::max(link->bounds_max.y, point.y) };
         }
-        if (active_size.y != size.y * elements.size())
-            pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y }, olc::vf2d{ size.x, active_size.y }, color_scheme.dropdown_normal);
 
-        if (selected_elements.size() > 1)
-        {
-            std::string temp_text = selected_elements[0].second.second + ", ...";
-            auto element_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(temp_text))* selected_elements[0].second.first;
+        link->from_version = from->version;
+        link->to_version = to->version;
+        grid_remove(link);
+        grid_insert(link);
+    }
 
-            text_position = olc::vf2d{ absolute_position.x + (size.x / 2) - (element_text_size.x / 2),
-                absolute_position.y + (size.y / 2) - (element_text_size.y / 2) };
-            pge->DrawStringPropDecal(text_position, temp_text, text_color, selected_elements[0].second.first);
-        }
-        else if (selected_elements.size() > 0)
+    FUI_GraphNode* FUI_NodeGraph::add_node(const std::string& id, const std::string& title, olc::vf2d p, olc::vf2d s, int inputs, int outputs)
+    {
+        request_redraw();
+        if (node_lookup.count(id))
         {
-            auto element_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(selected_elements[0].second.second))* selected_elements[0].second.first;
-
-            text_position = olc::vf2d{ absolute_position.x + (size.x / 2) - (element_text_size.x / 2),
-                absolute_position.y + (size.y / 2) - (element_text_size.y / 2) };
-            pge->DrawStringPropDecal(text_position, selected_elements[0].second.second, text_color, selected_elements[0].second.first);
+            std::cout << "Duplicate IDs found (function affected: add_node, node_id affected: " + id + ")\n";
+            return nullptr;
         }
 
-        if (max_display_items > 0 && max_display_items < elements.size())
+        nodes.emplace_back(std::make_unique<FUI_GraphNode>(id, title, p, s, inputs, outputs));
+        auto node = nodes.back().get();
+        node->set_container(this);
+        node->z_order = ++z_counter;
+        node_lookup[id] = node;
+        grid_insert(node);
+        return node;
+    }
+
+    void FUI_NodeGraph::remove_link(Link* link)
+    {
+        grid_remove(link);
+        for (auto node : { link->link.from, link->link.to })
         {
-            int i = 1;
-            for (int j = item_start_index - 1; j < item_start_index + max_display_items - 1; j++)
+            auto& attached = node_links[node];
+            attached.erase(std::remove(attached.begin(), attached.end(), link), attached.end());
+        }
+        dirty_links.erase(std::remove(dirty_links.begin(), dirty_links.end(), link), dirty_links.end());
+        visible_links.erase(std::remove(visible_links.begin(), visible_links.end(), link), visible_links.end());
+        for (size_t i = 0; i < links.size(); i++)
+        {
+            if (links[i].get() == link)
             {
-                auto element_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(elements[j].second.second.second))* elements[j].second.second.first;
-                if (active_size.y >= size.y * i)
-                {
-                    switch (elements[j].second.first)
-                    {
-                    case DropdownState::NONE:
-                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.combolist_normal);
-                        break;
-                    case DropdownState::HOVER:
-                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.combolist_hover);
-                        break;
-                    case DropdownState::ACTIVE:
-                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.combolist_active);
-                        break;
-                    }
-                }
-                text_position = olc::vf2d{ absolute_position.x + (size.x / 2) - (element_text_size.x / 2),
-                    absolute_position.y + size.y + (size.y * i) - (size.y / 2) - (element_text_size.y / 2) };
-                if (absolute_position.y + size.y + active_size.y > text_position.y + element_text_size.y)
-                    pge->DrawStringPropDecal(text_position, elements[j].second.second.second, text_color, elements[j].second.second.first);
-                i++;
+                links[i] = std::move(links.back());
+                links.pop_back();
+                break;
             }
+        }
+    }
 
-            if (is_open && (max_display_items < elements.size()))
-            {
-                float scroll_size = (size.y + active_size.y) / (elements.size() - max_display_items);
-                float scroll_y_pos = ((item_start_index - 1) * scroll_size);
-                scroll_y_pos = scroll_y_pos - (scroll_y_pos / (elements.size() - max_display_items));
+    void FUI_NodeGraph::remove_node(const std::string& id)
+    {
+        request_redraw();
+        auto node = get_node(id);
+        if (!node)
+            return;
 
-                pge->FillRectDecal({ absolute_position.x + size.x - 3, absolute_position.y + scroll_y_pos },
-                    { 3, scroll_size }, color_scheme.scroll_indicator);
-            }
+        auto attached = node_links[node];
+        for (auto link : attached)
+            remove_link(link);
+        node_links.erase(node);
+        grid_remove(node);
+        node_lookup.erase(id);
+        visible_nodes.erase(std::remove(visible_nodes.begin(), visible_nodes.end(), node), visible_nodes.end());
+        if (drag_node == node)
+        {
+            drag_node = nullptr;
+            drag = Drag::NONE;
         }
-        else
+        for (size_t i = 0; i < nodes.size(); i++)
         {
-            int i = 1;
-            for (auto& element : elements)
+            if (nodes[i].get() == node)
             {
-                auto element_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(element.second.second.second))* element.second.second.first;
-                if (active_size.y >= size.y * i)
-                {
-                    switch (element.second.first)
-                    {
-                    case DropdownState::NONE:
-                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.combolist_normal);
-                        break;
-                    case DropdownState::HOVER:
-                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.combolist_hover);
-                        break;
-                    case DropdownState::ACTIVE:
-                        pge->FillRectDecal(absolute_position + olc::vf2d{ 0.f, size.y * i }, size, color_scheme.combolist_active);
-                        break;
-                    }
-                }
-                text_position = olc::vf2d{ absolute_position.x + (size.x / 2) - (element_text_size.x / 2),
-                    absolute_position.y + size.y + (size.y * i) - (size.y / 2) - (element_text_size.y / 2) };
-                if (absolute_position.y + size.y + active_size.y > text_position.y + element_text_size.y)
-                    pge->DrawStringPropDecal(text_position, element.second.second.second, text_color, element.second.second.first);
-                i++;
+                nodes[i] = std::move(nodes.back());
+                nodes.pop_back();
+                break;
             }
         }
     }
 
-    void FUI_Combolist::input(olc::PixelGameEngine* pge)
+    FUI_GraphNode* FUI_NodeGraph::get_node(const std::string& id)
     {
-        if (pge->GetMousePos().x >= absolute_position.x &&
-            pge->GetMousePos().x <= absolute_position.x + size.x &&
-            pge->GetMousePos().y >= absolute_position.y &&
-            pge->GetMousePos().y <= absolute_position.y + size.y)
-        {
-            if (pge->GetMouse(1).bPressed)
-            {
-                selected_elements.clear();
-                for (auto& element : elements)
-                    element.second.first = DropdownState::NONE;
-            }
+        auto it = node_lookup.find(id);
+        return it != node_lookup.end() ? it->second : nullptr;
+    }
 
-            if (pge->GetMouse(0).bPressed)
-            {
-                if (is_open)
-                    is_open = false;
-                else
-                    is_open = true;
-            }
-            else
-                state = DropdownState::HOVER;
+    void FUI_NodeGraph::move_node(const std::string& id, olc::vf2d p)
+    {
+        auto node = get_node(id);
+        if (!node || node->position == p)
+            return;
+        request_redraw();
+
+        grid_remove(node);
+        node->position = p;
+        node->version++;
+        grid_insert(node);
+        // links are re-tessellated once per frame no matter how often the node moved
+        for (auto link : node_links[node])
+            dirty_links.push_back(link);
+    }
+
+    bool FUI_NodeGraph::connect(const std::string& from_id, int from_slot, const std::string& to_id, int to_slot)
+    {
+        request_redraw();
+        auto from = get_node(from_id);
+        auto to = get_node(to_id);
+        if (!from || !to || from == to || from_slot < 0 || from_slot >= from->output_count || to_slot < 0 || to_slot >= to->input_count)
+        {
+            std::cout << "Could not connect nodes (function affected: connect, nodegraph_id affected: " + identifier + ")\n";
+            return false;
         }
-        else
-            state = DropdownState::NONE;
 
+        disconnect(to_id, to_slot);
+        links.emplace_back(std::make_unique<Link>());
+        auto link = links.back().get();
+        link->link = { from, from_slot, to, to_slot };
+        node_links[from].push_back(link);
+        node_links[to].push_back(link);
+        tessellate(link);
+        return true;
+    }
 
-        if (is_open)
+    void FUI_NodeGraph::disconnect(const std::string& to_id, int to_slot)
+    {
+        request_redraw();
+        auto to = get_node(to_id);
+        if (!to)
+            return;
+
+        auto attached = node_links[to];
+        for (auto link : attached)
+            if (link->link.to == to && link->link.to_slot == to_slot)
+                remove_link(link);
+    }
+
+    const std::vector<FUI_GraphLink> FUI_NodeGraph::get_links()
+    {
+        std::vector<FUI_GraphLink> result;
+        result.reserve(links.size());
+        for (auto& link : links)
+            result.push_back(link->link);
+        return result;
+    }
+
+    void FUI_NodeGraph::set_pan(olc::vf2d offset)
+    {
+        if (offset != pan)
+            request_redraw();
+        pan = offset;
+    }
+
+    const olc::vf2d FUI_NodeGraph::get_pan()
+    {
+        return pan;
+    }
+
+    const olc::vf2d FUI_NodeGraph::get_content_position()
+    {
+        return get_absolute_position() - pan;
+    }
+
+    void FUI_NodeGraph::update_visible()
+    {
+        for (auto link : dirty_links)
+            tessellate(link);
+        dirty_links.clear();
+
+        visible_nodes.clear();
+        visible_links.clear();
+        uint64_t stamp = ++visit_counter;
+        olc::vf2d view_min = pan;
+        olc::vf2d view_max = pan + size;
+        olc::vi2d first = to_cell(view_min);
+        olc::vi2d last = to_cell(view_max);
+        for (int y = first.y; y <= last.y; y++)
         {
-            if (max_display_items > 0 && max_display_items < elements.size()) // if we have a max display limit we want to run a slightly different method of checking input
+            for (int x = first.x; x <= last.x; x++)
             {
-                int i = 1;
-                for (int j = item_start_index - 1; j < item_start_index + max_display_items - 1; j++)
+                auto cell = grid.find(cell_key(x, y));
+                if (cell == grid.end())
+                    continue;
+                for (auto node : cell->second.nodes)
                 {
-                    if (pge->GetMousePos().x >= absolute_position.x &&
-                        pge->GetMousePos().x <= absolute_position.x + size.x &&
-                        pge->GetMousePos().y > absolute_position.y + (size.y * i) &&
-                        pge->GetMousePos().y < absolute_position.y + (size.y * i) + size.y)
-                    {
-                        if (pge->GetMouse(0).bPressed)
-                        {
-                            bool did_find_element = false;
-                            for (auto& sel_element : selected_elements)
-                            {
-                                if (sel_element.first == elements[j].first)
-                                {
-                                    did_find_element = true;
-                                    int v = 0;
-                                    for (auto& el : selected_elements)
-                                    {
-                                        if (el.first == elements[j].first)
-                                        {
-                                            elements[j].second.first = DropdownState::NONE;
-                                            selected_elements.erase(selected_elements.begin() + v);
-                                            break;
-                                        }
-                                        v++;
-                                    }
-                                    break;
-                                }
-                            }
-                            if (!did_find_element)
-                            {
-                                elements[j].second.first = DropdownState::ACTIVE;
-                                selected_elements.emplace_back(std::make_pair(elements[j].first, elements[j].second.second));
-                            }
-                        }
-                        else if (elements[j].second.first != DropdownState::ACTIVE)
-                            elements[j].second.first = DropdownState::HOVER;
-                    }
-                    else if (elements[j].second.first != DropdownState::ACTIVE)
-                        elements[j].second.first = DropdownState::NONE;
-                    i++;
+                    if (node->visit_stamp == stamp)
+                        continue;
+                    node->visit_stamp = stamp;
+                    if (node->position.x - pin_radius < view_max.x && node->position.x + node->size.x + pin_radius > view_min.x &&
+                        node->position.y < view_max.y && node->position.y + node->size.y > view_min.y)
+                        visible_nodes.push_back(node);
                 }
-                if (pge->GetMousePos().x >= absolute_position.x &&
-                    pge->GetMousePos().x <= absolute_position.x + size.x &&
-                    pge->GetMousePos().y >= absolute_position.y &&
-                    pge->GetMousePos().y <= absolute_position.y + size.y + active_size.y)
+                for (auto link : cell->second.links)
                 {
-                    if (elements.size() > max_display_items)
-                    {
-                        if (pge->GetMouseWheel() > 0)
-                        {
-                            if (item_start_index > 1)
-                                item_start_index--;
-                        }
-                        else if (pge->GetMouseWheel() < 0)
-                        {
-                            if (item_start_index < (elements.size() - max_display_items + 1))
-                                item_start_index++;
-                        }
-                    }
+                    if (link->visit_stamp == stamp)
+                        continue;
+                    link->visit_stamp = stamp;
+                    if (link->bounds_min.x < view_max.x && link->bounds_max.x > view_min.x && link->bounds_min.y < view_max.y && link->bounds_max.y > view_min.y)
+                        visible_links.push_back(link);
                 }
             }
-            else // if we don't have any max display limit
-            {
-                int i = 1;
-                for (auto& element : elements)
-                {
-                    if (pge->GetMousePos().x >= absolute_position.x &&
-                        pge->GetMousePos().x <= absolute_position.x + size.x &&
-                        pge->GetMousePos().y > absolute_position.y + (size.y * i) &&
-                        pge->GetMousePos().y < absolute_position.y + (size.y * i) + size.y)
-                    {
-                        if (pge->GetMouse(0).bPressed)
-                        {
-                            bool did_find_element = false;
-                            for (auto& sel_element : selected_elements)
-                            {
-                                if (sel_element.first == element.first)
-                                {
-                                    did_find_element = true;
-                                    int j = 0;
-                                    for (auto& el : selected_elements)
-                                    {
-                                        if (el.first == element.first)
-                                        {
-                                            element.second.first = DropdownState::NONE;
-                                            selected_elements.erase(selected_elements.begin() + j);
-                                            break;
-                                        }
-                                        j++;
-                                    }
-                                    break;
-                                }
-                            }
-                            if (!did_find_element)
-                            {
-                                element.second.first = DropdownState::ACTIVE;
-                                selected_elements.emplace_back(std::make_pair(element.first, element.second.second));
-                            }
-                        }
-                        else if (element.second.first != DropdownState::ACTIVE)
-                            element.second.first = DropdownState::HOVER;
+        }
+        for (auto link : large_links)
+            if (link->bounds_min.x < view_max.x && link->bounds_max.x > view_min.x && link->bounds_min.y < view_max.y && link->bounds_max.y > view_min.y)
+                visible_links.push_back(link);
+
+        std::sort(visible_nodes.begin(), visible_nodes.end(), [](FUI_GraphNode* a, FUI_GraphNode* b) { return a->z_order < b->z_order; });
+    }
+
+    FUI_GraphNode* FUI_NodeGraph::node_at(olc::vf2d point)
+    {
+        auto cell = grid.find(cell_key(to_cell(point).x, to_cell(point).y));
+        if (cell == grid.end())
+            return nullptr;
+
+        FUI_GraphNode* top = nullptr;
+        for (auto node : cell->second.nodes)
+        {
+            if (point.x >= node->position.x && point.x <= node->position.x + node->size.x &&
+                point.y >= node->position.y && point.y <= node->position.y + node->size.y &&
+                (!top || node->z_order > top->z_order))
+                top = node;
+        }
+        return top;
+    }
+
+    FUI_GraphNode* FUI_NodeGraph::pin_at(olc::vf2d point, bool outputs, int& slot)
+    {
+        auto cell = grid.find(cell_key(to_cell(point).x, to_cell(point).y));
+        if (cell == grid.end())
+            return nullptr;
+
+        FUI_GraphNode* top = nullptr;
+        for (auto node : cell->second.nodes)
+        {
+            int count = outputs ? node->output_count : node->input_count;
+            for (int i = 0; i < count; i++)
+            {
+                olc::vf2d pin = outputs ? node->get_output_position(i) : node->get_input_position(i);
+                if ((pin - point).mag2() <= (pin_radius + 1.f) * (pin_radius + 1.f) && (!top || node->z_order > top->z_order))
+                {
+                    top = node;
+                    slot = i;
+                }
+            }
+        }
+        return top;
+    }
+
+    void FUI_NodeGraph::input(olc::PixelGameEngine* pge)
+    {
+        olc::vf2d mouse = static_cast<olc::vf2d>(frame->mouse_position);
+        olc::vf2d graph_mouse = mouse - absolute_position + pan;
+        bool is_hovered = mouse.x >= absolute_position.x && mouse.x <= absolute_position.x + size.x &&
+            mouse.y >= absolute_position.y && mouse.y <= absolute_position.y + size.y;
+
+        // children only get input while their whole node is on screen, same as when they're drawn
+        bool child_focused = false;
+        for (auto node : visible_nodes)
+        {
+            if (node->position.x < pan.x || node->position.y < pan.y ||
+                node->position.x + node->size.x > pan.x + size.x || node->position.y + node->size.y > pan.y + size.y)
+                continue;
+            for (auto& child : node->children)
+            {
+                child->input(pge);
+                if (child->get_focused_status())
+                    child_focused = true;
+            }
+        }
+
+        if (drag == Drag::NONE && is_hovered && !child_focused && frame->get_mouse(0).bPressed)
+        {
+            int slot = 0;
+            if (auto node = pin_at(graph_mouse, true, slot))
+            {
+                drag = Drag::LINK;
+                drag_node = node;
+                drag_slot = slot;
+            }
+            else if (auto node = pin_at(graph_mouse, false, slot))
+            {
+                // grabbing a connected input picks the link up from its source
+                for (auto link : node_links[node])
+                {
+                    if (link->link.to == node && link->link.to_slot == slot)
+                    {
+                        drag = Drag::LINK;
+                        drag_node = link->link.from;
+                        drag_slot = link->link.from_slot;
+                        remove_link(link);
+                        break;
                     }
-                    else if (element.second.first != DropdownState::ACTIVE)
-                        element.second.first = DropdownState::NONE;
-                    i++;
                 }
             }
+            else if (auto node = node_at(graph_mouse))
+            {
+                node->z_order = ++z_counter;
+                std::sort(visible_nodes.begin(), visible_nodes.end(), [](FUI_GraphNode* a, FUI_GraphNode* b) { return a->z_order < b->z_order; });
+                if (graph_mouse.y <= node->position.y + node->title_height)
+                {
+                    drag = Drag::NODE;
+                    drag_node = node;
+                    drag_origin = graph_mouse - node->position;
+                }
+            }
+            else
+            {
+                drag = Drag::PAN;
+                drag_mouse = mouse;
+                drag_origin = pan;
+            }
         }
 
-        if (!(pge->GetMousePos().x >= absolute_position.x &&
-            pge->GetMousePos().x <= absolute_position.x + size.x &&
-            pge->GetMousePos().y >= absolute_position.y &&
-            pge->GetMousePos().y <= absolute_position.y + size.y + active_size.y) && pge->GetMouse(0).bPressed)
-            is_open = false;
+        switch (drag)
+        {
+        case Drag::PAN:
+            pan = drag_origin - (mouse - drag_mouse);
+            request_redraw();
+            break;
+        case Drag::NODE:
+            if (drag_node)
+                move_node(drag_node->get_identifier(), graph_mouse - drag_origin);
+            break;
+        case Drag::LINK:
+            if (drag_node && frame->get_mouse(0).bReleased)
+            {
+                int slot = 0;
+                if (auto node = pin_at(graph_mouse, false, slot))
+                    connect(drag_node->get_identifier(), drag_slot, node->get_identifier(), slot);
+            }
+            break;
+        default:
+            break;
+        }
 
-        if (is_open)
-            is_focused = true;
-        else
-            is_focused = false;
+        if (drag != Drag::NONE && (frame->get_mouse(0).bReleased || !frame->get_mouse(0).bHeld))
+        {
+            drag = Drag::NONE;
+            drag_node = nullptr;
+        }
+        is_focused = drag != Drag::NONE || child_focused;
+    }
+
+    void FUI_NodeGraph::draw_node(olc::PixelGameEngine* pge, FUI_GraphNode* node, olc::vf2d view_min, olc::vf2d view_max)
+    {
+        // decals can't be clipped, so rects are cut down to the view and text / children need to fit
+        auto fill_clipped = [&](olc::vf2d p, olc::vf2d s, olc::Pixel color)
+        {
+            olc::vf2d a = { std::max(p.x, view_min.x), std::max(p.y, view_min.y) };
+            olc::vf2d b = { std::min(p.x + s.x, view_max.x), std::min(p.y + s.y, view_max.y) };
+            if (a.x < b.x && a.y < b.y)
+                pge->FillRectDecal(a, b - a, color);
+        };
+
+        olc::vf2d node_position = node->get_absolute_position();
+        fill_clipped(node_position - olc::vf2d{ 1.f, 1.f }, node->size + olc::vf2d{ 2.f, 2.f }, color_scheme.nodegraph_node_outline);
+        fill_clipped(node_position, node->size, color_scheme.nodegraph_node);
+        fill_clipped(node_position, olc::vf2d{ node->size.x, node->title_height }, color_scheme.nodegraph_node_title);
+
+        auto title_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(node->text)) * node->text_scale;
+        olc::vf2d title_position = node_position + olc::vf2d{ 3.f, (node->title_height - title_size.y) / 2.f };
+        if (title_position.x >= view_min.x && title_position.y >= view_min.y &&
+            title_position.x + title_size.x <= view_max.x && title_position.y + title_size.y <= view_max.y && title_size.x + 6.f <= node->size.x)
+            pge->DrawStringPropDecal(title_position, node->text, color_scheme.nodegraph_node_text, node->text_scale);
+
+        olc::vf2d origin = absolute_position - pan;
+        for (int i = 0; i < node->input_count; i++)
+            fill_clipped(origin + node->get_input_position(i) - olc::vf2d{ pin_radius, pin_radius }, olc::vf2d{ pin_radius * 2.f, pin_radius * 2.f }, color_scheme.nodegraph_pin);
+        for (int i = 0; i < node->output_count; i++)
+            fill_clipped(origin + node->get_output_position(i) - olc::vf2d{ pin_radius, pin_radius }, olc::vf2d{ pin_radius * 2.f, pin_radius * 2.f }, color_scheme.nodegraph_pin);
+
+        if (node_position.x >= view_min.x && node_position.y >= view_min.y &&
+            node_position.x + node->size.x <= view_max.x && node_position.y + node->size.y <= view_max.y)
+        {
+            for (auto& child : node->children)
+                child->draw(pge);
+        }
+    }
+
+    void FUI_NodeGraph::draw(olc::PixelGameEngine* pge)
+    {
+        absolute_position = get_absolute_position();
+        update_visible();
+
+        // outline
+        pge->FillRectDecal(absolute_position - olc::vf2d{ 1.f, 1.f }, size + olc::vf2d{ 2.f, 2.f }, color_scheme.nodegraph_outline);
+        // body
+        pge->FillRectDecal(absolute_position, size, color_scheme.nodegraph_background);
+
+        // background grid follows the pan
+        const float spacing = 32.f;
+        for (float x = spacing - std::fmod(pan.x, spacing) - (pan.x < 0.f ? spacing : 0.f); x < size.x; x += spacing)
+            if (x >= 0.f)
+                pge->FillRectDecal(olc::vf2d{ absolute_position.x + x, absolute_position.y }, olc::vf2d{ 1.f, size.y }, color_scheme.nodegraph_grid);
+        for (float y = spacing - std::fmod(pan.y, spacing) - (pan.y < 0.f ? spacing : 0.f); y < size.y; y += spacing)
+            if (y >= 0.f)
+                pge->FillRectDecal(olc::vf2d{ absolute_position.x, absolute_position.y + y }, olc::vf2d{ size.x, 1.f }, color_scheme.nodegraph_grid);
+
+        olc::vf2d view_min = absolute_position;
+        olc::vf2d view_max = absolute_position + size;
+        olc::vf2d origin = absolute_position - pan;
+        for (auto link : visible_links)
+        {
+            for (size_t i = 0; i + 1 < link->points.size(); i++)
+            {
+                olc::vf2d a = origin + link->points[i];
+                olc::vf2d b = origin + link->points[i + 1];
+                if (fui_clip_line(a, b, view_min, view_max))
+                    pge->DrawLineDecal(a, b, color_scheme.nodegraph_link);
+            }
+        }
+
+        if (drag == Drag::LINK && drag_node)
+        {
+            olc::vf2d a = origin + drag_node->get_output_position(drag_slot);
+            olc::vf2d b = static_cast<olc::vf2d>(frame->mouse_position);
+            if (fui_clip_line(a, b, view_min, view_max))
+                pge->DrawLineDecal(a, b, color_scheme.nodegraph_link);
+        }
+
+        for (auto node : visible_nodes)
+            draw_node(pge, node, view_min, view_max);
     }
 
     /*
     ####################################################
-    #               FUI_GROUPBOX START                 #
+    #               FUI_PROGRESSBAR START              #
     ####################################################
     */
-    FUI_Groupbox::FUI_Groupbox(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s)
+    FUI_ProgressBar::FUI_ProgressBar(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
         text = t;
         size = s;
         parent = pt;
         position = p;
-        ui_type = FUI_Type::GROUPBOX;
+        ui_type = FUI_Type::PROGRESSBAR;
     }
 
-    FUI_Groupbox::FUI_Groupbox(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s)
+    FUI_ProgressBar::FUI_ProgressBar(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
         text = t;
         size = s;
         position = p;
-        ui_type = FUI_Type::GROUPBOX;
+        ui_type = FUI_Type::PROGRESSBAR;
     }
 
-    FUI_Groupbox::FUI_Groupbox(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    FUI_ProgressBar::FUI_ProgressBar(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
         text = t;
@@ -2311,72 +10142,127 @@ namespace olc
         parent = pt;
         position = p;
         group = g;
-        ui_type = FUI_Type::GROUPBOX;
+        ui_type = FUI_Type::PROGRESSBAR;
     }
 
-    FUI_Groupbox::FUI_Groupbox(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    FUI_ProgressBar::FUI_ProgressBar(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
         text = t;
         size = s;
         position = p;
         group = g;
-        ui_type = FUI_Type::GROUPBOX;
+        ui_type = FUI_Type::PROGRESSBAR;
     }
 
-    void FUI_Groupbox::draw(olc::PixelGameEngine* pge)
+    void FUI_ProgressBar::set_progress(float value)
     {
-        absolute_position = get_absolute_position();
-        auto text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(text))* text_scale;
+        progress.store(value, std::memory_order_relaxed);
+    }
 
-        pge->FillRectDecal(absolute_position, size, color_scheme.groupbox_background);
+    const float FUI_ProgressBar::get_progress()
+    {
+        if (count_source)
+            return count_total > 0 ? float(double(count_source->load(std::memory_order_relaxed)) / double(count_total)) : 0.f;
+        return progress_source->load(std::memory_order_relaxed);
+    }
 
-        // top left outline
-        pge->FillRectDecal(absolute_position, olc::vf2d{ (size.x / 2) - (text_size.x / 2), 1.f }, color_scheme.groupbox_outline);
-        // top right outline
-        pge->FillRectDecal(olc::vf2d{ absolute_position.x + (size.x / 2) + (text_size.x / 2), absolute_position.y },
-            olc::vf2d{ size.x - (size.x / 2) - (text_size.x / 2), 1.f }, color_scheme.groupbox_outline);
+    void FUI_ProgressBar::set_source(const std::atomic<float>* source)
+    {
+        progress_source = source ? source : &progress;
+        count_source = nullptr;
+    }
 
-        // left outline
-        pge->FillRectDecal(absolute_position, olc::vf2d{ 1, size.y }, color_scheme.groupbox_outline);
-        // right outline
-        pge->FillRectDecal(olc::vf2d{ absolute_position.x + size.x - 1, absolute_position.y }, olc::vf2d{ 1.f, size.y }, color_scheme.groupbox_outline);
-        // bottom outline
-        pge->FillRectDecal(olc::vf2d{ absolute_position.x, absolute_position.y + size.y - 1 }, olc::vf2d{ size.x + 1.f, 1.f }, color_scheme.groupbox_outline);
+    void FUI_ProgressBar::set_source(const std::atomic<uint64_t>* done, uint64_t total)
+    {
+        count_source = done;
+        count_total = total;
+    }
 
-        pge->DrawStringPropDecal(olc::vf2d{ absolute_position.x + (size.x / 2) - (text_size.x / 2), absolute_position.y - (text_size.y / 2) }, text, text_color);
+    void FUI_ProgressBar::show_percentage(bool state)
+    {
+        if (state != show_label)
+            request_redraw();
+        show_label = state;
+    }
+
+    bool FUI_ProgressBar::update(olc::PixelGameEngine* pge)
+    {
+        FUI_Element::update(pge);
+
+        float value = get_progress();
+        // also catches NaN
+        if (!(value > 0.f))
+            value = 0.f;
+        else if (value > 1.f)
+            value = 1.f;
+
+        float inner_width = std::max(0.f, size.x - 2.f);
+        int width = int(value * inner_width);
+        if (width == filled_width && label_scale == text_scale)
+            return false;
+
+        filled_width = width;
+        // the percentage follows the filled width, it can't change without the bar moving
+        int percent = inner_width > 0.f ? int(std::lround(100.0 * width / inner_width)) : 0;
+        if (label.set(int64_t(percent)) || label_scale != text_scale)
+        {
+            label_scale = text_scale;
+            label_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(label.get())) * text_scale;
+        }
+        return true;
+    }
+
+    void FUI_ProgressBar::draw(olc::PixelGameEngine* pge)
+    {
+        absolute_position = get_absolute_position();
+        float inner_width = std::max(0.f, size.x - 2.f);
+
+        if (!text.empty())
+        {
+            if (measured_title != text || title_scale != text_scale)
+            {
+                measured_title = text;
+                title_scale = text_scale;
+                title_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(text)) * text_scale;
+            }
+            pge->DrawStringPropDecal({ absolute_position.x - title_size.x - 2.f, absolute_position.y + (size.y - title_size.y) * 0.5f }, text, text_color, text_scale);
+        }
+
+        pge->FillRectDecal(absolute_position, size, color_scheme.progressbar_outline);
+        pge->FillRectDecal(absolute_position + olc::vf2d{ 1.f, 1.f }, size - olc::vf2d{ 2.f, 2.f }, color_scheme.progressbar_background);
+        if (filled_width > 0)
+            pge->FillRectDecal(absolute_position + olc::vf2d{ 1.f, 1.f }, { float(filled_width), size.y - 2.f }, color_scheme.progressbar_fill);
 
+        if (show_label && label_size.x < inner_width)
+            pge->DrawStringPropDecal(absolute_position + (size - label_size) * 0.5f, label.get(), color_scheme.progressbar_text, text_scale);
     }
 
     /*
     ####################################################
-    #               FUI_SLIDER START                   #
+    #               FUI_SPINNER START                  #
     ####################################################
     */
-    FUI_Slider::FUI_Slider(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s, olc::vf2d r, FUI_Slider::type s_type)
+    FUI_Spinner::FUI_Spinner(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
         text = t;
         size = s;
         parent = pt;
         position = p;
-        range = r;
-        slider_type = s_type;
-        ui_type = FUI_Type::SLIDER;
+        ui_type = FUI_Type::SPINNER;
     }
 
-    FUI_Slider::FUI_Slider(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s, olc::vf2d r, FUI_Slider::type s_type)
+    FUI_Spinner::FUI_Spinner(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
         text = t;
         size = s;
         position = p;
-        range = r;
-        slider_type = s_type;
-        ui_type = FUI_Type::SLIDER;
+        ui_type = FUI_Type::SPINNER;
     }
 
-    FUI_Slider::FUI_Slider(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s, olc::vf2d r, FUI_Slider::type s_type)
+    FUI_Spinner::FUI_Spinner(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
         text = t;
@@ -2384,1221 +10270,1857 @@ namespace olc
         parent = pt;
         position = p;
         group = g;
-        range = r;
-        slider_type = s_type;
-        ui_type = FUI_Type::SLIDER;
+        ui_type = FUI_Type::SPINNER;
     }
 
-    FUI_Slider::FUI_Slider(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s, olc::vf2d r, FUI_Slider::type s_type)
+    FUI_Spinner::FUI_Spinner(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
     {
         identifier = id;
         text = t;
         size = s;
         position = p;
         group = g;
-        range = r;
-        slider_type = s_type;
-        ui_type = FUI_Type::SLIDER;
+        ui_type = FUI_Type::SPINNER;
     }
 
-    //////
+    void FUI_Spinner::layout_dots()
+    {
+        dot_layout_size = size;
+        float radius = std::min(size.x, size.y) * 0.5f;
+        dot_size = std::max(2.f, std::floor(radius * 0.35f));
+        float ring = radius - dot_size * 0.5f;
+        for (size_t i = 0; i < dot_offsets.size(); i++)
+        {
+            float angle = 2.f * 3.14159265f * float(i) / float(dot_offsets.size());
+            dot_offsets[i] = olc::vf2d{ radius + std::sin(angle) * ring, radius - std::cos(angle) * ring } - olc::vf2d{ dot_size, dot_size } * 0.5f;
+        }
+    }
 
-    FUI_Slider::FUI_Slider(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s, olc::vi2d r, FUI_Slider::type s_type)
+    void FUI_Spinner::set_active(bool state)
     {
-        identifier = id;
-        text = t;
-        size = s;
-        parent = pt;
-        position = p;
-        range = r;
-        slider_type = s_type;
-        ui_type = FUI_Type::SLIDER;
+        active.store(state, std::memory_order_relaxed);
     }
 
-    FUI_Slider::FUI_Slider(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s, olc::vi2d r, FUI_Slider::type s_type)
+    const bool FUI_Spinner::is_active()
     {
-        identifier = id;
-        text = t;
-        size = s;
-        position = p;
-        range = r;
-        slider_type = s_type;
-        ui_type = FUI_Type::SLIDER;
+        return active_source->load(std::memory_order_relaxed);
     }
 
-    FUI_Slider::FUI_Slider(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s, olc::vi2d r, FUI_Slider::type s_type)
+    void FUI_Spinner::set_source(const std::atomic<bool>* source)
     {
-        identifier = id;
-        text = t;
-        size = s;
-        parent = pt;
-        position = p;
-        group = g;
-        range = r;
-        slider_type = s_type;
-        ui_type = FUI_Type::SLIDER;
+        active_source = source ? source : &active;
+    }
+
+    void FUI_Spinner::set_speed(float steps_per_second)
+    {
+        speed = steps_per_second;
+    }
+
+    bool FUI_Spinner::update(olc::PixelGameEngine* pge)
+    {
+        FUI_Element::update(pge);
+
+        // read once per frame, a producer starting or stopping the spinner shows up as a change
+        bool state = is_active();
+        if (state == spinning)
+            return false;
+        spinning = state;
+        return true;
+    }
+
+    void FUI_Spinner::draw(olc::PixelGameEngine* pge)
+    {
+        absolute_position = get_absolute_position();
+
+        if (dot_layout_size != size)
+            layout_dots();
+
+        int count = int(dot_offsets.size());
+        int step = -1;
+        if (spinning)
+        {
+            step = int(std::fmod(frame->time * speed, double(count)));
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            olc::Pixel color = color_scheme.spinner_idle;
+            if (step >= 0)
+            {
+                // the lead dot and a fading tail behind it
+                int behind = (step - i + count) % count;
+                if (behind < 3)
+                    color = olc::PixelLerp(color_scheme.spinner_active, color_scheme.spinner_idle, behind / 3.f);
+            }
+            pge->FillRectDecal(absolute_position + dot_offsets[i], { dot_size, dot_size }, color);
+        }
+
+        if (!text.empty())
+        {
+            auto text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(text)) * text_scale;
+            pge->DrawStringPropDecal({ absolute_position.x + size.x + 4.f, absolute_position.y + (size.y - text_size.y) * 0.5f }, text, text_color, text_scale);
+        }
+    }
+
+    const double FUI_Spinner::get_next_change()
+    {
+        if (!spinning || !(speed > 0.f))
+            return FUI_Element::get_next_change();
+        // next dot step
+        return (std::floor(frame->time * speed) + 1.0) / speed;
+    }
+
+    /*
+    ####################################################
+    #               FUI_OPQUEUE START                  #
+    ####################################################
+    */
+    FUI_OpQueue::FUI_OpQueue()
+    {
+        head.store(&stub, std::memory_order_relaxed);
+        tail = &stub;
+    }
+
+    FUI_OpQueue::~FUI_OpQueue()
+    {
+        while (Node* node = pop())
+            delete node;
+    }
+
+    void FUI_OpQueue::push_node(Node* node)
+    {
+        node->next.store(nullptr, std::memory_order_relaxed);
+        Node* previous = head.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    void FUI_OpQueue::push(std::shared_ptr<FUI_Element> element, FUI_Op op)
+    {
+        Node* node = new Node();
+        node->element = std::move(element);
+        node->op = std::move(op);
+        push_node(node);
+    }
+
+    FUI_OpQueue::Node* FUI_OpQueue::pop()
+    {
+        Node* current = tail;
+        Node* next = current->next.load(std::memory_order_acquire);
+        if (current == &stub)
+        {
+            if (!next)
+                return nullptr;
+            tail = next;
+            current = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+        if (next)
+        {
+            tail = next;
+            return current;
+        }
+
+        // current is the last node, put the stub behind it so it can be handed out
+        if (current != head.load(std::memory_order_acquire))
+            return nullptr;
+        push_node(&stub);
+        next = current->next.load(std::memory_order_acquire);
+        if (next)
+        {
+            tail = next;
+            return current;
+        }
+        return nullptr;
+    }
+
+    /*
+    ####################################################
+    #               FUI_WORKERPOOL START               #
+    ####################################################
+    */
+    FUI_WorkerPool::~FUI_WorkerPool()
+    {
+        stop();
+    }
+
+    void FUI_WorkerPool::stop()
+    {
+        std::deque<FUI_Job> cancelled;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+            cancelled.swap(tasks);
+        }
+        condition.notify_all();
+        for (auto& worker : workers)
+            worker.join();
+        workers.clear();
+
+        // and what the tasks that were still running queued up
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto& task : tasks)
+                cancelled.push_back(std::move(task));
+            tasks.clear();
+        }
+        for (auto& task : cancelled)
+            if (task.cancel)
+                task.cancel();
+    }
+
+    void FUI_WorkerPool::work()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [this]() { return stopping || !tasks.empty(); });
+                if (stopping)
+                    return;
+                task = std::move(tasks.front().run);
+                tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    void FUI_WorkerPool::submit(std::function<void()> task, std::function<void()> cancel)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (stopping)
+            {
+                // submitted by a task that ran while the pool shut down
+                tasks.push_back(FUI_Job{ std::move(task), std::move(cancel) });
+                return;
+            }
+            if (workers.empty())
+            {
+                // leave a core for the render thread
+                unsigned int count = std::max(2u, std::thread::hardware_concurrency()) - 1;
+                for (unsigned int i = 0; i < count; i++)
+                    workers.emplace_back(&FUI_WorkerPool::work, this);
+            }
+            tasks.push_back(FUI_Job{ std::move(task), std::move(cancel) });
+        }
+        condition.notify_one();
     }
 
-    FUI_Slider::FUI_Slider(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s, olc::vi2d r, FUI_Slider::type s_type)
+    /*
+    ####################################################
+    #               FUI_EVENTBUS START                 #
+    ####################################################
+    */
+    uint64_t FUI_EventBus::subscribe(FUI_EventType type, FUI_Element* element, std::function<void(const FUI_Event&)> callback)
     {
-        identifier = id;
-        text = t;
-        size = s;
-        position = p;
-        group = g;
-        range = r;
-        slider_type = s_type;
-        ui_type = FUI_Type::SLIDER;
+        subscriptions.push_back(Subscription{ next_id, type, element, std::move(callback) });
+        return next_id++;
+    }
+
+    void FUI_EventBus::unsubscribe(uint64_t id)
+    {
+        for (auto& subscription : subscriptions)
+        {
+            if (subscription.id == id)
+            {
+                // erased after dispatching, the callback might be the one running
+                subscription.id = 0;
+                has_removed = true;
+                break;
+            }
+        }
+        if (!is_dispatching && has_removed)
+        {
+            subscriptions.erase(std::remove_if(subscriptions.begin(), subscriptions.end(), [](const Subscription& s) { return s.id == 0; }), subscriptions.end());
+            has_removed = false;
+        }
     }
 
-    std::string FUI_Slider::to_string_with_precision(const float a_value, const int n = 6)
+    void FUI_EventBus::push(FUI_EventType type, std::shared_ptr<FUI_Element> element)
     {
-        std::ostringstream out;
-        out.precision(n);
-        out << std::fixed << a_value;
-        return out.str();
+        queue.push_back(FUI_Event{ type, std::move(element) });
     }
 
-    void FUI_Slider::draw(olc::PixelGameEngine* pge)
+    void FUI_EventBus::dispatch()
     {
-        absolute_position = get_absolute_position();
+        if (queue.empty())
+            return;
 
-        // start with the value of the value_holder else set value to minimum in range
-        if (run_once)
+        // both buffers keep their capacity, new events from callbacks go into the other one
+        std::swap(queue, dispatching);
+        is_dispatching = true;
+        for (auto& event : dispatching)
         {
-            // check if there's negative values in the range
-            if (range.x < 0)
-                has_negative = true;
-            switch (slider_type)
+            event.element->run_event(event.type);
+            size_t count = subscriptions.size();
+            for (size_t i = 0; i < count; i++)
             {
-            case type::FLOAT:
-                if (slider_value_float < range.x)
-                    slider_value_float = range.x;
-                else
-
-                if (has_negative)
-                {
-                    if (slider_value_float < 0.0f)
-                        slider_ratio = (1.0f - (slider_value_float / range.x)) * 0.5;
-                    else if (slider_value_float > 0.0f)
-                        slider_ratio = (1.0f + (slider_value_float / range.y)) * 0.5;
-                    else
-                        slider_ratio = 0.5f;
-                }
-                else
-                    slider_ratio = slider_value_float / range.y;
-                break;
-            case type::INT:
-                if (slider_value_int < range.x)
-                    slider_value_int = range.x;
-
-                if (has_negative)
-                {
-                    if (slider_value_int < 0)
-                        slider_ratio = (1.0f - (slider_value_int / range.x)) * 0.5;
-                    else if (slider_value_int > 0)
-                        slider_ratio = (1.0f + (slider_value_int / range.y)) * 0.5;
-                    else
-                        slider_ratio = 0.5f;
-                }
-                else
-                    slider_ratio = slider_value_int / range.y;
-                break;
+                auto& subscription = subscriptions[i];
+                if (subscription.id != 0 && subscription.type == event.type && (!subscription.element || subscription.element == event.element.get()))
+                    subscription.callback(event);
             }
+        }
+        is_dispatching = false;
+        dispatching.clear();
 
-            run_once = false;
+        if (has_removed)
+        {
+            subscriptions.erase(std::remove_if(subscriptions.begin(), subscriptions.end(), [](const Subscription& s) { return s.id == 0; }), subscriptions.end());
+            has_removed = false;
         }
+    }
 
-        // draw title with slider value
-        std::string temp_text;
+    const bool FUI_EventBus::has_pending()
+    {
+        return !queue.empty();
+    }
 
-        switch (slider_type)
+    /*
+    ####################################################
+    #               FUI_IMMEDIATE START                #
+    ####################################################
+    */
+    uint64_t FUI_ImmediateTable::hash(const void* data, size_t length, uint64_t seed)
+    {
+        uint64_t result = seed;
+        auto bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < length; i++)
         {
-        case type::FLOAT:
-            temp_text = "[" + to_string_with_precision(slider_value_float, 2) + "]";
-            break;
-        case type::INT:
-            temp_text = "[" + std::to_string(slider_value_int) + "]";
-            break;
+            result ^= bytes[i];
+            result *= 1099511628211ull;
         }
+        return result > deleted_id ? result : result + 2;
+    }
 
-        auto text_size_title = static_cast<olc::vf2d>(pge->GetTextSizeProp(text))* text_scale;
-        pge->DrawStringPropDecal(olc::vf2d{ absolute_position.x - text_size_title.x, absolute_position.y + (size.y / 2) - (text_size_title.y / 2) + 1 }, text, text_color);
-        // draw slider body
-        switch (state)
+    void FUI_ImmediateTable::rehash(size_t capacity)
+    {
+        std::vector<Slot> old = std::move(slots);
+        slots.clear();
+        slots.resize(capacity);
+        used = 0;
+        for (auto& slot : old)
         {
-        case State::NONE:
-            pge->FillRectDecal(absolute_position, olc::vf2d{ size.x * slider_ratio, size.y }, color_scheme.slider_normal);
-            break;
-        case State::HOVER:
-            pge->FillRectDecal(absolute_position, olc::vf2d{ size.x * slider_ratio, size.y }, color_scheme.slider_hover);
-            break;
-        case State::ACTIVE:
-            pge->FillRectDecal(absolute_position, olc::vf2d{ size.x * slider_ratio, size.y }, color_scheme.slider_hover);
-            break;
+            if (slot.id <= deleted_id)
+                continue;
+            size_t index = slot.id & (capacity - 1);
+            while (slots[index].id != empty_id)
+                index = (index + 1) & (capacity - 1);
+            slots[index] = std::move(slot);
+            used++;
         }
-
-        // Draw text ontop of the slider body
-        auto text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(temp_text))* text_scale;
-        pge->DrawStringPropDecal(olc::vf2d{ absolute_position.x + size.x / 2 - text_size.x / 2, absolute_position.y + (size.y / 2) - (text_size.y / 2) + 1 }, temp_text, text_color);
-
-        // top left outline
-        pge->FillRectDecal(absolute_position, olc::vf2d{ size.x, 1.f }, color_scheme.slider_outline);
-        // left outline
-        pge->FillRectDecal(absolute_position, olc::vf2d{ 1.f, size.y }, color_scheme.slider_outline);
-        // right outline
-        pge->FillRectDecal(olc::vf2d{ absolute_position.x + size.x - 1, absolute_position.y }, olc::vf2d{ 1.f, size.y }, color_scheme.slider_outline);
-        // bottom outline
-        pge->FillRectDecal(olc::vf2d{ absolute_position.x, absolute_position.y + size.y }, olc::vf2d{ size.x, 1.f }, color_scheme.slider_outline);
     }
 
-    void FUI_Slider::input(olc::PixelGameEngine* pge)
+    FUI_ImmediateTable::Widget* FUI_ImmediateTable::acquire(uint64_t id, uint64_t frame, bool& created)
     {
-        if (pge->GetMousePos().x >= absolute_position.x &&
-            pge->GetMousePos().x <= absolute_position.x + size.x &&
-            pge->GetMousePos().y >= absolute_position.y &&
-            pge->GetMousePos().y <= absolute_position.y + size.y)
+        // keep at most 70% of the slots in use, deleted ones included
+        if (slots.empty() || (used + 1) * 10 > slots.size() * 7)
+            rehash(std::max<size_t>(64, live * 2 + 2 > slots.size() ? slots.size() * 2 : slots.size()));
+
+        size_t mask = slots.size() - 1;
+        size_t index = id & mask;
+        size_t reuse = slots.size();
+        while (slots[index].id != empty_id)
         {
-            state = State::HOVER;
-            if (pge->GetMouse(0).bHeld)
+            if (slots[index].id == id)
             {
-                state = State::ACTIVE;
-                is_focused = true;
+                created = false;
+                if (slots[index].last_frame != frame)
+                    seen++;
+                slots[index].last_frame = frame;
+                return slots[index].widget.get();
             }
+            if (slots[index].id == deleted_id && reuse == slots.size())
+                reuse = index;
+            index = (index + 1) & mask;
         }
-        else if (state != State::ACTIVE)
-            state = State::NONE;
-
-        if (pge->GetMouse(0).bReleased)
-            state = State::NONE;
 
-        if (state == State::ACTIVE)
+        if (reuse != slots.size())
+            index = reuse;
+        else
+            used++;
+        auto& slot = slots[index];
+        slot.id = id;
+        slot.last_frame = frame;
+        if (!slot.widget)
+            slot.widget = std::make_unique<Widget>();
+        live++;
+        seen++;
+        created = true;
+        return slot.widget.get();
+    }
+
+    void FUI_ImmediateTable::collect(uint64_t frame)
+    {
+        // nothing went missing, no need to look at every slot
+        if (seen < live)
         {
-            if (has_negative)
-                if (((pge->GetMouseX() - (absolute_position.x)) / size.x) <= 0.5)
+            for (auto& slot : slots)
+            {
+                if (slot.id > deleted_id && slot.last_frame != frame)
                 {
-                    ratio = (-1.0f * (pge->GetMouseX() - (absolute_position.x)) / size.x) * 2.0f;
+                    slot.id = deleted_id;
+                    slot.widget.reset();
+                    live--;
                 }
-                else
-                    ratio = -1.0f + ((pge->GetMouseX() - (absolute_position.x)) / size.x) * 2;
+            }
+        }
+        seen = 0;
+    }
 
-            slider_ratio = (pge->GetMouseX() - (absolute_position.x)) / size.x;
+    const size_t FUI_ImmediateTable::get_size()
+    {
+        return live;
+    }
 
-            if (slider_ratio <= 0.0f)
-                slider_ratio = 0.0f;
-            else if (slider_ratio >= 1.0f)
-                slider_ratio = 1.0f;
+    /*
+    ####################################################
+    #               FUI_HANDLER START                  #
+    ####################################################
+    */
+    FrostUI::~FrostUI()
+    {
+        // see run_async, nothing posts completions once the workers are joined
+        worker_pool.stop();
+        for (auto* pending : { &running_completions, &completions })
+            for (auto& completion : *pending)
+                if (completion.cancel)
+                    completion.cancel();
 
-            if (slider_ratio <= 0.0f)
-                ratio = 0.0f;
-            else if (slider_ratio >= 1.0f)
-                ratio = 1.0f;
+        // handles can keep elements alive after the ui is gone
+        for (auto& element : elements)
+            element->redraw_flag = nullptr;
+        for (auto& groupbox : groupboxes)
+            groupbox->redraw_flag = nullptr;
+        if (FUI_Element::frame == &frame)
+            FUI_Element::frame = &FUI_Element::idle_frame;
+        if (FUI_Element::running_redraw == &redraw_requested)
+            FUI_Element::running_redraw = nullptr;
+    }
 
-            switch (slider_type)
+    bool FrostUI::is_a_window_focused()
+    {
+        for (auto& window : windows)
+        {
+            if (window->get_closed_state())
+                continue;
+            if (window->is_focused())
+                return true;
+        }
+        return false;
+    }
+
+    bool FrostUI::disable_window_input_if_open_dropdown(int window_index)
+    {
+        for (auto element : elements)
+        {
+            if (!element->get_parent() || windows[window_index]->get_id() != element->get_parent()->get_id())
+                continue;
+            if (element->get_ui_type() == FUI_Type::DROPDOWN || element->get_ui_type() == FUI_Type::COMBOLIST)
             {
-            case type::FLOAT:
-                if (has_negative)
+                auto adaptive = element->get_absolute_position();
+                auto size = element->get_size();
+                auto position = element->get_position();
+                auto amount = element->get_elements_amount();
+                if (element->get_focused_status() && (frame.mouse_position.x >= adaptive.x + position.x &&
+                    frame.mouse_position.x <= adaptive.x + position.x + size.x &&
+                    frame.mouse_position.y >= adaptive.y + position.y &&
+                    frame.mouse_position.y <= adaptive.y + position.y + (size.y * amount) + size.y))
+                    return true;
+            }
+
+        }
+        return false;
+    }
+
+    void FrostUI::cycle_inputfield()
+    {
+        if (frame.get_key(olc::TAB).bPressed)
+        {
+            int i = 0;
+            int j = 0;
+            bool input_was_focused = false;
+            for (auto& element : elements)
+            {
+                if (element->get_focused_status() && element->get_ui_type() == FUI_Type::INPUTFIELD)
                 {
-                    if (ratio <= 0.0f)
-                        slider_value_float = range.x * (1.0f - (-1.0f * ratio));
-                    else
-                        slider_value_float = range.y * ratio;
+                    element->set_focused_status(false);
+                    input_was_focused = true;
+                    break;
                 }
-                else
-                    slider_value_float = range.y * slider_ratio;
-
-                if (slider_value_float < range.x)
-                    slider_value_float = range.x;
-                else if (slider_value_float > range.y)
-                    slider_value_float = range.y;
-                break;
-            case type::INT:
-                if (has_negative)
+                i++;
+            }
+            for (auto& element : elements)
+            {
+                if (element->get_ui_type() == FUI_Type::INPUTFIELD && j > i&& input_was_focused)
                 {
-                    if (ratio <= 0.0f)
-                        slider_value_int = range.x * (1.0f - (-1.0f * ratio));
-                    else
-                        slider_value_int = range.y * ratio;
+                    element->set_focused_status(true);
+                    break;
                 }
-                else
-                    slider_value_int = range.y * slider_ratio;
-
-                if (slider_value_int < range.x)
-                    slider_value_int = range.x;
-                else if (slider_value_int > range.y)
-                    slider_value_int = range.y;
-                break;
+                j++;
             }
         }
+    }
 
-        if (pge->GetMouse(0).bReleased)
-            is_focused = false;
+    bool FrostUI::is_cursor_in_window()
+    {
+        for (auto& window : windows)
+        {
+            if (window->get_closed_state())
+                continue;
+            auto pos = window->get_position();
+            auto size = window->get_size();
+            if (frame.mouse_position.x > pos.x&& frame.mouse_position.x <= pos.x + size.x)
+                if (frame.mouse_position.y > pos.y&& frame.mouse_position.y <= pos.y + size.y)
+                    return true;
+        }
+        return false;
     }
 
-    /*
-    ####################################################
-    #               FUI_TEXTFIELD START                #
-    ####################################################
-    */
-    FUI_Inputfield::FUI_Inputfield(const std::string& id, FUI_Window* pt, const std::string& t, olc::vi2d p, olc::vi2d s)
+    void FrostUI::push_focused_to_back()
     {
-        identifier = id;
-        text = t;
-        size = s;
-        parent = pt;
-        position = p;
-        ui_type = FUI_Type::INPUTFIELD;
+        int i = 0;
+        for (auto& window : windows)
+        {
+            if (window->get_closed_state())
+            {
+                i++;
+                continue;
+            }
+            if (window->is_focused())
+            {
+                windows.emplace_back(window);
+                windows.erase(windows.begin() + i);
+            }
+            i++;
+        }
     }
 
-    FUI_Inputfield::FUI_Inputfield(const std::string& id, const std::string& t, olc::vi2d p, olc::vi2d s)
+    void FrostUI::push_focused_element_to_back()
     {
-        identifier = id;
-        text = t;
-        size = s;
-        position = p;
-        ui_type = FUI_Type::INPUTFIELD;
+        int i = 0;
+        for (auto& element : elements)
+        {
+            if (element->get_focused_status())
+            {
+                elements.emplace_back(element);
+                elements.erase(elements.begin() + i);
+            }
+            i++;
+        }
     }
 
-    FUI_Inputfield::FUI_Inputfield(const std::string& id, FUI_Window* pt, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    void FrostUI::set_active_window(const std::string& window_id)
     {
-        identifier = id;
-        text = t;
-        size = s;
-        parent = pt;
-        position = p;
-        group = g;
-        ui_type = FUI_Type::INPUTFIELD;
+        for (auto& window : windows)
+        {
+            if (window->get_id() == window_id)
+            {
+                active_window_id = window_id;
+                break;
+            }
+            else
+                active_window_id.clear();
+        }
+        if (active_window_id.empty())
+            std::cout << "Could not find the window ID in added windows (function affected: set_active_window, affected window_id: " + window_id + ")\n";
     }
 
-    FUI_Inputfield::FUI_Inputfield(const std::string& id, const std::string& g, const std::string& t, olc::vi2d p, olc::vi2d s)
+    void FrostUI::set_active_group(const std::string& g)
     {
-        identifier = id;
-        text = t;
-        size = s;
-        position = p;
-        group = g;
-        ui_type = FUI_Type::INPUTFIELD;
+        // the active group decides which elements are drawn
+        if (g != active_group.second)
+            request_redraw();
+        for (auto group : groups)
+        {
+            if (group.second == g)
+            {
+                active_group.first = group.first;
+                active_group.second = group.second;
+                break;
+            }
+            else
+            {
+                active_group.first.clear();
+                active_group.second.clear();
+            }
+        }
+        if (active_group.first.empty() && active_group.second.empty())
+            std::cout << "Could not find the group ID in added windows (function affected: set_active_group, affected window_id: " + g + ")\n";
     }
 
-    bool FUI_Inputfield::is_textkey_pressed(olc::PixelGameEngine* pge, const TextKey& key)
+    FUI_Window* FrostUI::create_window(const std::string& identifier, const std::string& title, olc::vi2d position, olc::vi2d size)
     {
-        int vTextKey = 0;
-        switch (key)
+        bool is_duplicate = false;
+        FUI_Window* temp_window = nullptr;
+        for (auto& window : windows)
         {
-        default:                        vTextKey = olc::NONE;        break;
-        case TextKey::A:                vTextKey = olc::A;           break;
-        case TextKey::B:                vTextKey = olc::B;           break;
-        case TextKey::C:                vTextKey = olc::C;           break;
-        case TextKey::D:                vTextKey = olc::D;           break;
-        case TextKey::E:                vTextKey = olc::E;           break;
-        case TextKey::F:                vTextKey = olc::F;           break;
-        case TextKey::G:                vTextKey = olc::G;           break;
-        case TextKey::H:                vTextKey = olc::H;           break;
-        case TextKey::I:                vTextKey = olc::I;           break;
-        case TextKey::J:                vTextKey = olc::J;           break;
-        case TextKey::K:                vTextKey = olc::K;           break;
-        case TextKey::L:                vTextKey = olc::L;           break;
-        case TextKey::M:                vTextKey = olc::M;           break;
-        case TextKey::N:                vTextKey = olc::N;           break;
-        case TextKey::O:                vTextKey = olc::O;           break;
-        case TextKey::P:                vTextKey = olc::P;           break;
-        case TextKey::Q:                vTextKey = olc::Q;           break;
-        case TextKey::R:                vTextKey = olc::R;           break;
-        case TextKey::S:                vTextKey = olc::S;           break;
-        case TextKey::T:                vTextKey = olc::T;           break;
-        case TextKey::U:                vTextKey = olc::U;           break;
-        case TextKey::V:                vTextKey = olc::V;           break;
-        case TextKey::W:                vTextKey = olc::W;           break;
-        case TextKey::X:                vTextKey = olc::X;           break;
-        case TextKey::Y:                vTextKey = olc::Y;           break;
-        case TextKey::Z:                vTextKey = olc::Z;           break;
-        case TextKey::Num0:             vTextKey = olc::K0;          break;
-        case TextKey::Num1:             vTextKey = olc::K1;          break;
-        case TextKey::Num2:             vTextKey = olc::K2;          break;
-        case TextKey::Num3:             vTextKey = olc::K3;          break;
-        case TextKey::Num4:             vTextKey = olc::K4;          break;
-        case TextKey::Num5:             vTextKey = olc::K5;          break;
-        case TextKey::Num6:             vTextKey = olc::K6;          break;
-        case TextKey::Num7:             vTextKey = olc::K7;          break;
-        case TextKey::Num8:             vTextKey = olc::K8;          break;
-        case TextKey::Num9:             vTextKey = olc::K9;          break;
-
-        case TextKey::LBracket:         vTextKey = olc::OEM_4;       break;
-        case TextKey::RBracket:         vTextKey = olc::OEM_6;       break;
-        case TextKey::Semicolon:        vTextKey = olc::OEM_1;       break;
-        case TextKey::Comma:            vTextKey = olc::COMMA;       break;
-        case TextKey::Period:           vTextKey = olc::PERIOD;      break;
-        case TextKey::Quote:            vTextKey = olc::OEM_7;       break;
-        case TextKey::ForwardSlash:     vTextKey = olc::OEM_2;       break;
-        case TextKey::BackwardSlash:    vTextKey = olc::OEM_5;       break;
-        case TextKey::Tilda:            vTextKey = olc::OEM_3;       break;
-        case TextKey::Equal:            vTextKey = olc::EQUALS;      break;
-        case TextKey::Hyphen:           vTextKey = olc::MINUS;       break;
-
-        case TextKey::Space:            vTextKey = olc::SPACE;       break;
+            if (window->get_id() == identifier)
+                is_duplicate = true;
+        }
+        if (!is_duplicate)
+        {
+            windows.emplace_back(new FUI_Window{ pge, identifier, position, size, title });
+            temp_window = windows.back();
+            structure_version++;
         }
+        else
+            std::cout << "Cannot add duplicates of same window (function affected: create_window, affected window_id: " + identifier + ")\n";
+
+        if (windows.size() == 1)
+            windows.back()->set_focused(true);
 
-        return pge->GetKey((olc::Key)vTextKey).bPressed;
+        return temp_window;
     }
 
-    int FUI_Inputfield::get_char_id(olc::PixelGameEngine* pge)
+    void FrostUI::add_group(const std::string& window_id, const std::string& group_id)
     {
-        for (int i = 0; i < text_keys; i++) {
-            if (is_textkey_pressed(pge, (TextKey)i)) {
-                return i;
-            }
+        bool is_duplicate = false;
+        for (auto group : groups)
+        {
+            if (group.second == group_id)
+                is_duplicate = true;
         }
-        return static_cast<int>(TextKey::None);
+        if (!is_duplicate)
+            groups.emplace_back(std::make_pair(window_id, group_id));
+        else
+            std::cout << "Cannot add duplicates of same group (function affected: add_group, affected group_id: " + group_id + ")\n";
     }
 
-    std::string FUI_Inputfield::get_char_from_id(olc::PixelGameEngine* pge)
+    void FrostUI::clear_active_window()
     {
-        int index = get_char_id(pge);
-        if (index == static_cast<int>(TextKey::None)) return "";
-
-        if (pge->GetKey(olc::SHIFT).bHeld) {
-            return std::string(1, text_shift[index]);
-        }
+        active_window_id.clear();
+    }
 
-        return std::string(1, text_noshift[index]);
+    void FrostUI::clear_active_group()
+    {
+        if (!active_group.second.empty())
+            request_redraw();
+        active_group.first.clear();
+        active_group.second.clear();
     }
 
+    const std::string& FrostUI::get_active_group()
+    {
+        return active_group.second;
+    }
 
-    std::string FUI_Inputfield::get_clipboard_data()
+    FUI_Window* FrostUI::find_window(const std::string& identifier)
     {
-#ifdef _MSC_VER
-        if (OpenClipboard(NULL))
+        for (auto& window : windows)
         {
-            auto data = GetClipboardData(CF_TEXT);
-            std::string text = "";
-            try
-            {
-                text = (char*)data;
-            }
-            catch (char* e)
-            {
-                return text;
-            }
-            CloseClipboard();
-
-            return text;
+            if (window->get_id() == identifier)
+                return window;
         }
-        else
-            return "";
-#endif
-        return "";
+        std::cout << "Could not find the window ID in added windows (function affected: find_window, affected window_id: " + identifier + ")\n";
+        return nullptr;
     }
 
-    void FUI_Inputfield::copy_to_clipboard(std::string data)
+    int FrostUI::get_element_amount() { return elements.size(); }
+
+    void FrostUI::adopt(FUI_Element* element)
     {
-#ifdef _MSC_VER
-        if (data.size() > 0 && OpenClipboard(NULL))
-        {
-            EmptyClipboard();
+        element->redraw_flag = &redraw_requested;
+        structure_version++;
+    }
 
-            HGLOBAL hg = GlobalAlloc(GMEM_MOVEABLE, data.size() + 1);
-            if (!hg) {
-                CloseClipboard();
-                return;
+    void FrostUI::remove_element(const std::string& id)
+    {
+        int i = 0;
+        for (auto& element : elements)
+        {
+            if (element->get_identifier() == id)
+            {
+                if (element->get_container())
+                    element->get_container()->remove_child(element.get());
+                elements.erase(elements.begin() + i);
+                structure_version++;
+                break;
             }
-            memcpy(GlobalLock(hg), data.c_str(), data.size() + 1);
-            GlobalUnlock(hg);
-            SetClipboardData(CF_TEXT, hg);
-            CloseClipboard();
-            GlobalFree(hg);
+            i++;
         }
-#endif
     }
 
-    void FUI_Inputfield::draw(olc::PixelGameEngine* pge)
+    void FrostUI::remove_window(const std::string& id)
     {
-        absolute_position = get_absolute_position();
-        auto title_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(text))* text_scale;
-        auto display_text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(displayed_text))* input_scale + olc::vf2d{ 2.f, 0.f };
-        // title text
-        auto text_position = olc::vf2d{ absolute_position.x - title_text_size.x, absolute_position.y + (size.y / 2) - (title_text_size.y / 2) };
-        auto timer = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
-        auto cursor_size = pge->GetTextSizeProp("_") * input_scale;
-
-        pge->DrawStringPropDecal(text_position, text, text_color, text_scale);
-
-        // outline
-        pge->FillRectDecal(absolute_position, size, color_scheme.inputfield_outline);
-        // background
-        pge->FillRectDecal(absolute_position + olc::vf2d{ 1.0f, 1.0f }, size - olc::vf2d{ 2.0f, 2.0f }, color_scheme.inputfield_background);
-
-        // render the text ( + 3 in text_position is used as an offset to not render the first letter inside of the outline)
-        text_position = olc::vf2d{ absolute_position.x + 3, absolute_position.y + (size.y / 2) - (display_text_size.y / 2) };
-        auto cursor_position = olc::vf2d{ text_position.x + display_text_size.x, text_position.y + display_text_size.y };
-
-        if (display_text_size.x <= size.x && inputfield_text.size() > old_inputfield_text.size())
+        int i = 0;
+        for (auto& window : windows)
         {
-            if (mask_inputfield)
-                displayed_text += "*";
-            else if (displayed_text != inputfield_text)
+            if (window->get_id() == id)
             {
-                if (!did_paste)
-                    displayed_text += inputfield_text.back();
-                else
-                    did_paste = false;
+                int j = 0;
+                for (auto& element : elements)
+                {
+                    if (!element->get_parent())
+                    {
+                        j++;
+                        continue;
+                    }
+                    if (element->get_parent()->get_id() == id)
+                    {
+                        elements.erase(elements.begin() + j);
+                        break;
+                    }
+                    j++;
+                }
+                for (size_t k = 0; k < immediate_windows.size(); k++)
+                {
+                    if (immediate_windows[k].second == window)
+                    {
+                        immediate_windows.erase(immediate_windows.begin() + k);
+                        break;
+                    }
+                }
+                windows.erase(windows.begin() + i);
+                structure_version++;
+                break;
             }
-            old_inputfield_text = inputfield_text;
-        }
-        else if (display_text_size.x >= size.x - 1)
-        {
-            text_out_of_view.push_back(displayed_text.front());
-            displayed_text.erase(0, 1);
+            i++;
         }
+    }
 
-        if (clear_inputfield)
+    std::shared_ptr<FUI_Element> FrostUI::find_element(const std::string& id)
+    {
+        for (auto& element : elements)
         {
-            inputfield_text.clear();
-            displayed_text.clear();
-            text_out_of_view.clear();
-            old_inputfield_text.clear();
-
-            clear_inputfield = false;
+            if (element->get_identifier() == id)
+                return element;
         }
+        return nullptr;
+    }
 
-        if (!set_input_text.empty())
+    std::shared_ptr<FUI_Element> FrostUI::find_groupbox(const std::string& id)
+    {
+        for (auto& element : groupboxes)
         {
-            displayed_text = set_input_text;
-            inputfield_text = set_input_text;
-            set_input_text.clear();
+            if (element->get_identifier() == id)
+                return element;
         }
+        return nullptr;
+    }
 
-        pge->DrawStringPropDecal(text_position, displayed_text, text_color, input_scale);
-        //std::cout << inputfield_text << "\n";
-
-        if (select_all && displayed_text.size() > 0)
-            pge->FillRectDecal(text_position, olc::vf2d(display_text_size.x, display_text_size.y), color_scheme.inputfield_select_all_background);
-        else
-            select_all = false;
-
-        if (selected_chars > 0 && !select_all)
+    FUI_LabelHandle FrostUI::add_label(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position)
+    {
+        if (!find_element(identifier))
         {
-            auto position = text_position;
-            for (int i = 1; i <= selected_chars; i++)
+            if (windows.size() > 0)
             {
-                auto char_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(displayed_text.substr(displayed_text.size() - i, 1)))* input_scale;
-                position.x -= char_size.x;
-                pge->FillRectDecal(olc::vf2d((position.x + display_text_size.x), position.y),
-                    olc::vf2d(char_size.x, display_text_size.y), color_scheme.inputfield_select_all_background);
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == parent_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Label>(identifier, window, active_group.second, text, position));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Label>(identifier, window, text, position));
+
+                        adopt(elements.back().get());
+                        return FUI_LabelHandle(std::static_pointer_cast<FUI_Label>(elements.back()));
+                    }
+                }
+                std::cout << "Could not find parent window ID (function affected: add_label, label_id affected: " + identifier + ")\n";
             }
+            else
+                std::cout << "There's no windows to be used as parent (function affected: add_label, label_id affected: " + identifier + ")\n";
         }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_label, label_id affected: " + identifier + ")\n";
 
-        if (cursor_position.x + cursor_size.x > absolute_position.x + size.x)
-            cursor_position.x -= (cursor_position.x + cursor_size.x) - (absolute_position.x + size.x);
+        return {};
+    }
 
-        if (state == State::ACTIVE)
+    FUI_LabelHandle FrostUI::add_label(const std::string& identifier, const std::string& text, olc::vi2d position)
+    {
+        if (!find_element(identifier))
         {
-            if (timer - last_cursor_tick > 500)
+            if (!active_window_id.empty())
             {
-                if (timer - last_cursor_tick > 1500)
-                    last_cursor_tick = timer;
-                pge->FillRectDecal(cursor_position, { static_cast<float>(cursor_size.x), 1.f }, color_scheme.inputfield_cursor);
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == active_window_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Label>(identifier, window, active_group.second, text, position));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Label>(identifier, window, text, position));
+
+                        adopt(elements.back().get());
+                        return FUI_LabelHandle(std::static_pointer_cast<FUI_Label>(elements.back()));
+                    }
+                }
+            }
+            else
+            {
+                if (!active_group.second.empty())
+                    elements.emplace_back(std::make_shared<FUI_Label>(identifier, active_group.second, text, position));
+                else
+                    elements.emplace_back(std::make_shared<FUI_Label>(identifier, text, position));
+
+                adopt(elements.back().get());
+                return FUI_LabelHandle(std::static_pointer_cast<FUI_Label>(elements.back()));
             }
         }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_label, label_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    void FUI_Inputfield::input(olc::PixelGameEngine* pge)
+    FUI_CheckboxHandle FrostUI::add_checkbox(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
     {
-        auto timer = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
-
-        if (pge->GetMousePos().x >= absolute_position.x &&
-            pge->GetMousePos().x <= absolute_position.x + size.x &&
-            pge->GetMousePos().y >= absolute_position.y &&
-            pge->GetMousePos().y <= absolute_position.y + size.y)
+        if (!find_element(identifier))
         {
-            if (pge->GetMouse(0).bPressed)
+            if (windows.size() > 0)
             {
-                is_focused = true;
-                last_cursor_tick = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count() - 500;
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == parent_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Checkbox>(identifier, window, active_group.second, text, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Checkbox>(identifier, window, text, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_CheckboxHandle(std::static_pointer_cast<FUI_Checkbox>(elements.back()));
+                    }
+                }
+                std::cout << "Could not find parent window ID (function affected: add_checkbox, checkbox_id affected: " + identifier + ")\n";
             }
+            else
+                std::cout << "There's no windows to be used as parent (function affected: add_checkbox, checkbox_id affected: " + identifier + ")\n";
         }
-        else if (pge->GetMouse(0).bPressed && is_focused)
-            is_focused = false;
+        else
+            std::cout << "Duplicate IDs found (function affected: add_checkbox, checkbox_id affected: " + identifier + ")\n";
 
-        if (is_focused)
+        return {};
+    }
+
+    FUI_CheckboxHandle FrostUI::add_checkbox(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    {
+        if (!find_element(identifier))
         {
-            if (pge->GetKey(olc::CTRL).bHeld && pge->GetKey(olc::A).bPressed && !displayed_text.empty())
+            if (!active_window_id.empty())
             {
-                selected_chars = inputfield_text.size();
-                select_all = true;
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == active_window_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Checkbox>(identifier, window, active_group.second, text, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Checkbox>(identifier, window, text, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_CheckboxHandle(std::static_pointer_cast<FUI_Checkbox>(elements.back()));
+                    }
+                }
+            }
+            else
+            {
+                if (!active_group.second.empty())
+                    elements.emplace_back(std::make_shared<FUI_Checkbox>(identifier, active_group.second, text, position, size));
+                else
+                    elements.emplace_back(std::make_shared<FUI_Checkbox>(identifier, text, position, size));
+
+                adopt(elements.back().get());
+                return FUI_CheckboxHandle(std::static_pointer_cast<FUI_Checkbox>(elements.back()));
             }
+        }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_checkbox, checkbox_id affected: " + identifier + ")\n";
 
-            if (pge->GetKey(olc::ESCAPE).bPressed)
-                is_focused = false;
+        return {};
+    }
 
-            if (pge->GetKey(olc::ENTER).bPressed)
+    FUI_DropdownHandle FrostUI::add_dropdown(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    {
+        if (!find_element(identifier))
+        {
+            if (windows.size() > 0)
             {
-                selected_chars = 0;
-                select_all = false;
-                if (input_enter_callback)
-                    input_enter_callback();
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == parent_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Dropdown>(identifier, window, active_group.second, text, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Dropdown>(identifier, window, text, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_DropdownHandle(std::static_pointer_cast<FUI_Dropdown>(elements.back()));
+                    }
+                }
+                std::cout << "Could not find parent window ID (function affected: add_dropdown, dropdown_id affected: " + identifier + ")\n";
             }
+            else
+                std::cout << "There's no windows to be used as parent (function affected: add_dropdown, dropdown_id affected: " + identifier + ")\n";
+        }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_dropdown, dropdown_id affected: " + identifier + ")\n";
 
-            if (pge->GetKey(olc::SHIFT).bHeld && pge->GetKey(olc::LEFT).bPressed && !displayed_text.empty())
+        return {};
+    }
+
+    FUI_DropdownHandle FrostUI::add_dropdown(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    {
+        if (!find_element(identifier))
+        {
+            if (!active_window_id.empty())
             {
-                if (selected_chars <= displayed_text.size() - 1)
+                for (auto& window : windows)
                 {
-                    if (select_all)
-                        select_all = false;
-                    selected_chars++;
+                    if (window->get_id() == active_window_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Dropdown>(identifier, window, active_group.second, text, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Dropdown>(identifier, window, text, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_DropdownHandle(std::static_pointer_cast<FUI_Dropdown>(elements.back()));
+                    }
                 }
             }
-
-            if (pge->GetKey(olc::SHIFT).bHeld && pge->GetKey(olc::RIGHT).bPressed && selected_chars > 0)
+            else
             {
-                if (select_all)
-                    select_all = false;
-                selected_chars--;
+                if (!active_group.second.empty())
+                    elements.emplace_back(std::make_shared<FUI_Dropdown>(identifier, active_group.second, text, position, size));
+                else
+                    elements.emplace_back(std::make_shared<FUI_Dropdown>(identifier, text, position, size));
+
+                adopt(elements.back().get());
+                return FUI_DropdownHandle(std::static_pointer_cast<FUI_Dropdown>(elements.back()));
             }
+        }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_dropdown, dropdown_id affected: " + identifier + ")\n";
 
-            if (pge->GetKey(olc::CTRL).bHeld && pge->GetKey(olc::V).bPressed)
+        return {};
+    }
+
+    FUI_CombolistHandle FrostUI::add_combolist(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    {
+        if (!find_element(identifier))
+        {
+            if (windows.size() > 0)
             {
-                if (select_all)
-                {
-                    inputfield_text.clear();
-                    displayed_text.clear();
-                    text_out_of_view.clear();
-                    old_inputfield_text.clear();
-                }
-                if (selected_chars > 0 && !select_all)
+                for (auto& window : windows)
                 {
-                    inputfield_text.erase(inputfield_text.size() - selected_chars, inputfield_text.size());
-                    displayed_text.erase(displayed_text.size() - selected_chars, displayed_text.size());
-                    selected_chars = 0;
+                    if (window->get_id() == parent_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Combolist>(identifier, window, active_group.second, text, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Combolist>(identifier, window, text, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_CombolistHandle(std::static_pointer_cast<FUI_Combolist>(elements.back()));
+                    }
                 }
-                auto data = get_clipboard_data();
-                if (data.size() > 0)
+                std::cout << "Could not find parent window ID (function affected: add_combolist, combolist_id affected: " + identifier + ")\n";
+            }
+            else
+                std::cout << "There's no windows to be used as parent (function affected: add_combolist, combolist_id affected: " + identifier + ")\n";
+        }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_combolist, combolist_id affected: " + identifier + ")\n";
+
+        return {};
+    }
+
+    FUI_CombolistHandle FrostUI::add_combolist(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    {
+        if (!find_element(identifier))
+        {
+            if (!active_window_id.empty())
+            {
+                for (auto& window : windows)
                 {
-                    inputfield_text.append(data);
-                    displayed_text.append(data);
-                    did_paste = true;
+                    if (window->get_id() == active_window_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Combolist>(identifier, window, active_group.second, text, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Combolist>(identifier, window, text, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_CombolistHandle(std::static_pointer_cast<FUI_Combolist>(elements.back()));
+                    }
                 }
+            }
+            else
+            {
+                if (!active_group.second.empty())
+                    elements.emplace_back(std::make_shared<FUI_Combolist>(identifier, active_group.second, text, position, size));
+                else
+                    elements.emplace_back(std::make_shared<FUI_Combolist>(identifier, text, position, size));
 
-                if (select_all)
-                    select_all = false;
+                adopt(elements.back().get());
+                return FUI_CombolistHandle(std::static_pointer_cast<FUI_Combolist>(elements.back()));
             }
+        }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_combolist, combolist_id affected: " + identifier + ")\n";
+
+        return {};
+    }
 
-            if (pge->GetKey(olc::CTRL).bHeld && pge->GetKey(olc::C).bPressed)
+    FUI_GroupboxHandle FrostUI::add_groupbox(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    {
+        if (!find_element(identifier))
+        {
+            if (windows.size() > 0)
             {
-                if (select_all)
-                    copy_to_clipboard(inputfield_text);
-                if (selected_chars > 0 && !select_all)
+                for (auto& window : windows)
                 {
-                    //copy_to_clipboard(inputfield_text.substr(inputfield_text.size() - selected_chars, inputfield_text.size()));
-                    copy_to_clipboard(displayed_text.substr(displayed_text.size() - selected_chars, displayed_text.size()));
+                    if (window->get_id() == parent_id)
+                    {
+                        if (!active_group.second.empty())
+                            groupboxes.emplace_back(std::make_shared<FUI_Groupbox>(identifier, window, active_group.second, text, position, size));
+                        else
+                            groupboxes.emplace_back(std::make_shared<FUI_Groupbox>(identifier, window, text, position, size));
+
+                        adopt(groupboxes.back().get());
+                        return FUI_GroupboxHandle(std::static_pointer_cast<FUI_Groupbox>(groupboxes.back()));
+                    }
                 }
+                std::cout << "Could not find parent window ID (function affected: add_groupbox, groupbox_id affected: " + identifier + ")\n";
             }
+            else
+                std::cout << "There's no windows to be used as parent (function affected: add_groupbox, groupbox_id affected: " + identifier + ")\n";
+        }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_groupbox, groupbox_id affected: " + identifier + ")\n";
 
-            // related to holding backspace for deletion of characters
-            if (pge->GetKey(olc::BACK).bPressed && initial_backspace)
-                hold_backspace_tick = timer;
+        return {};
+    }
 
-            // Remove last character if backspace is pressed / remove selected_char amount if text is selected
-            if (pge->GetKey(olc::BACK).bHeld && !select_all && inputfield_text.size() > 0 &&
-                (initial_backspace || timer - hold_backspace_tick > 500) && timer - last_backspace_tick > 50)
+    FUI_GroupboxHandle FrostUI::add_groupbox(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    {
+        if (!find_element(identifier))
+        {
+            if (!active_window_id.empty())
             {
-                initial_backspace = false;
-                if (selected_chars > 0)
+                for (auto& window : windows)
                 {
-                    inputfield_text.erase(inputfield_text.size() - selected_chars, inputfield_text.size());
-                    displayed_text.erase(displayed_text.size() - selected_chars, displayed_text.size());
-                    old_inputfield_text.erase(old_inputfield_text.size() - selected_chars, old_inputfield_text.size());
-                    if (text_out_of_view.size() > 0)
+                    if (window->get_id() == active_window_id)
                     {
-                        displayed_text.insert(0, &text_out_of_view.back());
-                        text_out_of_view.pop_back();
+                        if (!active_group.second.empty())
+                            groupboxes.emplace_back(std::make_shared<FUI_Groupbox>(identifier, window, active_group.second, text, position, size));
+                        else
+                            groupboxes.emplace_back(std::make_shared<FUI_Groupbox>(identifier, window, text, position, size));
+
+                        adopt(groupboxes.back().get());
+                        return FUI_GroupboxHandle(std::static_pointer_cast<FUI_Groupbox>(groupboxes.back()));
                     }
-                    selected_chars = 0;
                 }
+            }
+            else
+            {
+                if (!active_group.second.empty())
+                    groupboxes.emplace_back(std::make_shared<FUI_Groupbox>(identifier, active_group.second, text, position, size));
                 else
+                    groupboxes.emplace_back(std::make_shared<FUI_Groupbox>(identifier, text, position, size));
+
+                adopt(groupboxes.back().get());
+                return FUI_GroupboxHandle(std::static_pointer_cast<FUI_Groupbox>(groupboxes.back()));
+            }
+        }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_groupbox, groupbox_id affected: " + identifier + ")\n";
+
+        return {};
+    }
+
+    FUI_SliderHandle<float> FrostUI::add_float_slider(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, olc::vf2d range)
+    {
+        if (!find_element(identifier))
+        {
+            if (windows.size() > 0)
+            {
+                for (auto& window : windows)
                 {
-                    inputfield_text.pop_back();
-                    displayed_text.pop_back();
-                    old_inputfield_text.pop_back();
-                    if (text_out_of_view.size() > 0)
+                    if (window->get_id() == parent_id)
                     {
-                        displayed_text.insert(0, &text_out_of_view.back());
-                        text_out_of_view.pop_back();
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Slider>(identifier, window, active_group.second, text, position, size, range, FUI_Slider::type::FLOAT));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Slider>(identifier, window, text, position, size, range, FUI_Slider::type::FLOAT));
+
+                        adopt(elements.back().get());
+                        return FUI_SliderHandle<float>(std::static_pointer_cast<FUI_Slider>(elements.back()));
                     }
                 }
-                last_backspace_tick = timer;
+                std::cout << "Could not find parent window ID (function affected: add_slider, slider_id affected: " + identifier + ")\n";
             }
+            else
+                std::cout << "There's no windows to be used as parent (function affected: add_slider, slider_id affected: " + identifier + ")\n";
+        }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_slider, slider_id affected: " + identifier + ")\n";
 
-            if (!pge->GetKey(olc::BACK).bHeld)
-                initial_backspace = true;
+        return {};
+    }
 
-            // Clear text
-            if ((select_all && get_char_from_id(pge).size() > 0 && !pge->GetKey(olc::CTRL).bHeld) ||
-                (select_all && pge->GetKey(olc::BACK).bPressed))
+    FUI_SliderHandle<float> FrostUI::add_float_slider(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, olc::vf2d range)
+    {
+        if (!find_element(identifier))
+        {
+            if (!active_window_id.empty())
             {
-                inputfield_text.clear();
-                displayed_text.clear();
-                text_out_of_view.clear();
-                old_inputfield_text.clear();
-                select_all = false;
-                selected_chars = 0;
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == active_window_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Slider>(identifier, window, active_group.second, text, position, size, range, FUI_Slider::type::FLOAT));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Slider>(identifier, window, text, position, size, range, FUI_Slider::type::FLOAT));
+
+                        adopt(elements.back().get());
+                        return FUI_SliderHandle<float>(std::static_pointer_cast<FUI_Slider>(elements.back()));
+                    }
+                }
             }
+            else
+            {
+                if (!active_group.second.empty())
+                    elements.emplace_back(std::make_shared<FUI_Slider>(identifier, active_group.second, text, position, size, range, FUI_Slider::type::FLOAT));
+                else
+                    elements.emplace_back(std::make_shared<FUI_Slider>(identifier, text, position, size, range, FUI_Slider::type::FLOAT));
 
-            // Append character to string
-            if (!pge->GetKey(olc::CTRL).bHeld)
-                inputfield_text.append(get_char_from_id(pge));
+                adopt(elements.back().get());
+                return FUI_SliderHandle<float>(std::static_pointer_cast<FUI_Slider>(elements.back()));
+            }
         }
-
-        if (is_focused)
-            state = State::ACTIVE;
         else
-            state = State::NONE;
-    }
+            std::cout << "Duplicate IDs found (function affected: add_slider, slider_id affected: " + identifier + ")\n";
 
-    FUI_Console::FUI_Console(const std::string& id, FUI_Window* parent, const std::string& title, olc::vi2d position, olc::vi2d size, int input_thickness = 10)
-    {
-        identifier = id;
-        this->parent = parent;
-        text = title;
-        this->position = position;
-        this->size = size;
-        this->input_thickness = input_thickness;
-        inputfield.set_size({ size.x, input_thickness });
-        ui_type = FUI_Type::CONSOLE;
+        return {};
     }
 
-    FUI_Console::FUI_Console(const std::string& id, FUI_Window* parent, const std::string& group, const std::string& title, olc::vi2d position, olc::vi2d size, int input_thickness = 10)
+    FUI_SliderHandle<int> FrostUI::add_int_slider(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, olc::vi2d range)
     {
-        identifier = id;
-        this->parent = parent;
-        text = title;
-        this->position = position;
-        this->size = size;
-        this->group = group;
-        this->input_thickness = input_thickness;
-        inputfield.set_size({ size.x, input_thickness });
-        ui_type = FUI_Type::CONSOLE;
-    }
+        if (!find_element(identifier))
+        {
+            if (windows.size() > 0)
+            {
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == parent_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Slider>(identifier, window, active_group.second, text, position, size, range, FUI_Slider::type::INT));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Slider>(identifier, window, text, position, size, range, FUI_Slider::type::INT));
 
-    FUI_Console::FUI_Console(const std::string& id, const std::string& title, olc::vi2d position, olc::vi2d size, int input_thickness = 10)
-    {
-        identifier = id;
-        this->parent = parent;
-        text = title;
-        this->position = position;
-        this->size = size;
-        this->input_thickness = input_thickness;
-        inputfield.set_size({ size.x, input_thickness });
-        ui_type = FUI_Type::CONSOLE;
-    }
+                        adopt(elements.back().get());
+                        return FUI_SliderHandle<int>(std::static_pointer_cast<FUI_Slider>(elements.back()));
+                    }
+                }
+                std::cout << "Could not find parent window ID (function affected: add_slider, slider_id affected: " + identifier + ")\n";
+            }
+            else
+                std::cout << "There's no windows to be used as parent (function affected: add_slider, slider_id affected: " + identifier + ")\n";
+        }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_slider, slider_id affected: " + identifier + ")\n";
 
-    FUI_Console::FUI_Console(const std::string& id, const std::string& group, const std::string& title, olc::vi2d position, olc::vi2d size, int input_thickness = 10)
-    {
-        identifier = id;
-        this->parent = parent;
-        text = title;
-        this->position = position;
-        this->size = size;
-        this->group = group;
-        this->input_thickness = input_thickness;
-        inputfield.set_size({ size.x, input_thickness });
-        ui_type = FUI_Type::CONSOLE;
+        return {};
     }
 
-    void FUI_Console::draw(olc::PixelGameEngine* pge)
+    FUI_SliderHandle<int> FrostUI::add_int_slider(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, olc::vi2d range)
     {
-        absolute_position = get_absolute_position() + olc::vf2d{ 0, 1 };
-
-        inputfield.inputfield_scale(text_scale);
-        inputfield.set_position({ absolute_position.x, absolute_position.y + size.y - 1 - input_thickness });
-
-        // outline
-        pge->FillRectDecal(absolute_position, { size.x , size.y - input_thickness }, color_scheme.console_outline);
-        // body
-        pge->FillRectDecal({ absolute_position.x + 1, absolute_position.y + 1 }, { size.x - 2, size.y - input_thickness - 2 }, color_scheme.console_background);
+        if (!find_element(identifier))
+        {
+            if (!active_window_id.empty())
+            {
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == active_window_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Slider>(identifier, window, active_group.second, text, position, size, range, FUI_Slider::type::INT));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Slider>(identifier, window, text, position, size, range, FUI_Slider::type::INT));
 
-        // title text
-        auto title_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(text))* text_scale;
-        auto text_pos = olc::vf2d{ absolute_position.x + (size.x / 2) - (title_size.x / 2) , absolute_position.y + 1 };
-        pge->DrawStringPropDecal(text_pos, text, text_color, text_scale);
-        pge->FillRectDecal({ absolute_position.x, absolute_position.y + title_size.y }, { size.x, 1 }, color_scheme.console_outline);
+                        adopt(elements.back().get());
+                        return FUI_SliderHandle<int>(std::static_pointer_cast<FUI_Slider>(elements.back()));
+                    }
+                }
+            }
+            else
+            {
+                if (!active_group.second.empty())
+                    elements.emplace_back(std::make_shared<FUI_Slider>(identifier, active_group.second, text, position, size, range, FUI_Slider::type::INT));
+                else
+                    elements.emplace_back(std::make_shared<FUI_Slider>(identifier, text, position, size, range, FUI_Slider::type::INT));
 
-        if (run_once)
-        {
-            scroll_threshold = size.y - 1 - input_thickness - title_size.y;
-            run_once = false;
+                adopt(elements.back().get());
+                return FUI_SliderHandle<int>(std::static_pointer_cast<FUI_Slider>(elements.back()));
+            }
         }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_slider, slider_id affected: " + identifier + ")\n";
 
-        if (should_clear_console)
-        {
-            executed_commands.clear();
-            scroll_index = 0;
-            should_clear_console = false;
-        }
+        return {};
+    }
 
-        // console text
-        int j = 0;
-        commands_shown = 1;
-        last_pos = 0.f;
-        for (int i = scroll_index; i < executed_commands.size(); i++)
+    FUI_ButtonHandle FrostUI::add_button(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, std::function<void()> callback)
+    {
+        if (!find_element(identifier))
         {
-            auto text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(executed_commands[i])) * text_scale;
-            float pos = 0.f;
-            if (j < 1)
-                pos = absolute_position.y + title_size.y + 2 + (text_size.y * j);
-            if (title_size.y + last_pos <= scroll_threshold)
+            if (windows.size() > 0)
             {
-                if (j >= 1)
-                    pge->DrawStringPropDecal({ absolute_position.x, last_pos }, executed_commands[i], text_color, text_scale);
-                else
-                    pge->DrawStringPropDecal({ absolute_position.x, pos }, executed_commands[i], text_color, text_scale);
-                commands_shown++;
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == parent_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Button>(identifier, window, active_group.second, text, position, size, callback));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Button>(identifier, window, text, position, size, callback));
+
+                        adopt(elements.back().get());
+                        return FUI_ButtonHandle(std::static_pointer_cast<FUI_Button>(elements.back()));
+                    }
+                }
+                std::cout << "Could not find parent window ID (function affected: add_button, button_id affected: " + identifier + ")\n";
             }
-            if (j < 1)
-                last_pos = pos + text_size.y;
             else
-                last_pos += text_size.y;
-            j++;
+                std::cout << "There's no windows to be used as parent (function affected: add_button, button_id affected: " + identifier + ")\n";
         }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_button, button_id affected: " + identifier + ")\n";
 
-        inputfield.draw(pge);
+        return {};
     }
 
-    void FUI_Console::input(olc::PixelGameEngine* pge)
+    FUI_ButtonHandle FrostUI::add_button(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, std::function<void()> callback)
     {
-        if (inputfield.get_focused_status() || !command_entry.empty())
+        if (!find_element(identifier))
         {
-            // instantly jump to the top or bottom
-            if (pge->GetKey(olc::CTRL).bHeld && pge->GetKey(olc::UP).bPressed)
-                scroll_index = 0;
-            else if (pge->GetKey(olc::CTRL).bHeld && pge->GetKey(olc::DOWN).bPressed)
-                scroll_index = (executed_commands.size() - commands_shown) + 1;
-
-            if (pge->GetKey(olc::ENTER).bPressed || !command_entry.empty())
+            if (!active_window_id.empty())
             {
-                command = inputfield.get_inputfield_value();
-                if (!command_entry.empty())
-                    command = command_entry;
-                if (!command.empty())
+                for (auto& window : windows)
                 {
-                    std::string display_text;
-                    if (command_entry.empty())
-                    {
-                        command_handler(command, &executed_command);
-                        display_text = get_time() + " - " + executed_command;
-                    }
-                    else
-                        display_text = get_time() + " - " + command;
-                    auto text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(display_text)) * text_scale;
-                    auto size_to_remove = 0.f;
-                    std::string holder = display_text;
-                    std::vector<std::string> text_parts;
-                    while (text_size.x > size.x)
+                    if (window->get_id() == active_window_id)
                     {
-                        size_to_remove = text_size.x - size.x;
-                        size_to_remove = size_to_remove / text_size.x;
-                        int mod_size = std::ceil(size_to_remove * holder.size());
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Button>(identifier, window, active_group.second, text, position, size, callback));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Button>(identifier, window, text, position, size, callback));
 
-                        text_parts.push_back(std::string(holder.begin(), holder.end() - mod_size));
-                        holder.erase(holder.begin(), holder.end() - mod_size);
-                        text_size = static_cast<olc::vf2d>(pge->GetTextSizeProp(holder)) * text_scale;
-                    }
-                    if (text_parts.size() > 0)
-                    {
-                        if (holder != display_text)
-                            text_parts.push_back(holder);
-                        display_text.clear();
-                        for (int i = 0; i < text_parts.size(); i++)
-                        {
-                            if (i == 0)
-                                display_text = text_parts[i] + "\n ";
-                            else if (i == text_parts.size() - 1)
-                                display_text += text_parts[i];
-                            else
-                                display_text += text_parts[i] + "\n ";
-                        }
+                        adopt(elements.back().get());
+                        return FUI_ButtonHandle(std::static_pointer_cast<FUI_Button>(elements.back()));
                     }
-                    executed_commands.push_back(display_text);
-
-                    auto title_size = pge->GetTextSizeProp(text) * text_scale;
-
-                    if (scroll_threshold > 0 && last_pos + text_size.y >= scroll_threshold)
-                        scroll_index++;
-
-                    //std::cout << "index: " << scroll_index << std::endl;
-
+                }
+            }
+            else
+            {
+                if (!active_group.second.empty())
+                    elements.emplace_back(std::make_shared<FUI_Button>(identifier, active_group.second, text, position, size, callback));
+                else
+                    elements.emplace_back(std::make_shared<FUI_Button>(identifier, text, position, size, callback));
 
-                    if (scroll_index > 0 && scroll_index < (executed_commands.size() - commands_shown) + 1 && last_pos + text_size.y >= scroll_threshold)
-                        scroll_index = (executed_commands.size() - commands_shown) + 1;
+                adopt(elements.back().get());
+                return FUI_ButtonHandle(std::static_pointer_cast<FUI_Button>(elements.back()));
+            }
+        }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_button, button_id affected: " + identifier + ")\n";
 
-                    //unsure why I added this line here, if I figure it out back in it goes :)
-                    //if (title_size.y + (text_size.y * executed_commands.size()) >= scroll_threshold)
-                    //   scroll_index++;
+        return {};
+    }
 
-                    if (!command_entry.empty())
-                        command_entry.clear();
-                    else
+    FUI_InputfieldHandle FrostUI::add_inputfield(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    {
+        if (!find_element(identifier))
+        {
+            if (windows.size() > 0)
+            {
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == parent_id)
                     {
-                        inputfield.clear_inputfield_value();
-                        if (last_executed_commands.size() < 1)
-                            last_executed_commands.push_back(command);
-                        else if (command != last_executed_commands.back())
-                            last_executed_commands.push_back(command);
-                    }
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Inputfield>(identifier, window, active_group.second, text, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Inputfield>(identifier, window, text, position, size));
 
-                    command_index = 0;
+                        adopt(elements.back().get());
+                        return FUI_InputfieldHandle(std::static_pointer_cast<FUI_Inputfield>(elements.back()));
+                    }
                 }
+                std::cout << "Could not find parent window ID (function affected: add_inputfield, inputfield_id affected: " + identifier + ")\n";
             }
+            else
+                std::cout << "There's no windows to be used as parent (function affected: add_inputfield, inputfield_id affected: " + identifier + ")\n";
+        }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_inputfield, inputfield_id affected: " + identifier + ")\n";
 
-            if (last_executed_commands.size() > 0 && pge->GetKey(olc::UP).bPressed && !(pge->GetKey(olc::CTRL).bHeld || pge->GetKey(olc::SHIFT).bHeld)
-                && command_index <= last_executed_commands.size() - 1)
+        return {};
+    }
+
+    FUI_InputfieldHandle FrostUI::add_inputfield(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    {
+        if (!find_element(identifier))
+        {
+            if (!active_window_id.empty())
             {
-                command_index++;
-                inputfield.set_inputfield_value(last_executed_commands[last_executed_commands.size() - command_index]);
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == active_window_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Inputfield>(identifier, window, active_group.second, text, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Inputfield>(identifier, window, text, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_InputfieldHandle(std::static_pointer_cast<FUI_Inputfield>(elements.back()));
+                    }
+                }
             }
-            if (last_executed_commands.size() > 0 && pge->GetKey(olc::DOWN).bPressed && !(pge->GetKey(olc::CTRL).bHeld || pge->GetKey(olc::SHIFT).bHeld)
-                && command_index >= 1)
+            else
             {
-                command_index--;
-                if (command_index == 0)
-                    inputfield.clear_inputfield_value();
+                if (!active_group.second.empty())
+                    elements.emplace_back(std::make_shared<FUI_Inputfield>(identifier, active_group.second, text, position, size));
                 else
-                    inputfield.set_inputfield_value(last_executed_commands[last_executed_commands.size() - command_index]);
+                    elements.emplace_back(std::make_shared<FUI_Inputfield>(identifier, text, position, size));
+
+                adopt(elements.back().get());
+                return FUI_InputfieldHandle(std::static_pointer_cast<FUI_Inputfield>(elements.back()));
             }
         }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_inputfield, inputfield_id affected: " + identifier + ")\n";
+
+        return {};
+    }
 
-        if (pge->GetMousePos().x >= absolute_position.x &&
-            pge->GetMousePos().x <= absolute_position.x + size.x &&
-            pge->GetMousePos().y >= absolute_position.y &&
-            pge->GetMousePos().y <= absolute_position.y + size.y)
+    FUI_ConsoleHandle FrostUI::add_console(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, int inputfield_thickness)
+    {
+        if (!find_element(identifier))
         {
-            if (pge->GetMouseWheel() > 0)
-            {
-                if (scroll_index > 0)
-                    scroll_index--;
-            }
-            else if (pge->GetMouseWheel() < 0)
+            if (windows.size() > 0)
             {
-                if (scroll_index < executed_commands.size() - 1)
-                    scroll_index++;
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == parent_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Console>(identifier, window, active_group.second, text, position, size, inputfield_thickness));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Console>(identifier, window, text, position, size, inputfield_thickness));
+
+                        adopt(elements.back().get());
+                        return FUI_ConsoleHandle(std::static_pointer_cast<FUI_Console>(elements.back()));
+                    }
+                }
+                std::cout << "Could not find parent window ID (function affected: add_console, console_id affected: " + identifier + ")\n";
             }
+            else
+                std::cout << "There's no windows to be used as parent (function affected: add_console, console_id affected: " + identifier + ")\n";
         }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_console, console_id affected: " + identifier + ")\n";
 
-        inputfield.input(pge);
+        return {};
     }
 
-    /*
-    ####################################################
-    #               FUI_HANDLER START                  #
-    ####################################################
-    */
-    bool FrostUI::is_a_window_focused()
+    FUI_ConsoleHandle FrostUI::add_console(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, int inputfield_thickness)
     {
-        for (auto& window : windows)
+        if (!find_element(identifier))
         {
-            if (window->get_closed_state())
-                continue;
-            if (window->is_focused())
-                return true;
+            if (!active_window_id.empty())
+            {
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == active_window_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Console>(identifier, window, active_group.second, text, position, size, inputfield_thickness));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Console>(identifier, window, text, position, size, inputfield_thickness));
+
+                        adopt(elements.back().get());
+                        return FUI_ConsoleHandle(std::static_pointer_cast<FUI_Console>(elements.back()));
+                    }
+                }
+            }
+            else
+            {
+                if (!active_group.second.empty())
+                    elements.emplace_back(std::make_shared<FUI_Console>(identifier, active_group.second, text, position, size, inputfield_thickness));
+                else
+                    elements.emplace_back(std::make_shared<FUI_Console>(identifier, text, position, size, inputfield_thickness));
+
+                adopt(elements.back().get());
+                return FUI_ConsoleHandle(std::static_pointer_cast<FUI_Console>(elements.back()));
+            }
         }
-        return false;
+        else
+            std::cout << "Duplicate IDs found (function affected: add_inputfield, inputfield_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    bool FrostUI::disable_window_input_if_open_dropdown(int window_index)
+    FUI_ScrollViewHandle FrostUI::add_scrollview(const std::string& parent_id, const std::string& identifier, olc::vi2d position, olc::vi2d size)
     {
-        for (auto element : elements)
+        if (!find_element(identifier))
         {
-            if (!element->get_parent() || windows[window_index]->get_id() != element->get_parent()->get_id())
-                continue;
-            if (element->get_ui_type() == FUI_Type::DROPDOWN || element->get_ui_type() == FUI_Type::COMBOLIST)
+            if (windows.size() > 0)
             {
-                auto adaptive = element->get_absolute_position();
-                auto size = element->get_size();
-                auto position = element->get_position();
-                auto amount = element->get_elements_amount();
-                if (element->get_focused_status() && (pge->GetMousePos().x >= adaptive.x + position.x &&
-                    pge->GetMousePos().x <= adaptive.x + position.x + size.x &&
-                    pge->GetMousePos().y >= adaptive.y + position.y &&
-                    pge->GetMousePos().y <= adaptive.y + position.y + (size.y * amount) + size.y))
-                    return true;
-            }
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == parent_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_ScrollView>(identifier, window, active_group.second, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_ScrollView>(identifier, window, position, size));
 
+                        adopt(elements.back().get());
+                        return FUI_ScrollViewHandle(std::static_pointer_cast<FUI_ScrollView>(elements.back()));
+                    }
+                }
+                std::cout << "Could not find parent window ID (function affected: add_scrollview, scrollview_id affected: " + identifier + ")\n";
+            }
+            else
+                std::cout << "There's no windows to be used as parent (function affected: add_scrollview, scrollview_id affected: " + identifier + ")\n";
         }
-        return false;
+        else
+            std::cout << "Duplicate IDs found (function affected: add_scrollview, scrollview_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    void FrostUI::cycle_inputfield()
+    FUI_ScrollViewHandle FrostUI::add_scrollview(const std::string& identifier, olc::vi2d position, olc::vi2d size)
     {
-        if (pge->GetKey(olc::TAB).bPressed)
+        if (!find_element(identifier))
         {
-            int i = 0;
-            int j = 0;
-            bool input_was_focused = false;
-            for (auto& element : elements)
+            if (!active_window_id.empty())
             {
-                if (element->get_focused_status() && element->get_ui_type() == FUI_Type::INPUTFIELD)
+                for (auto& window : windows)
                 {
-                    element->set_focused_status(false);
-                    input_was_focused = true;
-                    break;
+                    if (window->get_id() == active_window_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_ScrollView>(identifier, window, active_group.second, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_ScrollView>(identifier, window, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_ScrollViewHandle(std::static_pointer_cast<FUI_ScrollView>(elements.back()));
+                    }
                 }
-                i++;
             }
-            for (auto& element : elements)
+            else
             {
-                if (element->get_ui_type() == FUI_Type::INPUTFIELD && j > i&& input_was_focused)
-                {
-                    element->set_focused_status(true);
-                    break;
-                }
-                j++;
+                if (!active_group.second.empty())
+                    elements.emplace_back(std::make_shared<FUI_ScrollView>(identifier, active_group.second, position, size));
+                else
+                    elements.emplace_back(std::make_shared<FUI_ScrollView>(identifier, position, size));
+
+                adopt(elements.back().get());
+                return FUI_ScrollViewHandle(std::static_pointer_cast<FUI_ScrollView>(elements.back()));
             }
         }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_scrollview, scrollview_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    bool FrostUI::is_cursor_in_window()
+    void FrostUI::add_to_scrollview(const std::string& scrollview_id, const std::string& element_id)
     {
-        for (auto& window : windows)
+        auto scrollview = find_element(scrollview_id);
+        auto element = find_element(element_id);
+        if (!scrollview || scrollview->get_ui_type() != FUI_Type::SCROLLVIEW)
+            std::cout << "Could not find scrollview ID (function affected: add_to_scrollview, scrollview_id affected: " + scrollview_id + ")\n";
+        else if (!element)
+            std::cout << "Could not find element ID (function affected: add_to_scrollview, element_id affected: " + element_id + ")\n";
+        else if (element->encloses(scrollview.get()))
+            std::cout << "Tried to nest an element inside itself (function affected: add_to_scrollview, element_id affected: " + element_id + ")\n";
+        else
         {
-            if (window->get_closed_state())
-                continue;
-            auto pos = window->get_position();
-            auto size = window->get_size();
-            if (pge->GetMousePos().x > pos.x&& pge->GetMousePos().x <= pos.x + size.x)
-                if (pge->GetMousePos().y > pos.y&& pge->GetMousePos().y <= pos.y + size.y)
-                    return true;
+            if (element->get_container())
+                element->get_container()->remove_child(element.get());
+            std::static_pointer_cast<FUI_ScrollView>(scrollview)->add_child(element);
+            structure_version++;
         }
-        return false;
     }
 
-    void FrostUI::push_focused_to_back()
+    FUI_TableHandle FrostUI::add_table(const std::string& parent_id, const std::string& identifier, olc::vi2d position, olc::vi2d size)
     {
-        int i = 0;
-        for (auto& window : windows)
+        if (!find_element(identifier))
         {
-            if (window->get_closed_state())
-            {
-                i++;
-                continue;
-            }
-            if (window->is_focused())
+            if (windows.size() > 0)
             {
-                windows.emplace_back(window);
-                windows.erase(windows.begin() + i);
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == parent_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Table>(identifier, window, active_group.second, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Table>(identifier, window, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_TableHandle(std::static_pointer_cast<FUI_Table>(elements.back()));
+                    }
+                }
+                std::cout << "Could not find parent window ID (function affected: add_table, table_id affected: " + identifier + ")\n";
             }
-            i++;
+            else
+                std::cout << "There's no windows to be used as parent (function affected: add_table, table_id affected: " + identifier + ")\n";
         }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_table, table_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    void FrostUI::push_focused_element_to_back()
+    FUI_TableHandle FrostUI::add_table(const std::string& identifier, olc::vi2d position, olc::vi2d size)
     {
-        int i = 0;
-        for (auto& element : elements)
+        if (!find_element(identifier))
         {
-            if (element->get_focused_status())
+            if (!active_window_id.empty())
             {
-                elements.emplace_back(element);
-                elements.erase(elements.begin() + i);
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == active_window_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Table>(identifier, window, active_group.second, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Table>(identifier, window, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_TableHandle(std::static_pointer_cast<FUI_Table>(elements.back()));
+                    }
+                }
+            }
+            else
+            {
+                if (!active_group.second.empty())
+                    elements.emplace_back(std::make_shared<FUI_Table>(identifier, active_group.second, position, size));
+                else
+                    elements.emplace_back(std::make_shared<FUI_Table>(identifier, position, size));
+
+                adopt(elements.back().get());
+                return FUI_TableHandle(std::static_pointer_cast<FUI_Table>(elements.back()));
             }
-            i++;
         }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_table, table_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    void FrostUI::set_active_window(const std::string& window_id)
+    FUI_TreeViewHandle FrostUI::add_treeview(const std::string& parent_id, const std::string& identifier, olc::vi2d position, olc::vi2d size)
     {
-        for (auto& window : windows)
+        if (!find_element(identifier))
         {
-            if (window->get_id() == window_id)
+            if (windows.size() > 0)
             {
-                active_window_id = window_id;
-                break;
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == parent_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_TreeView>(identifier, window, active_group.second, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_TreeView>(identifier, window, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_TreeViewHandle(std::static_pointer_cast<FUI_TreeView>(elements.back()));
+                    }
+                }
+                std::cout << "Could not find parent window ID (function affected: add_treeview, treeview_id affected: " + identifier + ")\n";
             }
             else
-                active_window_id.clear();
+                std::cout << "There's no windows to be used as parent (function affected: add_treeview, treeview_id affected: " + identifier + ")\n";
         }
-        if (active_window_id.empty())
-            std::cout << "Could not find the window ID in added windows (function affected: set_active_window, affected window_id: " + window_id + ")\n";
+        else
+            std::cout << "Duplicate IDs found (function affected: add_treeview, treeview_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    void FrostUI::set_active_group(const std::string& g)
+    FUI_TreeViewHandle FrostUI::add_treeview(const std::string& identifier, olc::vi2d position, olc::vi2d size)
     {
-        for (auto group : groups)
+        if (!find_element(identifier))
         {
-            if (group.second == g)
+            if (!active_window_id.empty())
             {
-                active_group.first = group.first;
-                active_group.second = group.second;
-                break;
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == active_window_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_TreeView>(identifier, window, active_group.second, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_TreeView>(identifier, window, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_TreeViewHandle(std::static_pointer_cast<FUI_TreeView>(elements.back()));
+                    }
+                }
             }
             else
             {
-                active_group.first.clear();
-                active_group.second.clear();
+                if (!active_group.second.empty())
+                    elements.emplace_back(std::make_shared<FUI_TreeView>(identifier, active_group.second, position, size));
+                else
+                    elements.emplace_back(std::make_shared<FUI_TreeView>(identifier, position, size));
+
+                adopt(elements.back().get());
+                return FUI_TreeViewHandle(std::static_pointer_cast<FUI_TreeView>(elements.back()));
             }
         }
-        if (active_group.first.empty() && active_group.second.empty())
-            std::cout << "Could not find the group ID in added windows (function affected: set_active_group, affected window_id: " + g + ")\n";
+        else
+            std::cout << "Duplicate IDs found (function affected: add_treeview, treeview_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    FUI_Window* FrostUI::create_window(const std::string& identifier, const std::string& title, olc::vi2d position, olc::vi2d size)
+    FUI_PlotHandle FrostUI::add_plot(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
     {
-        bool is_duplicate = false;
-        FUI_Window* temp_window = nullptr;
-        for (auto& window : windows)
-        {
-            if (window->get_id() == identifier)
-                is_duplicate = true;
-        }
-        if (!is_duplicate)
+        if (!find_element(identifier))
         {
-            windows.emplace_back(new FUI_Window{ pge, identifier, position, size, title });
-            temp_window = windows.back();
+            if (windows.size() > 0)
+            {
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == parent_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Plot>(identifier, window, active_group.second, text, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Plot>(identifier, window, text, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_PlotHandle(std::static_pointer_cast<FUI_Plot>(elements.back()));
+                    }
+                }
+                std::cout << "Could not find parent window ID (function affected: add_plot, plot_id affected: " + identifier + ")\n";
+            }
+            else
+                std::cout << "There's no windows to be used as parent (function affected: add_plot, plot_id affected: " + identifier + ")\n";
         }
         else
-            std::cout << "Cannot add duplicates of same window (function affected: create_window, affected window_id: " + identifier + ")\n";
-
-        if (windows.size() == 1)
-            windows.back()->set_focused(true);
+            std::cout << "Duplicate IDs found (function affected: add_plot, plot_id affected: " + identifier + ")\n";
 
-        return temp_window;
+        return {};
     }
 
-    void FrostUI::add_group(const std::string& window_id, const std::string& group_id)
+    FUI_PlotHandle FrostUI::add_plot(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
     {
-        bool is_duplicate = false;
-        for (auto group : groups)
+        if (!find_element(identifier))
         {
-            if (group.second == group_id)
-                is_duplicate = true;
+            if (!active_window_id.empty())
+            {
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == active_window_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Plot>(identifier, window, active_group.second, text, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Plot>(identifier, window, text, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_PlotHandle(std::static_pointer_cast<FUI_Plot>(elements.back()));
+                    }
+                }
+            }
+            else
+            {
+                if (!active_group.second.empty())
+                    elements.emplace_back(std::make_shared<FUI_Plot>(identifier, active_group.second, text, position, size));
+                else
+                    elements.emplace_back(std::make_shared<FUI_Plot>(identifier, text, position, size));
+
+                adopt(elements.back().get());
+                return FUI_PlotHandle(std::static_pointer_cast<FUI_Plot>(elements.back()));
+            }
         }
-        if (!is_duplicate)
-            groups.emplace_back(std::make_pair(window_id, group_id));
         else
-            std::cout << "Cannot add duplicates of same group (function affected: add_group, affected group_id: " + group_id + ")\n";
-    }
+            std::cout << "Duplicate IDs found (function affected: add_plot, plot_id affected: " + identifier + ")\n";
 
-    void FrostUI::clear_active_window()
-    {
-        active_window_id.clear();
+        return {};
     }
 
-    void FrostUI::clear_active_group()
+    FUI_CanvasHandle FrostUI::add_canvas(const std::string& parent_id, const std::string& identifier, olc::vi2d position, olc::vi2d size)
     {
-        active_group.first.clear();
-        active_group.second.clear();
-    }
+        if (!find_element(identifier))
+        {
+            if (windows.size() > 0)
+            {
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == parent_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Canvas>(identifier, window, active_group.second, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Canvas>(identifier, window, position, size));
 
-    const std::string& FrostUI::get_active_group()
-    {
-        return active_group.second;
+                        adopt(elements.back().get());
+                        return FUI_CanvasHandle(std::static_pointer_cast<FUI_Canvas>(elements.back()));
+                    }
+                }
+                std::cout << "Could not find parent window ID (function affected: add_canvas, canvas_id affected: " + identifier + ")\n";
+            }
+            else
+                std::cout << "There's no windows to be used as parent (function affected: add_canvas, canvas_id affected: " + identifier + ")\n";
+        }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_canvas, canvas_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    FUI_Window* FrostUI::find_window(const std::string& identifier)
+    FUI_CanvasHandle FrostUI::add_canvas(const std::string& identifier, olc::vi2d position, olc::vi2d size)
     {
-        for (auto& window : windows)
+        if (!find_element(identifier))
         {
-            if (window->get_id() == identifier)
-                return window;
+            if (!active_window_id.empty())
+            {
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == active_window_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_Canvas>(identifier, window, active_group.second, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_Canvas>(identifier, window, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_CanvasHandle(std::static_pointer_cast<FUI_Canvas>(elements.back()));
+                    }
+                }
+            }
+            else
+            {
+                if (!active_group.second.empty())
+                    elements.emplace_back(std::make_shared<FUI_Canvas>(identifier, active_group.second, position, size));
+                else
+                    elements.emplace_back(std::make_shared<FUI_Canvas>(identifier, position, size));
+
+                adopt(elements.back().get());
+                return FUI_CanvasHandle(std::static_pointer_cast<FUI_Canvas>(elements.back()));
+            }
         }
-        std::cout << "Could not find the window ID in added windows (function affected: find_window, affected window_id: " + identifier + ")\n";
-        return nullptr;
-    }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_canvas, canvas_id affected: " + identifier + ")\n";
 
-    int FrostUI::get_element_amount() { return elements.size(); }
+        return {};
+    }
 
-    void FrostUI::remove_element(const std::string& id)
+    FUI_FileViewHandle FrostUI::add_fileview(const std::string& parent_id, const std::string& identifier, olc::vi2d position, olc::vi2d size)
     {
-        int i = 0;
-        for (auto& element : elements)
+        if (!find_element(identifier))
         {
-            if (element->get_identifier() == id)
+            if (windows.size() > 0)
             {
-                elements.erase(elements.begin() + i);
-                break;
+                for (auto& window : windows)
+                {
+                    if (window->get_id() == parent_id)
+                    {
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_FileView>(identifier, window, active_group.second, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_FileView>(identifier, window, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_FileViewHandle(std::static_pointer_cast<FUI_FileView>(elements.back()));
+                    }
+                }
+                std::cout << "Could not find parent window ID (function affected: add_fileview, fileview_id affected: " + identifier + ")\n";
             }
-            i++;
+            else
+                std::cout << "There's no windows to be used as parent (function affected: add_fileview, fileview_id affected: " + identifier + ")\n";
         }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_fileview, fileview_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    void FrostUI::remove_window(const std::string& id)
+    FUI_FileViewHandle FrostUI::add_fileview(const std::string& identifier, olc::vi2d position, olc::vi2d size)
     {
-        int i = 0;
-        for (auto& window : windows)
+        if (!find_element(identifier))
         {
-            if (window->get_id() == id)
+            if (!active_window_id.empty())
             {
-                int j = 0;
-                for (auto& element : elements)
+                for (auto& window : windows)
                 {
-                    if (!element->get_parent())
-                    {
-                        j++;
-                        continue;
-                    }
-                    if (element->get_parent()->get_id() == id)
+                    if (window->get_id() == active_window_id)
                     {
-                        elements.erase(elements.begin() + j);
-                        break;
+                        if (!active_group.second.empty())
+                            elements.emplace_back(std::make_shared<FUI_FileView>(identifier, window, active_group.second, position, size));
+                        else
+                            elements.emplace_back(std::make_shared<FUI_FileView>(identifier, window, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_FileViewHandle(std::static_pointer_cast<FUI_FileView>(elements.back()));
                     }
-                    j++;
                 }
-                windows.erase(windows.begin() + i);
-                break;
             }
-            i++;
-        }
-    }
+            else
+            {
+                if (!active_group.second.empty())
+                    elements.emplace_back(std::make_shared<FUI_FileView>(identifier, active_group.second, position, size));
+                else
+                    elements.emplace_back(std::make_shared<FUI_FileView>(identifier, position, size));
 
-    std::shared_ptr<FUI_Element> FrostUI::find_element(const std::string& id)
-    {
-        for (auto& element : elements)
-        {
-            if (element->get_identifier() == id)
-                return element;
+                adopt(elements.back().get());
+                return FUI_FileViewHandle(std::static_pointer_cast<FUI_FileView>(elements.back()));
+            }
         }
-        return nullptr;
-    }
+        else
+            std::cout << "Duplicate IDs found (function affected: add_fileview, fileview_id affected: " + identifier + ")\n";
 
-    std::shared_ptr<FUI_Element> FrostUI::find_groupbox(const std::string& id)
-    {
-        for (auto& element : groupboxes)
-        {
-            if (element->get_identifier() == id)
-                return element;
-        }
-        return nullptr;
+        return {};
     }
 
-    void FrostUI::add_label(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position)
+    FUI_LogTailHandle FrostUI::add_logtail(const std::string& parent_id, const std::string& identifier, olc::vi2d position, olc::vi2d size)
     {
         if (!find_element(identifier))
         {
             if (windows.size() > 0)
             {
-                bool did_add = false;
                 for (auto& window : windows)
                 {
                     if (window->get_id() == parent_id)
                     {
-                        did_add = true;
                         if (!active_group.second.empty())
-                            elements.emplace_back(std::make_shared<FUI_Label>(identifier, window, text, position));
+                            elements.emplace_back(std::make_shared<FUI_LogTail>(identifier, window, active_group.second, position, size));
                         else
-                            elements.emplace_back(std::make_shared<FUI_Label>(identifier, window, active_group.second, text, position));
+                            elements.emplace_back(std::make_shared<FUI_LogTail>(identifier, window, position, size));
 
-                        break;
+                        adopt(elements.back().get());
+                        return FUI_LogTailHandle(std::static_pointer_cast<FUI_LogTail>(elements.back()));
                     }
                 }
-                if (!did_add)
-                    std::cout << "Could not find parent window ID (function affected: add_label, label_id affected: " + identifier + ")\n";
+                std::cout << "Could not find parent window ID (function affected: add_logtail, logtail_id affected: " + identifier + ")\n";
             }
             else
-                std::cout << "There's no windows to be used as parent (function affected: add_label, label_id affected: " + identifier + ")\n";
+                std::cout << "There's no windows to be used as parent (function affected: add_logtail, logtail_id affected: " + identifier + ")\n";
         }
         else
-            std::cout << "Duplicate IDs found (function affected: add_label, label_id affected: " + identifier + ")\n";
+            std::cout << "Duplicate IDs found (function affected: add_logtail, logtail_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    void FrostUI::add_label(const std::string& identifier, const std::string& text, olc::vi2d position)
+    FUI_LogTailHandle FrostUI::add_logtail(const std::string& identifier, olc::vi2d position, olc::vi2d size)
     {
         if (!find_element(identifier))
         {
@@ -3607,53 +12129,65 @@ namespace olc
                 for (auto& window : windows)
                 {
                     if (window->get_id() == active_window_id)
+                    {
                         if (!active_group.second.empty())
-                            elements.emplace_back(std::make_shared<FUI_Label>(identifier, window, active_group.second, text, position));
+                            elements.emplace_back(std::make_shared<FUI_LogTail>(identifier, window, active_group.second, position, size));
                         else
-                            elements.emplace_back(std::make_shared<FUI_Label>(identifier, window, text, position));
+                            elements.emplace_back(std::make_shared<FUI_LogTail>(identifier, window, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_LogTailHandle(std::static_pointer_cast<FUI_LogTail>(elements.back()));
+                    }
                 }
             }
             else
+            {
                 if (!active_group.second.empty())
-                    elements.emplace_back(std::make_shared<FUI_Label>(identifier, active_group.second, text, position));
+                    elements.emplace_back(std::make_shared<FUI_LogTail>(identifier, active_group.second, position, size));
                 else
-                    elements.emplace_back(std::make_shared<FUI_Label>(identifier, text, position));
+                    elements.emplace_back(std::make_shared<FUI_LogTail>(identifier, position, size));
+
+                adopt(elements.back().get());
+                return FUI_LogTailHandle(std::static_pointer_cast<FUI_LogTail>(elements.back()));
+            }
         }
         else
-            std::cout << "Duplicate IDs found (function affected: add_label, label_id affected: " + identifier + ")\n";
+            std::cout << "Duplicate IDs found (function affected: add_logtail, logtail_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    void FrostUI::add_checkbox(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    FUI_TimelineHandle FrostUI::add_timeline(const std::string& parent_id, const std::string& identifier, olc::vi2d position, olc::vi2d size)
     {
         if (!find_element(identifier))
         {
             if (windows.size() > 0)
             {
-                bool did_add = false;
                 for (auto& window : windows)
                 {
                     if (window->get_id() == parent_id)
                     {
-                        did_add = true;
                         if (!active_group.second.empty())
-                            elements.emplace_back(std::make_shared<FUI_Checkbox>(identifier, window, text, position, size));
+                            elements.emplace_back(std::make_shared<FUI_Timeline>(identifier, window, active_group.second, position, size));
                         else
-                            elements.emplace_back(std::make_shared<FUI_Checkbox>(identifier, window, active_group.second, text, position, size));
+                            elements.emplace_back(std::make_shared<FUI_Timeline>(identifier, window, position, size));
 
-                        break;
+                        adopt(elements.back().get());
+                        return FUI_TimelineHandle(std::static_pointer_cast<FUI_Timeline>(elements.back()));
                     }
                 }
-                if (!did_add)
-                    std::cout << "Could not find parent window ID (function affected: add_checkbox, checkbox_id affected: " + identifier + ")\n";
+                std::cout << "Could not find parent window ID (function affected: add_timeline, timeline_id affected: " + identifier + ")\n";
             }
             else
-                std::cout << "There's no windows to be used as parent (function affected: add_checkbox, checkbox_id affected: " + identifier + ")\n";
+                std::cout << "There's no windows to be used as parent (function affected: add_timeline, timeline_id affected: " + identifier + ")\n";
         }
         else
-            std::cout << "Duplicate IDs found (function affected: add_checkbox, checkbox_id affected: " + identifier + ")\n";
+            std::cout << "Duplicate IDs found (function affected: add_timeline, timeline_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    void FrostUI::add_checkbox(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    FUI_TimelineHandle FrostUI::add_timeline(const std::string& identifier, olc::vi2d position, olc::vi2d size)
     {
         if (!find_element(identifier))
         {
@@ -3662,53 +12196,65 @@ namespace olc
                 for (auto& window : windows)
                 {
                     if (window->get_id() == active_window_id)
+                    {
                         if (!active_group.second.empty())
-                            elements.emplace_back(std::make_shared<FUI_Checkbox>(identifier, window, active_group.second, text, position, size));
+                            elements.emplace_back(std::make_shared<FUI_Timeline>(identifier, window, active_group.second, position, size));
                         else
-                            elements.emplace_back(std::make_shared<FUI_Checkbox>(identifier, window, text, position, size));
+                            elements.emplace_back(std::make_shared<FUI_Timeline>(identifier, window, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_TimelineHandle(std::static_pointer_cast<FUI_Timeline>(elements.back()));
+                    }
                 }
             }
             else
+            {
                 if (!active_group.second.empty())
-                    elements.emplace_back(std::make_shared<FUI_Checkbox>(identifier, active_group.second, text, position, size));
+                    elements.emplace_back(std::make_shared<FUI_Timeline>(identifier, active_group.second, position, size));
                 else
-                    elements.emplace_back(std::make_shared<FUI_Checkbox>(identifier, text, position, size));
+                    elements.emplace_back(std::make_shared<FUI_Timeline>(identifier, position, size));
+
+                adopt(elements.back().get());
+                return FUI_TimelineHandle(std::static_pointer_cast<FUI_Timeline>(elements.back()));
+            }
         }
         else
-            std::cout << "Duplicate IDs found (function affected: add_checkbox, checkbox_id affected: " + identifier + ")\n";
+            std::cout << "Duplicate IDs found (function affected: add_timeline, timeline_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    void FrostUI::add_dropdown(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    FUI_NodeGraphHandle FrostUI::add_nodegraph(const std::string& parent_id, const std::string& identifier, olc::vi2d position, olc::vi2d size)
     {
         if (!find_element(identifier))
         {
             if (windows.size() > 0)
             {
-                bool did_add = false;
                 for (auto& window : windows)
                 {
                     if (window->get_id() == parent_id)
                     {
-                        did_add = true;
                         if (!active_group.second.empty())
-                            elements.emplace_back(std::make_shared<FUI_Dropdown>(identifier, window, text, position, size));
+                            elements.emplace_back(std::make_shared<FUI_NodeGraph>(identifier, window, active_group.second, position, size));
                         else
-                            elements.emplace_back(std::make_shared<FUI_Dropdown>(identifier, window, active_group.second, text, position, size));
+                            elements.emplace_back(std::make_shared<FUI_NodeGraph>(identifier, window, position, size));
 
-                        break;
+                        adopt(elements.back().get());
+                        return FUI_NodeGraphHandle(std::static_pointer_cast<FUI_NodeGraph>(elements.back()));
                     }
                 }
-                if (!did_add)
-                    std::cout << "Could not find parent window ID (function affected: add_dropdown, dropdown_id affected: " + identifier + ")\n";
+                std::cout << "Could not find parent window ID (function affected: add_nodegraph, nodegraph_id affected: " + identifier + ")\n";
             }
             else
-                std::cout << "There's no windows to be used as parent (function affected: add_dropdown, dropdown_id affected: " + identifier + ")\n";
+                std::cout << "There's no windows to be used as parent (function affected: add_nodegraph, nodegraph_id affected: " + identifier + ")\n";
         }
         else
-            std::cout << "Duplicate IDs found (function affected: add_dropdown, dropdown_id affected: " + identifier + ")\n";
+            std::cout << "Duplicate IDs found (function affected: add_nodegraph, nodegraph_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    void FrostUI::add_dropdown(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    FUI_NodeGraphHandle FrostUI::add_nodegraph(const std::string& identifier, olc::vi2d position, olc::vi2d size)
     {
         if (!find_element(identifier))
         {
@@ -3717,53 +12263,90 @@ namespace olc
                 for (auto& window : windows)
                 {
                     if (window->get_id() == active_window_id)
+                    {
                         if (!active_group.second.empty())
-                            elements.emplace_back(std::make_shared<FUI_Dropdown>(identifier, window, active_group.second, text, position, size));
+                            elements.emplace_back(std::make_shared<FUI_NodeGraph>(identifier, window, active_group.second, position, size));
                         else
-                            elements.emplace_back(std::make_shared<FUI_Dropdown>(identifier, window, text, position, size));
+                            elements.emplace_back(std::make_shared<FUI_NodeGraph>(identifier, window, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_NodeGraphHandle(std::static_pointer_cast<FUI_NodeGraph>(elements.back()));
+                    }
                 }
             }
             else
+            {
                 if (!active_group.second.empty())
-                    elements.emplace_back(std::make_shared<FUI_Dropdown>(identifier, active_group.second, text, position, size));
+                    elements.emplace_back(std::make_shared<FUI_NodeGraph>(identifier, active_group.second, position, size));
                 else
-                    elements.emplace_back(std::make_shared<FUI_Dropdown>(identifier, text, position, size));
+                    elements.emplace_back(std::make_shared<FUI_NodeGraph>(identifier, position, size));
+
+                adopt(elements.back().get());
+                return FUI_NodeGraphHandle(std::static_pointer_cast<FUI_NodeGraph>(elements.back()));
+            }
         }
         else
-            std::cout << "Duplicate IDs found (function affected: add_dropdown, dropdown_id affected: " + identifier + ")\n";
+            std::cout << "Duplicate IDs found (function affected: add_nodegraph, nodegraph_id affected: " + identifier + ")\n";
+
+        return {};
+    }
+
+    void FrostUI::add_to_node(const std::string& nodegraph_id, const std::string& node_id, const std::string& element_id)
+    {
+        auto nodegraph = find_element(nodegraph_id);
+        auto element = find_element(element_id);
+        FUI_GraphNode* node = nullptr;
+        if (nodegraph && nodegraph->get_ui_type() == FUI_Type::NODEGRAPH)
+            node = std::static_pointer_cast<FUI_NodeGraph>(nodegraph)->get_node(node_id);
+
+        if (!nodegraph || nodegraph->get_ui_type() != FUI_Type::NODEGRAPH)
+            std::cout << "Could not find nodegraph ID (function affected: add_to_node, nodegraph_id affected: " + nodegraph_id + ")\n";
+        else if (!node)
+            std::cout << "Could not find node ID (function affected: add_to_node, node_id affected: " + node_id + ")\n";
+        else if (!element)
+            std::cout << "Could not find element ID (function affected: add_to_node, element_id affected: " + element_id + ")\n";
+        else if (element->encloses(nodegraph.get()))
+            std::cout << "Tried to nest an element inside itself (function affected: add_to_node, element_id affected: " + element_id + ")\n";
+        else
+        {
+            if (element->get_container())
+                element->get_container()->remove_child(element.get());
+            node->add_child(element);
+            structure_version++;
+        }
     }
 
-    void FrostUI::add_combolist(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    FUI_ProgressBarHandle FrostUI::add_progressbar(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
     {
         if (!find_element(identifier))
         {
             if (windows.size() > 0)
             {
-                bool did_add = false;
                 for (auto& window : windows)
                 {
                     if (window->get_id() == parent_id)
                     {
-                        did_add = true;
                         if (!active_group.second.empty())
-                            elements.emplace_back(std::make_shared<FUI_Combolist>(identifier, window, text, position, size));
+                            elements.emplace_back(std::make_shared<FUI_ProgressBar>(identifier, window, active_group.second, text, position, size));
                         else
-                            elements.emplace_back(std::make_shared<FUI_Combolist>(identifier, window, active_group.second, text, position, size));
+                            elements.emplace_back(std::make_shared<FUI_ProgressBar>(identifier, window, text, position, size));
 
-                        break;
+                        adopt(elements.back().get());
+                        return FUI_ProgressBarHandle(std::static_pointer_cast<FUI_ProgressBar>(elements.back()));
                     }
                 }
-                if (!did_add)
-                    std::cout << "Could not find parent window ID (function affected: add_combolist, combolist_id affected: " + identifier + ")\n";
+                std::cout << "Could not find parent window ID (function affected: add_progressbar, progressbar_id affected: " + identifier + ")\n";
             }
             else
-                std::cout << "There's no windows to be used as parent (function affected: add_combolist, combolist_id affected: " + identifier + ")\n";
+                std::cout << "There's no windows to be used as parent (function affected: add_progressbar, progressbar_id affected: " + identifier + ")\n";
         }
         else
-            std::cout << "Duplicate IDs found (function affected: add_combolist, combolist_id affected: " + identifier + ")\n";
+            std::cout << "Duplicate IDs found (function affected: add_progressbar, progressbar_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    void FrostUI::add_combolist(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    FUI_ProgressBarHandle FrostUI::add_progressbar(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
     {
         if (!find_element(identifier))
         {
@@ -3772,53 +12355,65 @@ namespace olc
                 for (auto& window : windows)
                 {
                     if (window->get_id() == active_window_id)
+                    {
                         if (!active_group.second.empty())
-                            elements.emplace_back(std::make_shared<FUI_Combolist>(identifier, window, active_group.second, text, position, size));
+                            elements.emplace_back(std::make_shared<FUI_ProgressBar>(identifier, window, active_group.second, text, position, size));
                         else
-                            elements.emplace_back(std::make_shared<FUI_Combolist>(identifier, window, text, position, size));
+                            elements.emplace_back(std::make_shared<FUI_ProgressBar>(identifier, window, text, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_ProgressBarHandle(std::static_pointer_cast<FUI_ProgressBar>(elements.back()));
+                    }
                 }
             }
             else
+            {
                 if (!active_group.second.empty())
-                    elements.emplace_back(std::make_shared<FUI_Combolist>(identifier, active_group.second, text, position, size));
+                    elements.emplace_back(std::make_shared<FUI_ProgressBar>(identifier, active_group.second, text, position, size));
                 else
-                    elements.emplace_back(std::make_shared<FUI_Combolist>(identifier, text, position, size));
+                    elements.emplace_back(std::make_shared<FUI_ProgressBar>(identifier, text, position, size));
+
+                adopt(elements.back().get());
+                return FUI_ProgressBarHandle(std::static_pointer_cast<FUI_ProgressBar>(elements.back()));
+            }
         }
         else
-            std::cout << "Duplicate IDs found (function affected: add_combolist, combolist_id affected: " + identifier + ")\n";
+            std::cout << "Duplicate IDs found (function affected: add_progressbar, progressbar_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    void FrostUI::add_groupbox(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    FUI_SpinnerHandle FrostUI::add_spinner(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
     {
         if (!find_element(identifier))
         {
             if (windows.size() > 0)
             {
-                bool did_add = false;
                 for (auto& window : windows)
                 {
                     if (window->get_id() == parent_id)
                     {
-                        did_add = true;
                         if (!active_group.second.empty())
-                            groupboxes.emplace_back(std::make_shared<FUI_Groupbox>(identifier, window, text, position, size));
+                            elements.emplace_back(std::make_shared<FUI_Spinner>(identifier, window, active_group.second, text, position, size));
                         else
-                            groupboxes.emplace_back(std::make_shared<FUI_Groupbox>(identifier, window, active_group.second, text, position, size));
+                            elements.emplace_back(std::make_shared<FUI_Spinner>(identifier, window, text, position, size));
 
-                        break;
+                        adopt(elements.back().get());
+                        return FUI_SpinnerHandle(std::static_pointer_cast<FUI_Spinner>(elements.back()));
                     }
                 }
-                if (!did_add)
-                    std::cout << "Could not find parent window ID (function affected: add_groupbox, groupbox_id affected: " + identifier + ")\n";
+                std::cout << "Could not find parent window ID (function affected: add_spinner, spinner_id affected: " + identifier + ")\n";
             }
             else
-                std::cout << "There's no windows to be used as parent (function affected: add_groupbox, groupbox_id affected: " + identifier + ")\n";
+                std::cout << "There's no windows to be used as parent (function affected: add_spinner, spinner_id affected: " + identifier + ")\n";
         }
         else
-            std::cout << "Duplicate IDs found (function affected: add_groupbox, groupbox_id affected: " + identifier + ")\n";
+            std::cout << "Duplicate IDs found (function affected: add_spinner, spinner_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    void FrostUI::add_groupbox(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    FUI_SpinnerHandle FrostUI::add_spinner(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
     {
         if (!find_element(identifier))
         {
@@ -3827,299 +12422,690 @@ namespace olc
                 for (auto& window : windows)
                 {
                     if (window->get_id() == active_window_id)
+                    {
                         if (!active_group.second.empty())
-                            groupboxes.emplace_back(std::make_shared<FUI_Groupbox>(identifier, window, active_group.second, text, position, size));
+                            elements.emplace_back(std::make_shared<FUI_Spinner>(identifier, window, active_group.second, text, position, size));
                         else
-                            groupboxes.emplace_back(std::make_shared<FUI_Groupbox>(identifier, window, text, position, size));
+                            elements.emplace_back(std::make_shared<FUI_Spinner>(identifier, window, text, position, size));
+
+                        adopt(elements.back().get());
+                        return FUI_SpinnerHandle(std::static_pointer_cast<FUI_Spinner>(elements.back()));
+                    }
                 }
             }
             else
+            {
                 if (!active_group.second.empty())
-                    groupboxes.emplace_back(std::make_shared<FUI_Groupbox>(identifier, active_group.second, text, position, size));
+                    elements.emplace_back(std::make_shared<FUI_Spinner>(identifier, active_group.second, text, position, size));
                 else
-                    groupboxes.emplace_back(std::make_shared<FUI_Groupbox>(identifier, text, position, size));
+                    elements.emplace_back(std::make_shared<FUI_Spinner>(identifier, text, position, size));
+
+                adopt(elements.back().get());
+                return FUI_SpinnerHandle(std::static_pointer_cast<FUI_Spinner>(elements.back()));
+            }
         }
         else
-            std::cout << "Duplicate IDs found (function affected: add_groupbox, groupbox_id affected: " + identifier + ")\n";
+            std::cout << "Duplicate IDs found (function affected: add_spinner, spinner_id affected: " + identifier + ")\n";
+
+        return {};
     }
 
-    void FrostUI::add_float_slider(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, olc::vf2d range)
+    bool FrostUI::begin_window(std::string_view window_id)
     {
-        if (!find_element(identifier))
+        uint64_t id = FUI_ImmediateTable::hash(window_id.data(), window_id.size(), FUI_ImmediateTable::hash_seed);
+        immediate_window = nullptr;
+        for (auto& cached : immediate_windows)
+            if (cached.first == id)
+                immediate_window = cached.second;
+
+        // first use of this window id, look it up by name once
+        if (!immediate_window)
         {
-            if (windows.size() > 0)
+            for (auto& window : windows)
             {
-                bool did_add = false;
-                for (auto& window : windows)
+                if (window->get_id() == window_id)
                 {
-                    if (window->get_id() == parent_id)
-                    {
-                        did_add = true;
-                        if (!active_group.second.empty())
-                            elements.emplace_back(std::make_shared<FUI_Slider>(identifier, window, text, position, size, range, FUI_Slider::type::FLOAT));
-                        else
-                            elements.emplace_back(std::make_shared<FUI_Slider>(identifier, window, active_group.second, text, position, size, range, FUI_Slider::type::FLOAT));
-                    
-                        break;
-                    }
+                    immediate_window = window;
+                    immediate_windows.emplace_back(id, window);
+                    break;
                 }
-                if (!did_add)
-                    std::cout << "Could not find parent window ID (function affected: add_slider, slider_id affected: " + identifier + ")\n";
             }
+        }
+        if (!immediate_window)
+            std::cout << "Could not find the window ID in added windows (function affected: begin_window, affected window_id: " + std::string(window_id) + ")\n";
+
+        immediate_skip = !immediate_window || immediate_window->get_closed_state();
+        immediate_id_depth = 0;
+        immediate_id_stack[0] = id;
+        immediate_same_line = false;
+        immediate_cursor = immediate_line_start = { 4.f, 4.f };
+        return !immediate_skip;
+    }
+
+    void FrostUI::end_window()
+    {
+        immediate_window = nullptr;
+        immediate_skip = false;
+        immediate_id_depth = 0;
+        immediate_id_stack[0] = FUI_ImmediateTable::hash_seed;
+        immediate_same_line = false;
+        immediate_cursor = immediate_line_start = { 4.f, 4.f };
+    }
+
+    void FrostUI::push_id(std::string_view id)
+    {
+        if (size_t(immediate_id_depth + 1) >= immediate_id_stack.size())
+        {
+            std::cout << "ID stack is full (function affected: push_id)\n";
+            return;
+        }
+        immediate_id_stack[immediate_id_depth + 1] = FUI_ImmediateTable::hash(id.data(), id.size(), immediate_id_stack[immediate_id_depth]);
+        immediate_id_depth++;
+    }
+
+    void FrostUI::push_id(const void* id)
+    {
+        if (size_t(immediate_id_depth + 1) >= immediate_id_stack.size())
+        {
+            std::cout << "ID stack is full (function affected: push_id)\n";
+            return;
+        }
+        immediate_id_stack[immediate_id_depth + 1] = FUI_ImmediateTable::hash(&id, sizeof(id), immediate_id_stack[immediate_id_depth]);
+        immediate_id_depth++;
+    }
+
+    void FrostUI::pop_id()
+    {
+        if (immediate_id_depth > 0)
+            immediate_id_depth--;
+    }
+
+    void FrostUI::same_line()
+    {
+        immediate_same_line = true;
+    }
+
+    void FrostUI::set_cursor(olc::vf2d p)
+    {
+        immediate_cursor = immediate_line_start = p;
+        immediate_same_line = false;
+    }
+
+    void FrostUI::set_item_width(float width)
+    {
+        immediate_item_width = width;
+    }
+
+    FUI_ImmediateTable::Widget* FrostUI::immediate_widget(std::string_view label, bool& created)
+    {
+        created = false;
+        if (immediate_skip)
+            return nullptr;
+
+        uint64_t id = FUI_ImmediateTable::hash(label.data(), label.size(), immediate_id_stack[immediate_id_depth]);
+        auto widget = immediate_table.acquire(id, immediate_frame, created);
+        if (created)
+        {
+            widget->window = immediate_window;
+            request_redraw();
+        }
+        else if (widget->window != immediate_window)
+        {
+            // the window was removed and added again under the same id, follow the new one
+            widget->window = immediate_window;
+            if (widget->element)
+                widget->element->parent = immediate_window;
+            request_redraw();
+        }
+        immediate_order.push_back(widget);
+        return widget;
+    }
+
+    const olc::vf2d FrostUI::immediate_place(olc::vf2d item_size)
+    {
+        olc::vf2d p = immediate_cursor;
+        if (immediate_same_line)
+            p = { immediate_last_position.x + immediate_last_size.x + immediate_spacing, immediate_last_position.y };
+        immediate_same_line = false;
+
+        immediate_last_position = p;
+        immediate_last_size = item_size;
+        immediate_cursor = { immediate_line_start.x, std::max(immediate_cursor.y, p.y + item_size.y + immediate_spacing) };
+        return p;
+    }
+
+    void FrostUI::label(std::string_view text)
+    {
+        bool created = false;
+        auto widget = immediate_widget(text, created);
+        if (!widget)
+            return;
+
+        if (created)
+        {
+            std::string display(text.substr(0, text.find("##")));
+            if (immediate_window)
+                widget->element = std::make_shared<FUI_Label>(display, immediate_window, display, olc::vi2d{ 0, 0 });
             else
-                std::cout << "There's no windows to be used as parent (function affected: add_slider, slider_id affected: " + identifier + ")\n";
+                widget->element = std::make_shared<FUI_Label>(display, display, olc::vi2d{ 0, 0 });
+            adopt(widget->element.get());
+            widget->label_width = float(pge->GetTextSizeProp(display).x);
+        }
+        widget->element->set_position(immediate_place({ widget->label_width, 8.f }));
+    }
+
+    bool FrostUI::button(std::string_view label)
+    {
+        bool created = false;
+        auto widget = immediate_widget(label, created);
+        if (!widget)
+            return false;
+
+        if (created)
+        {
+            std::string display(label.substr(0, label.find("##")));
+            olc::vi2d button_size = { pge->GetTextSizeProp(display).x + 10, int(immediate_item_height) };
+            auto on_click = [widget]() { widget->clicked = true; };
+            if (immediate_window)
+                widget->element = std::make_shared<FUI_Button>(display, immediate_window, display, olc::vi2d{ 0, 0 }, button_size, on_click);
+            else
+                widget->element = std::make_shared<FUI_Button>(display, display, olc::vi2d{ 0, 0 }, button_size, on_click);
+            adopt(widget->element.get());
+        }
+        widget->element->set_position(immediate_place(widget->element->get_size()));
+
+        bool clicked = widget->clicked;
+        widget->clicked = false;
+        return clicked;
+    }
+
+    bool FrostUI::checkbox(std::string_view label, bool* value)
+    {
+        bool created = false;
+        auto widget = immediate_widget(label, created);
+        if (!widget)
+            return false;
+
+        olc::vi2d box_size = { int(immediate_item_height) - 4, int(immediate_item_height) - 4 };
+        if (created)
+        {
+            std::string display(label.substr(0, label.find("##")));
+            if (immediate_window)
+                widget->element = std::make_shared<FUI_Checkbox>(display, immediate_window, display, olc::vi2d{ 0, 0 }, box_size);
+            else
+                widget->element = std::make_shared<FUI_Checkbox>(display, display, olc::vi2d{ 0, 0 }, box_size);
+            adopt(widget->element.get());
+            widget->label_width = float(pge->GetTextSizeProp(display).x) + 4.f;
+            widget->element->set_checkbox_state(*value);
+            widget->synced_value = *value;
+        }
+        // the checkbox draws its label on the left
+        olc::vf2d p = immediate_place({ widget->label_width + box_size.x, float(box_size.y) });
+        widget->element->set_position(p + olc::vf2d{ widget->label_width, 0.f });
+
+        bool changed = false;
+        bool state = widget->element->get_checkbox_state();
+        if (state != (widget->synced_value != 0.0))
+        {
+            *value = state;
+            changed = true;
+        }
+        else if (*value != state)
+        {
+            widget->element->set_checkbox_state(*value);
+            request_redraw();
+        }
+        widget->synced_value = *value;
+        return changed;
+    }
+
+    bool FrostUI::slider(std::string_view label, float* value, float min, float max)
+    {
+        bool created = false;
+        auto widget = immediate_widget(label, created);
+        if (!widget)
+            return false;
+
+        olc::vi2d slider_size = { int(immediate_item_width), int(immediate_item_height) };
+        if (created)
+        {
+            std::string display(label.substr(0, label.find("##")));
+            if (immediate_window)
+                widget->element = std::make_shared<FUI_Slider>(display, immediate_window, display, olc::vi2d{ 0, 0 }, slider_size, olc::vf2d{ min, max }, FUI_Element::type::FLOAT);
+            else
+                widget->element = std::make_shared<FUI_Slider>(display, display, olc::vi2d{ 0, 0 }, slider_size, olc::vf2d{ min, max }, FUI_Element::type::FLOAT);
+            adopt(widget->element.get());
+            widget->label_width = float(pge->GetTextSizeProp(display).x) + 4.f;
+            widget->element->set_slider_value(*value);
+            widget->synced_value = widget->element->get_slider_value<float>();
+        }
+        // the slider draws its label on the left
+        olc::vf2d p = immediate_place({ widget->label_width + slider_size.x, float(slider_size.y) });
+        widget->element->set_position(p + olc::vf2d{ widget->label_width, 0.f });
+
+        bool changed = false;
+        float current = widget->element->get_slider_value<float>();
+        if (current != float(widget->synced_value))
+        {
+            *value = current;
+            changed = true;
+        }
+        else if (*value != current)
+        {
+            widget->element->set_slider_value(*value);
+            request_redraw();
+        }
+        widget->synced_value = widget->element->get_slider_value<float>();
+        return changed;
+    }
+
+    bool FrostUI::slider(std::string_view label, int* value, int min, int max)
+    {
+        bool created = false;
+        auto widget = immediate_widget(label, created);
+        if (!widget)
+            return false;
+
+        olc::vi2d slider_size = { int(immediate_item_width), int(immediate_item_height) };
+        if (created)
+        {
+            std::string display(label.substr(0, label.find("##")));
+            if (immediate_window)
+                widget->element = std::make_shared<FUI_Slider>(display, immediate_window, display, olc::vi2d{ 0, 0 }, slider_size, olc::vi2d{ min, max }, FUI_Element::type::INT);
+            else
+                widget->element = std::make_shared<FUI_Slider>(display, display, olc::vi2d{ 0, 0 }, slider_size, olc::vi2d{ min, max }, FUI_Element::type::INT);
+            adopt(widget->element.get());
+            widget->label_width = float(pge->GetTextSizeProp(display).x) + 4.f;
+            widget->element->set_slider_value(*value);
+            widget->synced_value = widget->element->get_slider_value<int>();
+        }
+        olc::vf2d p = immediate_place({ widget->label_width + slider_size.x, float(slider_size.y) });
+        widget->element->set_position(p + olc::vf2d{ widget->label_width, 0.f });
+
+        bool changed = false;
+        int current = widget->element->get_slider_value<int>();
+        if (current != int(widget->synced_value))
+        {
+            *value = current;
+            changed = true;
         }
-        else
-            std::cout << "Duplicate IDs found (function affected: add_slider, slider_id affected: " + identifier + ")\n";
+        else if (*value != current)
+        {
+            widget->element->set_slider_value(*value);
+            request_redraw();
+        }
+        widget->synced_value = widget->element->get_slider_value<int>();
+        return changed;
     }
 
-    void FrostUI::add_float_slider(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, olc::vf2d range)
+    void FrostUI::run_immediate(FUI_Window* window, bool draw)
     {
-        if (!find_element(identifier))
+        for (auto widget : immediate_order)
         {
-            if (!active_window_id.empty())
+            if (widget->window != window)
+                continue;
+
+            auto& e = widget->element;
+            if (window)
             {
-                for (auto& window : windows)
-                {
-                    if (window->get_id() == active_window_id)
-                        if (!active_group.second.empty())
-                            elements.emplace_back(std::make_shared<FUI_Slider>(identifier, window, active_group.second, text, position, size, range, FUI_Slider::type::FLOAT));
-                        else
-                            elements.emplace_back(std::make_shared<FUI_Slider>(identifier, window, text, position, size, range, FUI_Slider::type::FLOAT));
-                }
+                // same order as retained elements inside a window, draw first and input only while focused
+                if (draw)
+                    e->draw(pge);
+                if (window->is_focused())
+                    e->input(pge);
+                else
+                    e->set_focused_status(false);
             }
             else
-                if (!active_group.second.empty())
-                    elements.emplace_back(std::make_shared<FUI_Slider>(identifier, active_group.second, text, position, size, range, FUI_Slider::type::FLOAT));
-                else
-                    elements.emplace_back(std::make_shared<FUI_Slider>(identifier, text, position, size, range, FUI_Slider::type::FLOAT));
+            {
+                if (windows.size() == 0 || !(is_a_window_focused() || is_cursor_in_window()))
+                    e->input(pge);
+                if (draw)
+                    e->draw(pge);
+            }
         }
-        else
-            std::cout << "Duplicate IDs found (function affected: add_slider, slider_id affected: " + identifier + ")\n";
     }
 
-    void FrostUI::add_int_slider(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, olc::vi2d range)
+    void FrostUI::collect_immediate()
     {
-        if (!find_element(identifier))
+        size_t live = immediate_table.get_size();
+        immediate_table.collect(immediate_frame);
+        if (immediate_table.get_size() != live)
+            request_redraw();
+        immediate_order.clear();
+        immediate_frame++;
+    }
+
+    void FrostUI::post(std::shared_ptr<FUI_Element> element, FUI_Op op)
+    {
+        if (!element)
         {
-            if (windows.size() > 0)
-            {
-                bool did_add = false;
-                for (auto& window : windows)
-                {
-                    if (window->get_id() == parent_id)
-                    {
-                        did_add = true;
-                        if (!active_group.second.empty())
-                            elements.emplace_back(std::make_shared<FUI_Slider>(identifier, window, text, position, size, range, FUI_Slider::type::INT));
-                        else
-                            elements.emplace_back(std::make_shared<FUI_Slider>(identifier, window, active_group.second, text, position, size, range, FUI_Slider::type::INT));
-                    
-                        break;
-                    }
-                }
-                if (!did_add)
-                    std::cout << "Could not find parent window ID (function affected: add_slider, slider_id affected: " + identifier + ")\n";
-            }
-            else
-                std::cout << "There's no windows to be used as parent (function affected: add_slider, slider_id affected: " + identifier + ")\n";
+            std::cout << "Tried to post to an empty element (function affected: post)\n";
+            return;
         }
-        else
-            std::cout << "Duplicate IDs found (function affected: add_slider, slider_id affected: " + identifier + ")\n";
+        posted_ops.push(std::move(element), std::move(op));
     }
 
-    void FrostUI::add_int_slider(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, olc::vi2d range)
+    void FrostUI::apply_posted_ops()
     {
-        if (!find_element(identifier))
+        while (auto node = posted_ops.pop())
+            draining_ops.push_back(node);
+        if (draining_ops.empty())
+            return;
+        request_redraw();
+
+        // newest first, so older set_text / set_value ops of the same element can be skipped
+        drain_count++;
+        for (auto it = draining_ops.rbegin(); it != draining_ops.rend(); ++it)
         {
-            if (!active_window_id.empty())
+            auto node = *it;
+            auto& element = node->element;
+            if (node->op.kind == FUI_Op::Kind::SET_TEXT)
             {
-                for (auto& window : windows)
-                {
-                    if (window->get_id() == active_window_id)
-                        if (!active_group.second.empty())
-                            elements.emplace_back(std::make_shared<FUI_Slider>(identifier, window, active_group.second, text, position, size, range, FUI_Slider::type::INT));
-                        else
-                            elements.emplace_back(std::make_shared<FUI_Slider>(identifier, window, text, position, size, range, FUI_Slider::type::INT));
-                }
+                node->superseded = element->posted_text_drain == drain_count;
+                element->posted_text_drain = drain_count;
+            }
+            else if (node->op.kind == FUI_Op::Kind::SET_VALUE)
+            {
+                node->superseded = element->posted_value_drain == drain_count;
+                element->posted_value_drain = drain_count;
             }
-            else
-                if (!active_group.second.empty())
-                    elements.emplace_back(std::make_shared<FUI_Slider>(identifier, active_group.second, text, position, size, range, FUI_Slider::type::INT));
-                else
-                    elements.emplace_back(std::make_shared<FUI_Slider>(identifier, text, position, size, range, FUI_Slider::type::INT));
         }
-        else
-            std::cout << "Duplicate IDs found (function affected: add_slider, slider_id affected: " + identifier + ")\n";
-    }
 
-    void FrostUI::add_button(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, std::function<void()> callback)
-    {
-        if (!find_element(identifier))
+        for (auto node : draining_ops)
         {
-            if (windows.size() > 0)
+            auto& element = node->element;
+            if (!node->superseded)
             {
-                bool did_add = false;
-                for (auto& window : windows)
+                switch (node->op.kind)
                 {
-                    if (window->get_id() == parent_id)
+                case FUI_Op::Kind::SET_TEXT:
+                    element->set_text(node->op.text);
+                    break;
+                case FUI_Op::Kind::SET_VALUE:
+                    if (element->ui_type == FUI_Type::SLIDER)
                     {
-                        did_add = true;
-                        if (!active_group.second.empty())
-                            elements.emplace_back(std::make_shared<FUI_Button>(identifier, window, text, position, size, callback));
+                        if (element->slider_type == FUI_Element::type::FLOAT)
+                            element->set_slider_value(float(node->op.value));
                         else
-                            elements.emplace_back(std::make_shared<FUI_Button>(identifier, window, active_group.second, text, position, size, callback));
-                    
-                        break;
+                            element->set_slider_value(int(std::lround(node->op.value)));
                     }
+                    else if (element->ui_type == FUI_Type::CHECKBOX)
+                        element->set_checkbox_state(node->op.value != 0.0);
+                    else
+                        std::cout << "Trying to post set_value on wrong UI_TYPE\n";
+                    break;
+                case FUI_Op::Kind::ADD_ITEM:
+                    element->add_item(node->op.text, { 1.0f, 1.0f });
+                    break;
+                case FUI_Op::Kind::CALL:
+                    if (node->op.call)
+                        node->op.call(*element);
+                    break;
                 }
-                if (!did_add)
-                    std::cout << "Could not find parent window ID (function affected: add_button, button_id affected: " + identifier + ")\n";
             }
-            else
-                std::cout << "There's no windows to be used as parent (function affected: add_button, button_id affected: " + identifier + ")\n";
+            delete node;
         }
-        else
-            std::cout << "Duplicate IDs found (function affected: add_button, button_id affected: " + identifier + ")\n";
+        draining_ops.clear();
     }
 
-    void FrostUI::add_button(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, std::function<void()> callback)
+    void FrostUI::post_completion(std::function<void()> completion, std::function<void()> cancel)
     {
-        if (!find_element(identifier))
-        {
-            if (!active_window_id.empty())
-            {
-                for (auto& window : windows)
-                {
-                    if (window->get_id() == active_window_id)
-                        if (!active_group.second.empty())
-                            elements.emplace_back(std::make_shared<FUI_Button>(identifier, window, active_group.second, text, position, size, callback));
-                        else
-                            elements.emplace_back(std::make_shared<FUI_Button>(identifier, window, text, position, size, callback));
-                }
-            }
-            else
-                if (!active_group.second.empty())
-                    elements.emplace_back(std::make_shared<FUI_Button>(identifier, active_group.second, text, position, size, callback));
-                else
-                    elements.emplace_back(std::make_shared<FUI_Button>(identifier, text, position, size, callback));
-        }
-        else
-            std::cout << "Duplicate IDs found (function affected: add_button, button_id affected: " + identifier + ")\n";
+        std::lock_guard<std::mutex> lock(completion_mutex);
+        completions.push_back(FUI_Job{ std::move(completion), std::move(cancel) });
     }
 
-    void FrostUI::add_inputfield(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    void FrostUI::run_completions()
     {
-        if (!find_element(identifier))
+        if (running_completions.empty())
         {
-            if (windows.size() > 0)
-            {
-                bool did_add = false;
-                for (auto& window : windows)
-                {
-                    if (window->get_id() == parent_id)
-                    {
-                        did_add = true;
-                        if (!active_group.second.empty())
-                            elements.emplace_back(std::make_shared<FUI_Inputfield>(identifier, window, text, position, size));
-                        else
-                            elements.emplace_back(std::make_shared<FUI_Inputfield>(identifier, window, active_group.second, text, position, size));
+            std::lock_guard<std::mutex> lock(completion_mutex);
+            std::swap(completions, running_completions);
+        }
+        if (!running_completions.empty())
+            request_redraw();
 
-                        break;
-                    }
-                }
-                if (!did_add)
-                    std::cout << "Could not find parent window ID (function affected: add_inputfield, inputfield_id affected: " + identifier + ")\n";
-            }
-            else
-                std::cout << "There's no windows to be used as parent (function affected: add_inputfield, inputfield_id affected: " + identifier + ")\n";
+        // a completion that throws leaves the ones after it for the next run()
+        size_t i = 0;
+        try
+        {
+            for (; i < running_completions.size(); i++)
+                running_completions[i].run();
         }
-        else
-            std::cout << "Duplicate IDs found (function affected: add_inputfield, inputfield_id affected: " + identifier + ")\n";
+        catch (...)
+        {
+            running_completions.erase(running_completions.begin(), running_completions.begin() + i + 1);
+            throw;
+        }
+        running_completions.clear();
     }
 
-    void FrostUI::add_inputfield(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size)
+    uint64_t FrostUI::subscribe(FUI_EventType type, std::function<void(const FUI_Event&)> callback)
     {
-        if (!find_element(identifier))
+        return event_bus.subscribe(type, nullptr, std::move(callback));
+    }
+
+    uint64_t FrostUI::subscribe(FUI_EventType type, FUI_Element* element, std::function<void(const FUI_Event&)> callback)
+    {
+        return event_bus.subscribe(type, element, std::move(callback));
+    }
+
+    void FrostUI::unsubscribe(uint64_t id)
+    {
+        event_bus.unsubscribe(id);
+    }
+
+    bool FrostUI::start_recording(const std::string& path)
+    {
+        return input_recorder.open(path);
+    }
+
+    void FrostUI::stop_recording()
+    {
+        input_recorder.close();
+    }
+
+    bool FrostUI::start_replay(const std::string& path)
+    {
+        replay_timings.clear();
+        return input_replay.open(path);
+    }
+
+    void FrostUI::stop_replay()
+    {
+        input_replay.close();
+    }
+
+    const bool FrostUI::is_replaying()
+    {
+        return input_replay.is_open() && !input_replay.at_end();
+    }
+
+    const bool FrostUI::is_rect_covered(olc::vf2d min, olc::vf2d max, size_t window_index)
+    {
+        // what's left of the rect after cutting out every opaque window above it
+        uncovered_rects.clear();
+        uncovered_rects.emplace_back(min, max);
+        for (size_t j = window_index + 1; j < windows.size() && !uncovered_rects.empty(); j++)
         {
-            if (!active_window_id.empty())
+            auto& cover = windows[j];
+            if (cover->get_closed_state() || !cover->is_opaque())
+                continue;
+            olc::vf2d cover_min = cover->get_position();
+            olc::vf2d cover_max = cover_min + cover->get_size();
+
+            size_t count = uncovered_rects.size();
+            for (size_t k = 0; k < count; k++)
             {
-                for (auto& window : windows)
-                {
-                    if (window->get_id() == active_window_id)
-                        if (!active_group.second.empty())
-                            elements.emplace_back(std::make_shared<FUI_Inputfield>(identifier, window, active_group.second, text, position, size));
-                        else
-                            elements.emplace_back(std::make_shared<FUI_Inputfield>(identifier, window, text, position, size));
-                }
+                auto [a, b] = uncovered_rects[k];
+                if (cover_min.x >= b.x || cover_max.x <= a.x || cover_min.y >= b.y || cover_max.y <= a.y)
+                    continue;
+                // split into the parts above, below, left and right of the cover
+                if (cover_min.y > a.y)
+                    uncovered_rects.emplace_back(a, olc::vf2d{ b.x, cover_min.y });
+                if (cover_max.y < b.y)
+                    uncovered_rects.emplace_back(olc::vf2d{ a.x, cover_max.y }, b);
+                float top = std::max(a.y, cover_min.y);
+                float bottom = std::min(b.y, cover_max.y);
+                if (cover_min.x > a.x)
+                    uncovered_rects.emplace_back(olc::vf2d{ a.x, top }, olc::vf2d{ cover_min.x, bottom });
+                if (cover_max.x < b.x)
+                    uncovered_rects.emplace_back(olc::vf2d{ cover_max.x, top }, olc::vf2d{ b.x, bottom });
+                // marks the rect as used up, removed below
+                uncovered_rects[k].second = uncovered_rects[k].first;
             }
-            else
-                if (!active_group.second.empty())
-                    elements.emplace_back(std::make_shared<FUI_Inputfield>(identifier, active_group.second, text, position, size));
-                else
-                    elements.emplace_back(std::make_shared<FUI_Inputfield>(identifier, text, position, size));
+            uncovered_rects.erase(std::remove_if(uncovered_rects.begin(), uncovered_rects.end(),
+                [](const std::pair<olc::vf2d, olc::vf2d>& r) { return r.second.x <= r.first.x || r.second.y <= r.first.y; }), uncovered_rects.end());
         }
-        else
-            std::cout << "Duplicate IDs found (function affected: add_inputfield, inputfield_id affected: " + identifier + ")\n";
+        return uncovered_rects.empty();
     }
 
-    void FrostUI::add_console(const std::string& parent_id, const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, int inputfield_thickness)
+    void FrostUI::update_window_occlusion()
     {
-        if (!find_element(identifier))
+        olc::vf2d screen = { float(pge->ScreenWidth()), float(pge->ScreenHeight()) };
+        window_hidden.resize(windows.size());
+
+        for (size_t i = 0; i < windows.size(); i++)
         {
-            if (windows.size() > 0)
+            auto& window = windows[i];
+            bool hidden = false;
+            if (!window->get_closed_state())
             {
-                bool did_add = false;
-                for (auto& window : windows)
+                olc::vf2d min = window->get_position();
+                olc::vf2d max = min + window->get_size();
+                // the window itself first, the extents of its elements only matter when that's already hidden
+                auto is_hidden = [&]()
                 {
-                    if (window->get_id() == parent_id)
+                    olc::vf2d clipped_min = { std::max(min.x, 0.f), std::max(min.y, 0.f) };
+                    olc::vf2d clipped_max = { std::min(max.x, screen.x), std::min(max.y, screen.y) };
+                    if (clipped_max.x <= clipped_min.x || clipped_max.y <= clipped_min.y)
+                        return true;
+                    return is_rect_covered(clipped_min, clipped_max, i);
+                };
+                hidden = is_hidden();
+                if (hidden)
+                {
+                    // elements aren't clipped to their window, open dropdowns and the like can hang out of it.
+                    // get_absolute_position would overwrite the position the element was last drawn and hit tested at
+                    olc::vf2d content = window->get_position() + olc::vf2d{ window->get_border_thickness(), window->get_top_border_thickness() };
+                    for (auto& e : elements)
                     {
-                        did_add = true;
-                        if (!active_group.second.empty())
-                            elements.emplace_back(std::make_shared<FUI_Console>(identifier, window, text, position, size, inputfield_thickness));
-                        else
-                            elements.emplace_back(std::make_shared<FUI_Console>(identifier, window, active_group.second, text, position, size, inputfield_thickness));
-                        
-                        break;
+                        // contained elements stay inside their container
+                        if (!e || e->get_container() || !e->get_parent() || e->get_parent()->get_id() != window->get_id())
+                            continue;
+                        olc::vf2d element_min = content + e->get_position();
+                        olc::vf2d element_max = element_min + e->get_draw_size();
+                        min = { std::min(min.x, element_min.x), std::min(min.y, element_min.y) };
+                        max = { std::max(max.x, element_max.x), std::max(max.y, element_max.y) };
                     }
+                    hidden = is_hidden();
                 }
-                if (!did_add)
-                    std::cout << "Could not find parent window ID (function affected: add_console, console_id affected: " + identifier + ")\n";
             }
-            else
-                std::cout << "There's no windows to be used as parent (function affected: add_console, console_id affected: " + identifier + ")\n";
+            window_hidden[i] = hidden;
         }
-        else
-            std::cout << "Duplicate IDs found (function affected: add_console, console_id affected: " + identifier + ")\n";
     }
 
-    void FrostUI::add_console(const std::string& identifier, const std::string& text, olc::vi2d position, olc::vi2d size, int inputfield_thickness)
+    void FrostUI::set_render_rate(float rate)
     {
-        if (!find_element(identifier))
+        render_rate = std::max(0.f, rate);
+        render_cached = false;
+        render_cache.clear();
+    }
+
+    const std::vector<float>& FrostUI::get_replay_timings()
+    {
+        return replay_timings;
+    }
+
+    std::vector<float> FrostUI::run_replay(const std::string& path)
+    {
+        if (!start_replay(path))
+            return {};
+
+        auto& layers = pge->GetLayers();
+        std::vector<size_t> marks;
+        while (true)
         {
-            if (!active_window_id.empty())
+            auto run_start = std::chrono::steady_clock::now();
+            // stops with the recording, a live frame in between would only skew the timings
+            if (!input_replay.read(frame))
+                break;
+
+            marks.clear();
+            for (auto& layer : layers)
+                marks.push_back(layer.vecDecalInstance.size());
+            run_frame(run_start, true);
+            // nothing presents these outside of the engine loop, the host's own decals stay
+            for (size_t i = 0; i < layers.size() && i < marks.size(); i++)
             {
-                for (auto& window : windows)
-                {
-                    if (window->get_id() == active_window_id)
-                        if (!active_group.second.empty())
-                            elements.emplace_back(std::make_shared<FUI_Console>(identifier, window, active_group.second, text, position, size, inputfield_thickness));
-                        else
-                            elements.emplace_back(std::make_shared<FUI_Console>(identifier, window, text, position, size, inputfield_thickness));
-                }
+                auto& decals = layers[i].vecDecalInstance;
+                decals.resize(std::min(marks[i], decals.size()));
             }
-            else
-                if (!active_group.second.empty())
-                    elements.emplace_back(std::make_shared<FUI_Console>(identifier, active_group.second, text, position, size, inputfield_thickness));
-                else
-                    elements.emplace_back(std::make_shared<FUI_Console>(identifier, text, position, size, inputfield_thickness));
         }
-        else
-            std::cout << "Duplicate IDs found (function affected: add_inputfield, inputfield_id affected: " + identifier + ")\n";
+        stop_replay();
+        return replay_timings;
+    }
+
+    FUI_RunStatus FrostUI::run()
+    {
+        auto run_start = std::chrono::steady_clock::now();
+
+        // one snapshot of the engine's input and clock for every element this frame, or the next recorded one
+        bool replayed = input_replay.is_open() && input_replay.read(frame);
+        if (!replayed)
+        {
+            input_replay.close();
+            frame.capture(pge);
+        }
+        return run_frame(run_start, replayed);
     }
 
-    void FrostUI::run()
+    FUI_RunStatus FrostUI::run_frame(std::chrono::steady_clock::time_point run_start, bool replayed)
     {
+        // elements read the frame and report redraws of this instance, other instances have their own
+        FUI_Element::frame = &frame;
+        FUI_Element::running_redraw = &redraw_requested;
+
+        // updates from other threads and results of async work are applied before anything reads the elements
+        apply_posted_ops();
+        run_completions();
+
+        input_recorder.write(frame);
+
+        // running tweens only, idle elements aren't visited
+        FUI_Element::animator = animator.get();
+        animator->tick(frame.delta_time);
+
+        // events raised from here on (bindings in update, input) are queued and dispatched once every element ran
+        FUI_Element::event_bus = &event_bus;
+
+        // model updates run every frame whether the element gets drawn or not, bindings and background work can't
+        // wait for a frame that is drawn
+        bool updated = false;
+        for (auto& e : elements)
+            if (e && e->update(pge))
+                updated = true;
+
+        // changes made after this point (by callbacks) are seen by the next run()
+        bool structure_changed = structure_version != last_structure_version;
+        last_structure_version = structure_version;
+
+        FUI_RunStatus status;
+        status.changed = frame.has_input() || frame.time >= next_change || updated || structure_changed;
+
+        drawing = true;
+        if (render_rate > 0.f)
+        {
+            render_stale = render_stale || status.changed;
+            bool due = frame.time - last_render_time >= 1.0 / render_rate;
+            drawing = !render_cached || redraw_requested || frame.has_input_events() || structure_changed || (due && render_stale);
+
+            auto& layers = pge->GetLayers();
+            render_marks.resize(layers.size());
+            for (size_t i = 0; i < layers.size(); i++)
+                render_marks[i] = layers[i].vecDecalInstance.size();
+        }
+
         // Cycle the inputfields before anything is drawn
         cycle_inputfield();
 
@@ -4145,13 +13131,14 @@ namespace olc
                             continue;
             if (!g->get_group().empty() && (active_group.first.empty() && active_group.second.empty()))
                 continue;
-            if (!g->get_parent())
+            if (!g->get_parent() && drawing)
                 g->draw(pge);
         }
 
         for (auto& e : elements)
         {
-            if (!e)
+            // elements inside a container are drawn and updated by the container
+            if (!e || e->get_container())
                 continue;
             if (!e->get_group().empty())
                 if (!active_group.second.empty())
@@ -4200,9 +13187,11 @@ namespace olc
                     else
                         e->input(pge);
                 }
-                e->draw(pge);
+                if (drawing)
+                    e->draw(pge);
             }
         }
+        run_immediate(nullptr, drawing);
 
         // Draw windows first
         if (windows.size() > 0)
@@ -4217,8 +13206,12 @@ namespace olc
                 }
             }
 
-            for (auto& window : windows)
+            if (drawing)
+                update_window_occlusion();
+
+            for (size_t window_index = 0; window_index < windows.size(); window_index++)
             {
+                auto& window = windows[window_index];
                 if (window->get_closed_state())
                 {
                     if (window->is_focused())
@@ -4229,7 +13222,10 @@ namespace olc
                 if (window->is_focused())
                     current_focused_window = window->get_id();
 
-                window->draw();
+                // hidden windows keep their elements and state, they're only left out of drawing
+                bool draw_window = drawing && !window_hidden[window_index];
+                if (draw_window)
+                    window->draw();
                 for (auto& g : groupboxes)
                 {
                     if (!g)
@@ -4241,14 +13237,14 @@ namespace olc
                                     continue;
                     if (!g->get_group().empty() && (active_group.first.empty() && active_group.second.empty()))
                         continue;
-                    if (g->get_parent() && g->get_parent()->get_id() == window->get_id())
+                    if (g->get_parent() && g->get_parent()->get_id() == window->get_id() && draw_window)
                         g->draw(pge);
                 }
 
                 // first = FUI_Type, second = FUI_Element
                 for (auto& e : elements)
                 {
-                    if (!e)
+                    if (!e || e->get_container())
                         continue;
                     if (!e->get_group().empty())
                         if (!active_group.second.empty())
@@ -4272,7 +13268,8 @@ namespace olc
                     {
                         if (e->get_parent()->get_id() == window->get_id())
                         {
-                            e->draw(pge);
+                            if (draw_window)
+                                e->draw(pge);
                             if (window->is_focused())
                             {
                                 if (trigger_pushback.second)
@@ -4290,6 +13287,7 @@ namespace olc
                             continue;
                     }
                 }
+                run_immediate(window, draw_window);
             }
             if (!is_a_window_focused())
                 current_focused_window = "";
@@ -4301,7 +13299,7 @@ namespace olc
 
                 for (auto& e : elements)
                 {
-                    if (!e)
+                    if (!e || e->get_container())
                         continue;
                     if (!e->get_group().empty())
                         if (!active_group.second.empty())
@@ -4320,6 +13318,73 @@ namespace olc
             }
             saved_focused_window = current_focused_window;
         }
+
+        if (render_rate > 0.f)
+        {
+            auto& layers = pge->GetLayers();
+            render_cache.resize(layers.size());
+            for (size_t i = 0; i < layers.size(); i++)
+            {
+                auto& decals = layers[i].vecDecalInstance;
+                size_t mark = i < render_marks.size() ? std::min(render_marks[i], decals.size()) : decals.size();
+                if (drawing)
+                    render_cache[i].assign(decals.begin() + mark, decals.end());
+                else
+                    decals.insert(decals.end(), render_cache[i].begin(), render_cache[i].end());
+            }
+            if (drawing)
+            {
+                // requests made so far and changes held back since the last draw are part of this frame
+                status.changed = status.changed || redraw_requested || render_stale;
+                render_cached = true;
+                render_stale = false;
+                last_render_time = frame.time;
+                redraw_requested = false;
+            }
+        }
+
+        // change events go out once every element had its input, so callbacks see the whole frame's changes
+        for (auto& e : elements)
+            if (e)
+                e->dispatch_change(frame.time);
+
+        // callbacks are free to change elements and windows from here on, the bus stays installed so their own
+        // events are queued for the next frame instead of running inside the callback
+        event_bus.dispatch();
+        FUI_Element::event_bus = nullptr;
+        FUI_Element::animator = nullptr;
+
+        collect_immediate();
+
+        // asked after drawing so animations that finished this frame report no further change
+        for (auto& e : elements)
+            if (e)
+                status.next_change = std::min(status.next_change, e->get_next_change());
+        if (!animator->empty() || event_bus.has_pending())
+            status.next_change = frame.time;
+        // window children are drawn before their input runs, what the input changed only shows next frame
+        if (frame.has_input())
+            status.next_change = frame.time;
+        status.changed = status.changed || redraw_requested;
+        if (render_rate > 0.f)
+        {
+            // callbacks changed things after the cached frame was drawn, or window children handled a click after
+            // they were drawn into it, draw again next frame
+            if (redraw_requested || structure_version != last_structure_version || frame.has_input_events())
+                render_cached = false;
+            // the frame on screen is the cached one
+            status.changed = status.changed && drawing;
+            // held back changes are drawn once the next render is due
+            if (render_stale)
+                status.next_change = std::min(status.next_change, last_render_time + 1.0 / render_rate);
+        }
+        redraw_requested = false;
+        next_change = status.next_change;
+        FUI_Element::running_redraw = nullptr;
+
+        if (replayed)
+            replay_timings.push_back(std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - run_start).count());
+        return status;
     }
 }
 #endif